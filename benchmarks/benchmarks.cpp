@@ -0,0 +1,435 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "benchmarks.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <algorithm>
+#include <iterator>
+
+#include "embot_core.h"
+
+#include "EoCommon.h"
+#include "EOYtheSystem.h"
+
+#if !defined(BENCHMARKS_VERSION)
+#define BENCHMARKS_VERSION "unknown"
+#endif
+
+#if !defined(BENCHMARKS_BUILD_TYPE)
+#define BENCHMARKS_BUILD_TYPE "unknown"
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the count of the allocations
+// --------------------------------------------------------------------------------------------------------------------
+
+// with glibc the allocator of the executable takes the place of the one of libc also for the shared libraries, so we
+// count the calls and forward them to the functions of glibc. the sanitizers have their own allocator, so we leave it.
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define BENCHMARKS_COUNT_ALLOCATIONS
+#endif
+
+namespace {
+    std::atomic<std::int64_t> s_allocations {0};
+}
+
+#if defined(BENCHMARKS_COUNT_ALLOCATIONS)
+
+extern "C" {
+
+    void * __libc_malloc(size_t size);
+    void * __libc_calloc(size_t number, size_t size);
+    void * __libc_realloc(void *ptr, size_t size);
+    void __libc_free(void *ptr);
+
+    void * malloc(size_t size)
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(size);
+    }
+
+    void * calloc(size_t number, size_t size)
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(number, size);
+    }
+
+    void * realloc(void *ptr, size_t size)
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void *ptr)
+    {
+        __libc_free(ptr);
+    }
+
+} // extern "C"
+
+#endif // defined(BENCHMARKS_COUNT_ALLOCATIONS)
+
+
+std::int64_t benchmarks::allocations()
+{
+#if defined(BENCHMARKS_COUNT_ALLOCATIONS)
+    return s_allocations.load(std::memory_order_relaxed);
+#else
+    return -1;
+#endif
+}
+
+
+std::uint64_t benchmarks::now()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - Context
+// --------------------------------------------------------------------------------------------------------------------
+
+void benchmarks::Context::start()
+{
+    ns = 0;
+    allocs = 0;
+    running = false;
+    resume();
+}
+
+void benchmarks::Context::stop()
+{
+    pause();
+}
+
+void benchmarks::Context::pause()
+{
+    if(running)
+    {
+        ns += now() - t0;
+        allocs += benchmarks::allocations() - a0;
+        running = false;
+    }
+}
+
+void benchmarks::Context::resume()
+{
+    if(!running)
+    {
+        running = true;
+        a0 = benchmarks::allocations();
+        t0 = now();
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - Runner
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    std::string s_escape(const std::string &s)
+    {
+        std::string r {};
+        for(char c : s)
+        {
+            if(('"' == c) || ('\\' == c))
+            {
+                r += '\\';
+            }
+            r += c;
+        }
+        return r;
+    }
+
+    double s_ratio(double a, std::uint64_t b)
+    {
+        return (0 == b) ? 0.0 : (a / static_cast<double>(b));
+    }
+
+}
+
+
+bool benchmarks::Runner::init(const Config &config)
+{
+    if(!config.isvalid())
+    {
+        return false;
+    }
+
+    cfg = config;
+    return true;
+}
+
+
+bool benchmarks::Runner::wants(const std::string &group) const
+{
+    static const char * const groups[] = {"transport", "host", "utils"};
+
+    // a filter which starts with the name of a group selects only benchmarks of that group
+    std::string::size_type dot = cfg.filter.find('.');
+    if(std::string::npos == dot)
+    {
+        return true;
+    }
+
+    std::string g = cfg.filter.substr(0, dot);
+    return (g == group) || (std::end(groups) == std::find(std::begin(groups), std::end(groups), g));
+}
+
+
+void benchmarks::Runner::header()
+{
+    if(cfg.list)
+    {
+        return;
+    }
+
+    std::fprintf(cfg.output, "{\"suite\":\"icub_firmware_shared\",\"version\":\"%s\",\"build\":\"%s\",\"compiler\":\"%s\",\"mintime_ms\":%u,\"allocations\":%s}\n",
+                 BENCHMARKS_VERSION, BENCHMARKS_BUILD_TYPE,
+#if defined(__VERSION__)
+                 s_escape(__VERSION__).c_str(),
+#else
+                 "unknown",
+#endif
+                 cfg.mintime, (allocations() < 0) ? "false" : "true");
+    std::fflush(cfg.output);
+}
+
+
+bool benchmarks::Runner::run(const std::string &name, const std::string &config, const std::string &op, const std::string &item, Body body)
+{
+    constexpr std::uint64_t maxops {1000000000};
+    const std::uint64_t mintime = static_cast<std::uint64_t>(cfg.mintime) * 1000000;
+
+    if((!cfg.filter.empty()) && (std::string::npos == name.find(cfg.filter)))
+    {
+        return false;
+    }
+
+    if(cfg.list)
+    {
+        std::fprintf(cfg.output, "%s %s\n", name.c_str(), config.c_str());
+        return false;
+    }
+
+    // a first operation warms up the caches and does the allocations which happen only once
+    Context context {};
+    context.start();
+    body(1, context);
+    context.stop();
+
+    // then the number of operations grows until they last at least mintime
+    std::uint64_t n {1};
+    std::uint64_t items {0};
+    for(;;)
+    {
+        context.start();
+        items = body(n, context);
+        context.stop();
+
+        if((context.nanoseconds() >= mintime) || (n >= maxops))
+        {
+            break;
+        }
+
+        std::uint64_t ns = std::max<std::uint64_t>(context.nanoseconds(), 1);
+        double predicted = 1.2 * static_cast<double>(n) * static_cast<double>(mintime) / static_cast<double>(ns);
+        n = std::min<std::uint64_t>(maxops, std::max<std::uint64_t>(2*n, std::min<double>(predicted, 100.0 * static_cast<double>(n))));
+    }
+
+    if(0 == items)
+    {
+        fail(name, config, "no item was processed");
+        return false;
+    }
+
+    Result r {};
+    r.name = name;
+    r.config = config;
+    r.op = op;
+    r.item = item;
+    r.ops = n;
+    r.items = items;
+    r.nanoseconds = context.nanoseconds();
+    r.allocations = (allocations() < 0) ? -1 : context.allocations();
+    emit(r);
+
+    return true;
+}
+
+
+void benchmarks::Runner::fail(const std::string &name, const std::string &config, const std::string &reason)
+{
+    nfailures++;
+    if(!cfg.list)
+    {
+        std::fprintf(cfg.output, "{\"benchmark\":\"%s\",\"config\":\"%s\",\"error\":\"%s\"}\n", s_escape(name).c_str(), s_escape(config).c_str(), s_escape(reason).c_str());
+        std::fflush(cfg.output);
+    }
+}
+
+
+void benchmarks::Runner::emit(const Result &r)
+{
+    const double ns = static_cast<double>(r.nanoseconds);
+
+    std::fprintf(cfg.output, "{\"benchmark\":\"%s\",\"config\":\"%s\",\"op\":\"%s\",\"item\":\"%s\",\"ops\":%llu,\"items\":%llu,\"ns\":%llu,"
+                             "\"ns_per_op\":%.2f,\"ns_per_item\":%.2f,\"ops_per_s\":%.1f,\"items_per_op\":%.2f,",
+                 s_escape(r.name).c_str(), s_escape(r.config).c_str(), s_escape(r.op).c_str(), s_escape(r.item).c_str(),
+                 static_cast<unsigned long long>(r.ops), static_cast<unsigned long long>(r.items), static_cast<unsigned long long>(r.nanoseconds),
+                 s_ratio(ns, r.ops), s_ratio(ns, r.items), s_ratio(1e9 * static_cast<double>(r.ops), r.nanoseconds),
+                 s_ratio(static_cast<double>(r.items), r.ops));
+
+    if(r.allocations < 0)
+    {
+        std::fprintf(cfg.output, "\"allocs_per_op\":null}\n");
+    }
+    else
+    {
+        std::fprintf(cfg.output, "\"allocs_per_op\":%.3f}\n", s_ratio(static_cast<double>(r.allocations), r.ops));
+    }
+
+    std::fflush(cfg.output);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the environment of embobj and of embot on the host
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    double s_timeget()
+    {
+        return 1e-9 * static_cast<double>(benchmarks::now());
+    }
+
+    embot::core::Time s_embottime()
+    {
+        return benchmarks::now() / 1000;
+    }
+
+    // the mutexes of embobj, as icub-main gives them to EOYtheSystem
+    void * s_mutex_new()
+    {
+        return new std::mutex;
+    }
+
+    int8_t s_mutex_take(void *m, uint32_t)
+    {
+        static_cast<std::mutex*>(m)->lock();
+        return eores_OK;
+    }
+
+    int8_t s_mutex_release(void *m)
+    {
+        static_cast<std::mutex*>(m)->unlock();
+        return eores_OK;
+    }
+
+    void s_mutex_delete(void *m)
+    {
+        delete static_cast<std::mutex*>(m);
+    }
+
+    void s_usage(const char *program)
+    {
+        std::fprintf(stderr, "usage: %s [--filter <text>] [--min-time <ms>] [--output <file>] [--list]\n"
+                             "  it runs the benchmarks whose name contains <text> and writes one line of json for each of them.\n", program);
+    }
+
+}
+
+
+int main(int argc, char *argv[])
+{
+    benchmarks::Runner::Config config {};
+    const char *filename = nullptr;
+
+    for(int i=1; i<argc; i++)
+    {
+        std::string a {argv[i]};
+        bool hasvalue = (i+1) < argc;
+        if(("--filter" == a) && hasvalue)
+        {
+            config.filter = argv[++i];
+        }
+        else if(("--min-time" == a) && hasvalue)
+        {
+            config.mintime = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if(("--output" == a) && hasvalue)
+        {
+            filename = argv[++i];
+        }
+        else if("--list" == a)
+        {
+            config.list = true;
+        }
+        else
+        {
+            s_usage(argv[0]);
+            return ("--help" == a) ? 0 : 2;
+        }
+    }
+
+    if((nullptr != filename) && (nullptr == (config.output = std::fopen(filename, "w"))))
+    {
+        std::fprintf(stderr, "cannot open %s\n", filename);
+        return 2;
+    }
+
+    benchmarks::Runner runner {};
+    if(!runner.init(config))
+    {
+        s_usage(argv[0]);
+        return 2;
+    }
+
+    const eOysystem_cfg_t syscfg =
+    {
+        s_timeget,
+        { s_mutex_new, s_mutex_take, s_mutex_release, s_mutex_delete }
+    };
+    eoy_sys_Initialise(&syscfg, NULL, NULL);
+
+    embot::core::init({{nullptr, s_embottime}});
+
+    runner.header();
+    benchmarks::transport(runner);
+    benchmarks::host(runner);
+    benchmarks::utils(runner);
+
+    if(stdout != config.output)
+    {
+        std::fclose(config.output);
+    }
+
+    return (0 == runner.failures()) ? 0 : 1;
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
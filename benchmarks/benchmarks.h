@@ -0,0 +1,115 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+
+#ifndef _BENCHMARKS_H_
+#define _BENCHMARKS_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+
+namespace benchmarks {
+
+    // the measurement of a benchmark. an operation is the unit which the body repeats (a packet, a frame, a fleet of
+    // boards) and an item is what the operation processes (a rop, a taxel, a board). the allocations are those done
+    // with malloc(), calloc(), realloc() or new while the body is running, or -1 where they cannot be counted.
+    struct Result
+    {
+        std::string name {};
+        std::string config {};
+        std::string op {"op"};
+        std::string item {"item"};
+        std::uint64_t ops {0};
+        std::uint64_t items {0};
+        std::uint64_t nanoseconds {0};
+        std::int64_t allocations {-1};
+    };
+
+    // it is given to the body so that it can exclude from the measurement what is not part of the operation,
+    // such as the preparation of its input
+    class Context
+    {
+    public:
+        void pause();
+        void resume();
+
+        void start();
+        void stop();
+        std::uint64_t nanoseconds() const { return ns; }
+        std::int64_t allocations() const { return allocs; }
+
+    private:
+        bool running {false};
+        std::uint64_t t0 {0};
+        std::int64_t a0 {0};
+        std::uint64_t ns {0};
+        std::int64_t allocs {0};
+    };
+
+    // the body executes n operations and returns the number of items they have processed
+    using Body = std::function<std::uint64_t(std::uint64_t n, Context &context)>;
+
+    class Runner
+    {
+    public:
+        struct Config
+        {
+            std::string filter {};                  // only the benchmarks whose name contains it are run
+            std::uint32_t mintime {200};            // in ms: the ops are repeated at least for this time
+            bool list {false};                      // if true the benchmarks are only listed
+            FILE *output {stdout};
+            Config() = default;
+            bool isvalid() const { return (0 != mintime) && (nullptr != output); }
+        };
+
+        Runner() = default;
+
+        bool init(const Config &config);
+
+        // false if the filter excludes all the benchmarks of group, so that the group can skip the preparation of
+        // what they need. the name of every benchmark starts with the name of its group and a dot.
+        bool wants(const std::string &group) const;
+
+        // it measures body and writes a line of json. it returns false if the benchmark is filtered out or if the
+        // body has not processed anything
+        bool run(const std::string &name, const std::string &config, const std::string &op, const std::string &item, Body body);
+
+        // it writes a line of json which describes the run
+        void header();
+
+        std::uint32_t failures() const { return nfailures; }
+        void fail(const std::string &name, const std::string &config, const std::string &reason);
+
+    private:
+        void emit(const Result &result);
+        Config cfg {};
+        std::uint32_t nfailures {0};
+    };
+
+    // the allocations done so far by the process, or -1 if they cannot be counted
+    std::int64_t allocations();
+
+    // the monotonic time in ns
+    std::uint64_t now();
+
+    // the groups of benchmarks
+    void transport(Runner &runner);
+    void host(Runner &runner);
+    void utils(Runner &runner);
+
+} // namespace benchmarks {
+
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -0,0 +1,338 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "benchmarks.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "EoCommon.h"
+#include "EOvector_hid.h"
+#include "EOnv_hid.h"
+#include "EOnvSet.h"
+#include "EOtransceiver.h"
+#include "EOhostTransceiver.h"
+#include "EOYmutex.h"
+#include "EoProtocol.h"
+#include "EoProtocolMN.h"
+#include "EoProtocolMC.h"
+#include "eOtransmitBatcher.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the benchmarks of the host: the objects which icub-main keeps for every ETH board
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    constexpr uint16_t s_fleetsize {32};
+
+    eOipv4addr_t s_address(uint16_t i)
+    {
+        return EO_COMMON_IPV4ADDR(10, 0, 1, i+1);
+    }
+
+
+    // the access to a NV of a remote board by the thread which receives its packets and by the threads of the
+    // device drivers, with every protection of the EOnvSet
+    void s_access(benchmarks::Runner &runner)
+    {
+        struct Protection
+        {
+            const char *name;
+            eOnvset_protection_t protection;
+        };
+
+        static const Protection protections[] =
+        {
+            {"none", eo_nvset_protection_none},
+            {"one_per_netvar", eo_nvset_protection_one_per_netvar},
+            {"seqlock_per_entity", eo_nvset_protection_seqlock_per_entity}
+        };
+
+        std::vector<eOprot_EPcfg_t> endpoints {eoprot_mn_basicEPcfg};
+        eOprot_EPcfg_t mc {};
+        mc.endpoint = eoprot_endpoint_motioncontrol;
+        mc.numberofentities[0] = 4;
+        mc.numberofentities[1] = 4;
+        mc.numberofentities[2] = 1;
+        endpoints.push_back(mc);
+        EOconstvector vector = { static_cast<eOsizecntnr_t>(endpoints.size()), static_cast<eOsizecntnr_t>(endpoints.size()), sizeof(eOprot_EPcfg_t), 0, endpoints.data(), nullptr };
+        eOnvset_BRDcfg_t brdcfg = { 0, {0, 0, 0}, &vector };
+
+        const eOprotID32_t id32 = eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, eoprot_tag_mc_joint_status_core);
+
+        for(const auto &p : protections)
+        {
+            const std::string config = std::string("protection=") + p.name;
+
+            eOhosttransceiver_cfg_t cfg = eo_hosttransceiver_cfg_default;
+            cfg.nvsetbrdcfg = &brdcfg;
+            cfg.remoteboardipv4addr = s_address(0);
+            cfg.mutex_fn_new = reinterpret_cast<eov_mutex_fn_mutexderived_new>(eoy_mutex_New);
+            cfg.nvsetprotection = p.protection;
+
+            EOhostTransceiver *host = eo_hosttransceiver_New(&cfg);
+            EOnv nv {};
+            if((nullptr == host) || (eores_OK != eo_nvset_NV_Get(eo_hosttransceiver_GetNVset(host), id32, &nv)))
+            {
+                runner.fail("host.nvset", config, "cannot create the host transceiver");
+                if(nullptr != host)
+                {
+                    eo_hosttransceiver_Delete(host);
+                }
+                continue;
+            }
+
+            runner.run("host.nvset.set", config, "access", "access", [&](std::uint64_t n, benchmarks::Context &)
+            {
+                eOmc_joint_status_core_t value {};
+                for(std::uint64_t i=0; i<n; i++)
+                {
+                    value.measures.meas_position = static_cast<int32_t>(i);
+                    eo_nv_Set(&nv, &value, eobool_true, eo_nv_upd_dontdo);
+                }
+                return n;
+            });
+
+            runner.run("host.nvset.get", config, "access", "access", [&](std::uint64_t n, benchmarks::Context &)
+            {
+                eOmc_joint_status_core_t value {};
+                uint16_t size = 0;
+                for(std::uint64_t i=0; i<n; i++)
+                {
+                    eo_nv_Get(&nv, eo_nv_strg_volatile, &value, &size);
+                }
+                return n;
+            });
+
+            // the same get while the receiving thread keeps on writing the NV
+            runner.run("host.nvset.get", config + ",writer=1", "access", "access", [&](std::uint64_t n, benchmarks::Context &context)
+            {
+                context.pause();
+                std::atomic<bool> stop {false};
+                std::thread writer([&]()
+                {
+                    eOmc_joint_status_core_t value {};
+                    while(!stop.load(std::memory_order_relaxed))
+                    {
+                        value.measures.meas_position++;
+                        eo_nv_Set(&nv, &value, eobool_true, eo_nv_upd_dontdo);
+                    }
+                });
+                context.resume();
+
+                eOmc_joint_status_core_t value {};
+                uint16_t size = 0;
+                for(std::uint64_t i=0; i<n; i++)
+                {
+                    eo_nv_Get(&nv, eo_nv_strg_volatile, &value, &size);
+                }
+
+                context.pause();
+                stop.store(true, std::memory_order_relaxed);
+                writer.join();
+                return n;
+            });
+
+            eo_hosttransceiver_Delete(host);
+        }
+    }
+
+
+    // the creation of the host transceivers of a robot with many boards, with the lazy init of the NVs or without
+    // it and by one or more threads
+    void s_fleet(benchmarks::Runner &runner)
+    {
+        const uint16_t cores = static_cast<uint16_t>(std::clamp<unsigned>(std::thread::hardware_concurrency(), 2, 8));
+
+        std::vector<eOnvset_BRDcfg_t> brdcfgs(s_fleetsize, eonvset_BRDcfgMax);
+        std::vector<eOhosttransceiver_cfg_t> cfgs(s_fleetsize, eo_hosttransceiver_cfg_default);
+        for(uint16_t i=0; i<s_fleetsize; i++)
+        {
+            brdcfgs[i].boardnum = static_cast<eOnvBRD_t>(i);
+            cfgs[i].nvsetbrdcfg = &brdcfgs[i];
+            cfgs[i].remoteboardipv4addr = s_address(i);
+        }
+
+        if(eores_OK != eo_hosttransceiver_PrepareConcurrentNew(cfgs.data(), s_fleetsize))
+        {
+            runner.fail("host.startup.fleet", "", "cannot reserve the boards");
+            return;
+        }
+
+        for(bool lazy : {false, true})
+        {
+            for(uint16_t threads : {static_cast<uint16_t>(1), cores})
+            {
+                const std::string config = std::string("boards=32,lazy=") + (lazy ? "1" : "0") + ",threads=" + std::to_string(threads);
+                for(auto &c : cfgs)
+                {
+                    c.nvsetlazyinit = lazy ? eobool_true : eobool_false;
+                }
+
+                runner.run("host.startup.fleet", config, "fleet", "board", [&](std::uint64_t n, benchmarks::Context &context)
+                {
+                    std::uint64_t items = 0;
+                    std::vector<EOhostTransceiver*> hosts(s_fleetsize, nullptr);
+
+                    for(std::uint64_t i=0; i<n; i++)
+                    {
+                        std::atomic<uint16_t> next {0};
+                        auto create = [&]()
+                        {
+                            for(uint16_t b = next++; b < s_fleetsize; b = next++)
+                            {
+                                hosts[b] = eo_hosttransceiver_New(&cfgs[b]);
+                            }
+                        };
+
+                        if(1 == threads)
+                        {
+                            create();
+                        }
+                        else
+                        {
+                            std::vector<std::thread> workers {};
+                            for(uint16_t t=0; t<threads; t++)
+                            {
+                                workers.emplace_back(create);
+                            }
+                            for(auto &w : workers)
+                            {
+                                w.join();
+                            }
+                        }
+
+                        context.pause();
+                        for(auto &h : hosts)
+                        {
+                            if(nullptr != h)
+                            {
+                                items++;
+                                eo_hosttransceiver_Delete(h);
+                                h = nullptr;
+                            }
+                        }
+                        context.resume();
+                    }
+
+                    return items;
+                });
+            }
+        }
+    }
+
+
+    void s_sink(void *, const eOtransmitBatcher_packet_t *, uint16_t, uint64_t)
+    {
+    }
+
+
+    // the transmission of the packets of many boards by the eOtransmitBatcher, with a sink in place of the socket
+    // so that only the preparation and the gathering of the packets are measured
+    void s_batcher(benchmarks::Runner &runner)
+    {
+        std::vector<eOnvset_BRDcfg_t> brdcfgs(s_fleetsize, eonvset_BRDcfgBasic);
+        std::vector<EOhostTransceiver*> hosts(s_fleetsize, nullptr);
+
+        eOtransmitBatcher_cfg_t bcfg = eOtransmitBatcher_cfg_default;
+        bcfg.maxboards = s_fleetsize;
+        bcfg.slots = 1;
+        bcfg.sink = s_sink;
+        eOtransmitBatcher *batcher = eOtransmitBatcher_New(&bcfg);
+
+        bool ok = (nullptr != batcher);
+        for(uint16_t i=0; ok && (i<s_fleetsize); i++)
+        {
+            brdcfgs[i].boardnum = static_cast<eOnvBRD_t>(i);
+            eOhosttransceiver_cfg_t cfg = eo_hosttransceiver_cfg_default;
+            cfg.nvsetbrdcfg = &brdcfgs[i];
+            cfg.remoteboardipv4addr = s_address(i);
+            hosts[i] = eo_hosttransceiver_New(&cfg);
+            ok = (nullptr != hosts[i]) && (eOtransmitBatcher_Add(batcher, hosts[i]) >= 0);
+        }
+
+        if(ok)
+        {
+            eOropdescriptor_t rop = eok_ropdesc_basic;
+            rop.ropcode = eo_ropcode_ask;
+            rop.id32 = eoprot_ID_get(eoprot_endpoint_management, eoprot_entity_mn_comm, 0, eoprot_tag_mn_comm_status);
+
+            // the time of the batcher is given by us rather than by its clock, so that no cycle waits for its period
+            uint64_t time = 0;
+
+            runner.run("host.transmit.batcher", "boards=32,slots=1", "cycle", "packet", [&](std::uint64_t n, benchmarks::Context &context)
+            {
+                std::uint64_t items = 0;
+                for(std::uint64_t i=0; i<n; i++)
+                {
+                    context.pause();
+                    for(auto h : hosts)
+                    {
+                        eo_transceiver_OccasionalROP_Load(eo_hosttransceiver_GetTransceiver(h), &rop);
+                    }
+                    context.resume();
+
+                    uint64_t next = time;
+                    items += eOtransmitBatcher_Transmit(batcher, time, &next);
+                    time = std::max(next, time + 1);
+                }
+                return items;
+            });
+        }
+        else
+        {
+            runner.fail("host.transmit.batcher", "boards=32,slots=1", "cannot create the batcher and its boards");
+        }
+
+        if(nullptr != batcher)
+        {
+            eOtransmitBatcher_Delete(batcher);
+        }
+        for(auto h : hosts)
+        {
+            if(nullptr != h)
+            {
+                eo_hosttransceiver_Delete(h);
+            }
+        }
+    }
+
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the benchmarks
+// --------------------------------------------------------------------------------------------------------------------
+
+void benchmarks::host(Runner &runner)
+{
+    if(!runner.wants("host"))
+    {
+        return;
+    }
+
+    s_access(runner);
+    s_fleet(runner);
+    s_batcher(runner);
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
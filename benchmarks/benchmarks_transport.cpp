@@ -0,0 +1,425 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "benchmarks.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstring>
+
+#include "EoCommon.h"
+#include "EOvector_hid.h"
+#include "EOnvSet.h"
+#include "EOtransceiver.h"
+#include "EOhostTransceiver.h"
+#include "EOreceiver.h"
+#include "EOtheParser.h"
+#include "EOrop.h"
+#include "EOropframe_hid.h"
+#include "EOpacket.h"
+#include "EoProtocol.h"
+#include "EoProtocolMN.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoProtocolSK.h"
+
+#include "embot_prot_eth_ropframe.h"
+#include "embot_prot_eth_diagnostic_Node.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the synthetic boards
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    // the endpoints of a board and the regular rops it sends to the host at every cycle
+    struct Profile
+    {
+        const char *name {nullptr};
+        std::vector<eOprot_EPcfg_t> endpoints {};
+        std::vector<eOprotID32_t> regulars {};
+    };
+
+    eOprot_EPcfg_t s_epcfg(eOprotEndpoint_t ep, std::vector<uint8_t> entities)
+    {
+        eOprot_EPcfg_t cfg {};
+        cfg.endpoint = ep;
+        std::memcpy(cfg.numberofentities, entities.data(), std::min<size_t>(entities.size(), sizeof(cfg.numberofentities)));
+        return cfg;
+    }
+
+    void s_mc(Profile &p)
+    {
+        // a board with 4 joints and 4 motors which sends their status
+        p.endpoints.push_back(s_epcfg(eoprot_endpoint_motioncontrol, {4, 4, 1}));
+        for(uint8_t i=0; i<4; i++)
+        {
+            p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, i, eoprot_tag_mc_joint_status_core));
+            p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, i, eoprot_tag_mc_motor_status));
+        }
+    }
+
+    void s_as(Profile &p)
+    {
+        // a board with a strain, a mais and the inertials
+        p.endpoints.push_back(s_epcfg(eoprot_endpoint_analogsensors, {1, 1, 0, 1}));
+        p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_analogsensors, eoprot_entity_as_strain, 0, eoprot_tag_as_strain_status));
+        p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_analogsensors, eoprot_entity_as_mais, 0, eoprot_tag_as_mais_status));
+        p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_analogsensors, eoprot_entity_as_inertial3, 0, eoprot_tag_as_inertial3_status));
+    }
+
+    void s_sk(Profile &p)
+    {
+        // a board with two patches of skin
+        p.endpoints.push_back(s_epcfg(eoprot_endpoint_skin, {2}));
+        for(uint8_t i=0; i<2; i++)
+        {
+            p.regulars.push_back(eoprot_ID_get(eoprot_endpoint_skin, eoprot_entity_sk_skin, i, eoprot_tag_sk_skin_status_arrayofcandata));
+        }
+    }
+
+    std::vector<Profile> s_profiles()
+    {
+        std::vector<Profile> profiles(4);
+
+        profiles[0].name = "mc";
+        profiles[1].name = "as";
+        profiles[2].name = "sk";
+        profiles[3].name = "mc+as+sk";
+
+        for(auto &p : profiles)
+        {
+            p.endpoints.push_back(eoprot_mn_basicEPcfg);
+        }
+
+        s_mc(profiles[0]);
+        s_as(profiles[1]);
+        s_sk(profiles[2]);
+        s_mc(profiles[3]);
+        s_as(profiles[3]);
+        s_sk(profiles[3]);
+
+        return profiles;
+    }
+
+
+    // a board which sends its regulars to a EOhostTransceiver, as an ems does with icub-main. there can be only one
+    // of them at a time because the EoProtocol library keeps only one local board.
+    class Link
+    {
+    public:
+        static constexpr eOipv4addr_t hostaddress {EO_COMMON_IPV4ADDR(10, 0, 1, 104)};
+        static constexpr eOipv4addr_t boardaddress {EO_COMMON_IPV4ADDR(10, 0, 1, 1)};
+        static constexpr eOipv4port_t port {12345};
+        static constexpr uint16_t capacityofpacket {EOK_HOSTTRANSCEIVER_capacityofrxpacket};
+        static constexpr uint16_t capturedpackets {16};
+
+        struct Packet
+        {
+            std::vector<uint8_t> data {};
+            uint16_t rops {0};
+        };
+
+        Link() = default;
+        Link(const Link&) = delete;
+        Link & operator=(const Link&) = delete;
+
+        ~Link()
+        {
+            if(nullptr != board)
+            {
+                eo_transceiver_Delete(board);
+            }
+            if(nullptr != boardnvset)
+            {
+                eo_nvset_Delete(boardnvset);
+            }
+            if(nullptr != host)
+            {
+                eo_hosttransceiver_Delete(host);
+            }
+        }
+
+        bool init(const Profile &profile)
+        {
+            endpoints = profile.endpoints;
+            vector = { static_cast<eOsizecntnr_t>(endpoints.size()), static_cast<eOsizecntnr_t>(endpoints.size()), sizeof(eOprot_EPcfg_t), 0, endpoints.data(), nullptr };
+
+            // the board owns its nvs, which the transmitter reads at every packet
+            boardcfg = { 0, {0, 0, 0}, &vector };
+            if(nullptr == (boardnvset = eo_nvset_New(eo_nvset_protection_none, nullptr)))
+            {
+                return false;
+            }
+            if(eores_OK != eo_nvset_InitBRD_LoadEPs(boardnvset, eo_nvset_ownership_local, boardaddress, &boardcfg, eobool_true))
+            {
+                return false;
+            }
+
+            eOtransceiver_cfg_t txrxcfg = eo_transceiver_cfg_default;
+            txrxcfg.sizes.capacityoftxpacket = capacityofpacket;
+            txrxcfg.sizes.capacityofrop = 512;
+            txrxcfg.sizes.capacityofropframeregulars = capacityofpacket - 2*128;
+            txrxcfg.sizes.capacityofropframeoccasionals = 128;
+            txrxcfg.sizes.capacityofropframereplies = 128;
+            txrxcfg.sizes.maxnumberofregularrops = 32;
+            txrxcfg.remipv4addr = hostaddress;
+            txrxcfg.remipv4port = port;
+            txrxcfg.nvset = boardnvset;
+            if(nullptr == (board = eo_transceiver_New(&txrxcfg)))
+            {
+                return false;
+            }
+
+            for(auto id32 : profile.regulars)
+            {
+                eOropdescriptor_t rop = eok_ropdesc_basic;
+                rop.ropcode = eo_ropcode_sig;
+                rop.id32 = id32;
+                if(eores_OK != eo_transceiver_RegularROP_Load(board, &rop))
+                {
+                    return false;
+                }
+            }
+
+            // the host has the same endpoints as a remote board
+            hostcfg = { 1, {0, 0, 0}, &vector };
+            eOhosttransceiver_cfg_t htcfg = eo_hosttransceiver_cfg_default;
+            htcfg.nvsetbrdcfg = &hostcfg;
+            htcfg.remoteboardipv4addr = boardaddress;
+            htcfg.remoteboardipv4port = port;
+            if(nullptr == (host = eo_hosttransceiver_New(&htcfg)))
+            {
+                return false;
+            }
+            receiver = eo_transceiver_GetReceiver(eo_hosttransceiver_GetTransceiver(host));
+
+            // some consecutive packets are kept for the benchmarks of reception
+            for(uint16_t i=0; i<capturedpackets; i++)
+            {
+                Packet p {};
+                uint8_t *data = nullptr;
+                uint16_t size = 0;
+                if((0 == transmit(&data, &size, &p.rops)) || (p.rops != profile.regulars.size()))
+                {
+                    return false;
+                }
+                p.data.assign(data, data + size);
+                packets.push_back(std::move(p));
+            }
+
+            return true;
+        }
+
+        uint16_t transmit(uint8_t **data = nullptr, uint16_t *size = nullptr, uint16_t *rops = nullptr)
+        {
+            uint16_t numberofrops = 0;
+            eOtransmitter_ropsnumber_t ropsnum {};
+            EOpacket *pkt = nullptr;
+
+            if((eores_OK != eo_transceiver_outpacket_Prepare(board, &numberofrops, &ropsnum)) || (eores_OK != eo_transceiver_outpacket_Get(board, &pkt)))
+            {
+                return 0;
+            }
+
+            if(nullptr != data)
+            {
+                eo_packet_Payload_Get(pkt, data, size);
+                *rops = numberofrops;
+            }
+
+            return numberofrops;
+        }
+
+        EOtransceiver *board {nullptr};
+        EOnvSet *boardnvset {nullptr};
+        EOhostTransceiver *host {nullptr};
+        EOreceiver *receiver {nullptr};
+        std::vector<Packet> packets {};
+
+    private:
+        std::vector<eOprot_EPcfg_t> endpoints {};
+        EOconstvector vector {};
+        eOnvset_BRDcfg_t boardcfg {};
+        eOnvset_BRDcfg_t hostcfg {};
+    };
+
+
+    std::uint64_t s_ropsparsed {0};
+
+    bool s_onrop(const embot::prot::eth::IPv4 &, const embot::prot::eth::rop::Descriptor &rop)
+    {
+        s_ropsparsed++;
+        return embot::prot::eth::ID32none != rop.id32;
+    }
+
+
+    void s_link(benchmarks::Runner &runner, const Profile &profile)
+    {
+        const std::string config = std::string("board=") + profile.name;
+        Link link {};
+
+        if(!link.init(profile))
+        {
+            runner.fail("transport.link", config, "cannot create the board and the host");
+            return;
+        }
+
+        runner.run("transport.transmitter.prepare", config, "packet", "rop", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += link.transmit();
+            }
+            return items;
+        });
+
+        EOpacket *packet = eo_packet_New(0);
+
+        runner.run("transport.receiver.process", config, "packet", "rop", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                Link::Packet &p = link.packets[i % link.packets.size()];
+                uint16_t numberofrops = 0;
+                eObool_t thereisareply = eobool_false;
+                eOabstime_t txtime = 0;
+                eo_packet_Full_LinkTo(packet, Link::boardaddress, Link::port, static_cast<uint16_t>(p.data.size()), p.data.data());
+                eo_receiver_Process(link.receiver, packet, &numberofrops, &thereisareply, &txtime);
+                items += numberofrops;
+            }
+            return items;
+        });
+
+        eo_packet_Delete(packet);
+
+        EOtheParser *parser = eo_parser_Initialise();
+        EOrop *rop = eo_rop_New(512);
+
+        runner.run("transport.parser.getrop", config, "packet", "rop", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                const Link::Packet &p = link.packets[i % link.packets.size()];
+                const uint8_t *stream = p.data.data() + sizeof(EOropframeHeader_t);
+                uint16_t size = reinterpret_cast<const EOropframeHeader_t*>(p.data.data())->ropssizeof;
+                while(size > 0)
+                {
+                    uint16_t consumed = 0;
+                    eOparserResult_t result = eo_parser_res_ok;
+                    if(eores_OK == eo_parser_GetROP(parser, stream, size, rop, &consumed, &result))
+                    {
+                        items++;
+                    }
+                    if((0 == consumed) || (consumed > size))
+                    {
+                        break;
+                    }
+                    stream += consumed;
+                    size -= consumed;
+                }
+            }
+            return items;
+        });
+
+        eo_rop_Delete(rop);
+
+        embot::prot::eth::ropframe::Parser ropframeparser {};
+        const embot::prot::eth::IPv4 ipv4 {Link::boardaddress};
+
+        runner.run("transport.ropframe.parse", config, "packet", "rop", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            s_ropsparsed = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                Link::Packet &p = link.packets[i % link.packets.size()];
+                uint16_t bytes = 0;
+                if(ropframeparser.load({p.data.data(), p.data.size()}))
+                {
+                    ropframeparser.parse(ipv4, s_onrop, bytes);
+                }
+            }
+            return s_ropsparsed;
+        });
+    }
+
+
+    void s_diagnostic(benchmarks::Runner &runner)
+    {
+        constexpr uint16_t infosperframe {16};
+        embot::prot::eth::diagnostic::Node node {};
+
+        if(!node.init({false, 128, 1024}))
+        {
+            runner.fail("transport.diagnostic.prepare", "", "cannot init the node");
+            return;
+        }
+
+        runner.run("transport.diagnostic.prepare", "infos=16", "ropframe", "rop", [&](std::uint64_t n, benchmarks::Context &context)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                // the infos are added as the services of a board do, but only the preparation of the ropframe is measured
+                context.pause();
+                for(uint16_t k=0; k<infosperframe; k++)
+                {
+                    embot::prot::eth::diagnostic::InfoBasic info {i, 0x100u + k, {embot::prot::eth::diagnostic::TYP::warning, embot::prot::eth::diagnostic::SRC::can1, embot::prot::eth::diagnostic::ADR::three, embot::prot::eth::diagnostic::EXT::none}, k, i};
+                    node.add(info);
+                }
+                context.resume();
+
+                size_t size = 0;
+                embot::core::Data frame {};
+                uint16_t rops = node.getNumberOfROPs();
+                if(node.prepare(size) && node.borrow(frame))
+                {
+                    items += rops;
+                    node.release();
+                }
+            }
+            return items;
+        });
+    }
+
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the benchmarks
+// --------------------------------------------------------------------------------------------------------------------
+
+void benchmarks::transport(Runner &runner)
+{
+    if(!runner.wants("transport"))
+    {
+        return;
+    }
+
+    for(const auto &profile : s_profiles())
+    {
+        s_link(runner, profile);
+    }
+
+    s_diagnostic(runner);
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
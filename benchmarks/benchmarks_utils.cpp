@@ -0,0 +1,462 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "benchmarks.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <vector>
+#include <random>
+#include <cstring>
+
+#include "EoCommon.h"
+#include "EoBoards.h"
+#include "EoMotionControl.h"
+#include "eOskinDecoder.h"
+#include "iCubCanProto_codec.h"
+#include "OPCprotocolManager.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the database of the OPCprotocolManager
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    constexpr uint16_t s_opcvariables {512};
+    opcprotman_var_map_t s_opcmap[s_opcvariables] {};
+    uint32_t s_opcram[s_opcvariables] {};
+    opcprotman_cfg_t s_opccfg {0x1234, s_opcvariables, s_opcmap};
+
+}
+
+extern "C" {
+
+    // the OPCprotocolManager asks them to its user
+    opcprotman_cfg_t * opcprotman_getconfiguration(void)
+    {
+        return &s_opccfg;
+    }
+
+    opcprotman_res_t opcprotman_personalize_database(OPCprotocolManager *p)
+    {
+        for(uint16_t i=0; i<s_opcvariables; i++)
+        {
+            if(opcprotman_OK != opcprotman_personalize_var(p, s_opcmap[i].var, reinterpret_cast<uint8_t*>(&s_opcram[i]), nullptr))
+            {
+                return opcprotman_NOK_generic;
+            }
+        }
+        return opcprotman_OK;
+    }
+
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the benchmarks
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    void s_skin(benchmarks::Runner &runner)
+    {
+        // a patch of 7 boards of 16 triangles, which sends arrays of 24 frames as the ems does
+        constexpr uint8_t numberofarrays {32};
+        const uint8_t boards[7] = {8, 9, 10, 11, 12, 13, 14};
+        std::mt19937 rnd {1};
+        std::vector<EOarray_of_skincandata_t> arrays(numberofarrays);
+        std::vector<uint8_t> taxels(sizeof(boards) * 16 * eOskinDecoder_taxels);
+        std::vector<float> taxelsf(taxels.size());
+
+        for(auto &a : arrays)
+        {
+            std::memset(&a, 0, sizeof(a));
+            a.head.capacity = 24;
+            a.head.itemsize = sizeof(eOsk_candata_t);
+            a.head.size = 24;
+            for(uint8_t i=0; i<24; i++)
+            {
+                eOsk_candata_t c {};
+                uint8_t board = boards[rnd() % sizeof(boards)];
+                c.info = EOSK_CANDATA_INFO(8, ((4 << 8) | (board << 4) | (rnd() % 16)));
+                for(auto &d : c.data)
+                {
+                    d = static_cast<uint8_t>(rnd());
+                }
+                c.data[0] = (0 == (rnd() % 2)) ? 0x40 : 0xC0;
+                std::memcpy(&a.data[i * sizeof(eOsk_candata_t)], &c, sizeof(c));
+            }
+        }
+
+        eOskinDecoder *decoder = eOskinDecoder_New(1);
+        if((nullptr == decoder) || (eores_OK != eOskinDecoder_Patch_Set(decoder, 0, boards, sizeof(boards), 0)))
+        {
+            runner.fail("utils.skin.decode", "", "cannot create the decoder");
+            eOskinDecoder_Delete(decoder);
+            return;
+        }
+
+        runner.run("utils.skin.decode", "taxels=uint8", "array", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += eOskinDecoder_Decode(decoder, 0, &arrays[i % numberofarrays], taxels.data());
+            }
+            return items;
+        });
+
+        runner.run("utils.skin.decode", "taxels=float", "array", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += eOskinDecoder_Decode_float(decoder, 0, &arrays[i % numberofarrays], taxelsf.data());
+            }
+            return items;
+        });
+
+        eOskinDecoder_Delete(decoder);
+
+        // the full body: a patch on each of 8 can buses (hands, forearms, upper arms, torso and legs) with its own boards,
+        // and every cycle brings one array per patch. the taxels of all the patches are in the same buffer.
+        constexpr uint8_t numberofpatches {8};
+        constexpr uint8_t numberofcycles {16};
+        const uint8_t bodyboards[numberofpatches][7] =
+        {
+            {8, 9, 10, 11, 12, 13, 14}, {8, 9, 10, 11, 12, 13, 14}, {8, 9, 10, 11, 12, 13, 0}, {8, 9, 10, 11, 12, 13, 0},
+            {7, 8, 9, 10, 11, 12, 13}, {7, 8, 9, 10, 11, 12, 13}, {1, 2, 3, 4, 5, 6, 7}, {1, 2, 3, 4, 5, 6, 7}
+        };
+        const uint32_t patchtaxels = sizeof(bodyboards[0]) * 16 * eOskinDecoder_taxels;
+        std::vector<EOarray_of_skincandata_t> bodyarrays(numberofcycles * numberofpatches);
+        std::vector<eOskinDecoder_item_t> bodyitems(bodyarrays.size());
+        std::vector<uint8_t> bodytaxels(numberofpatches * patchtaxels);
+        std::vector<float> bodytaxelsf(bodytaxels.size());
+
+        for(std::size_t k=0; k<bodyarrays.size(); k++)
+        {
+            const uint8_t patch = static_cast<uint8_t>(k % numberofpatches);
+            EOarray_of_skincandata_t &a = bodyarrays[k];
+            std::memset(&a, 0, sizeof(a));
+            a.head.capacity = 24;
+            a.head.itemsize = sizeof(eOsk_candata_t);
+            a.head.size = 24;
+            for(uint8_t i=0; i<24; i++)
+            {
+                eOsk_candata_t c {};
+                uint8_t board = bodyboards[patch][rnd() % sizeof(bodyboards[0])];
+                c.info = EOSK_CANDATA_INFO(8, ((4 << 8) | (board << 4) | (rnd() % 16)));
+                for(auto &d : c.data)
+                {
+                    d = static_cast<uint8_t>(rnd());
+                }
+                c.data[0] = (0 == (rnd() % 2)) ? 0x40 : 0xC0;
+                std::memcpy(&a.data[i * sizeof(eOsk_candata_t)], &c, sizeof(c));
+            }
+            bodyitems[k] = {};
+            bodyitems[k].patch = patch;
+            bodyitems[k].array = &a;
+        }
+
+        eOskinDecoder *body = eOskinDecoder_New(numberofpatches);
+        bool ok = (nullptr != body);
+        for(uint8_t p=0; ok && (p<numberofpatches); p++)
+        {
+            ok = (eores_OK == eOskinDecoder_Patch_Set(body, p, bodyboards[p], sizeof(bodyboards[p]), p * patchtaxels));
+        }
+        if(!ok)
+        {
+            runner.fail("utils.skin.decodebatch", "", "cannot create the decoder");
+            eOskinDecoder_Delete(body);
+            return;
+        }
+
+        runner.run("utils.skin.decodebatch", "patches=8,taxels=uint8", "cycle", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                const eOskinDecoder_item_t *cycle = &bodyitems[(i % numberofcycles) * numberofpatches];
+                items += eOskinDecoder_DecodeBatch(body, cycle, numberofpatches, bodytaxels.data());
+            }
+            return items;
+        });
+
+        runner.run("utils.skin.decodebatch", "patches=8,taxels=float", "cycle", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                const eOskinDecoder_item_t *cycle = &bodyitems[(i % numberofcycles) * numberofpatches];
+                items += eOskinDecoder_DecodeBatch_float(body, cycle, numberofpatches, bodytaxelsf.data());
+            }
+            return items;
+        });
+
+        eOskinDecoder_Delete(body);
+    }
+
+
+    void s_can(benchmarks::Runner &runner)
+    {
+        // the periodic traffic of a can bus with joints, a strain, the skin and an imu
+        constexpr uint32_t numberofframes {64};
+        std::vector<icubCanProto_frame_t> frames(numberofframes);
+        std::vector<icubCanProto_message_t> messages(numberofframes);
+
+        auto encode = [&frames](uint32_t i)
+        {
+            icubCanProto_frame_t &f = frames[i];
+            switch(i % 4)
+            {
+                case 0:
+                {
+                    icubCanProto_mc_periodic_t mc {};
+                    mc.source = 1 + (i % 4);
+                    mc.type = ICUBCANPROTO_PER_MC_MSG__2FOC;
+                    mc.value.foc.current = -static_cast<int16_t>(i);
+                    mc.value.foc.velocity = 400;
+                    mc.value.foc.position = -99999 + static_cast<int32_t>(i);
+                    return icubCanProto_codec_MCperiodic_Encode(&mc, &f);
+                }
+                case 1:
+                {
+                    icubCanProto_as_periodic_t as {};
+                    as.source = 13;
+                    as.type = ICUBCANPROTO_PER_AS_MSG__FORCE_VECTOR;
+                    as.value.vector.values[0] = static_cast<uint16_t>(0x8000 + i);
+                    as.value.vector.values[1] = static_cast<uint16_t>(0x8000 - i);
+                    as.value.vector.values[2] = 0x8000;
+                    return icubCanProto_codec_ASperiodic_Encode(&as, &f);
+                }
+                case 2:
+                {
+                    icubCanProto_skin_periodic_t sk {};
+                    sk.source = 8;
+                    sk.triangle = i % 16;
+                    sk.second = (i / 4) % 2;
+                    sk.info = 0x40;
+                    for(uint8_t k=0; k<7; k++)
+                    {
+                        sk.taxels[k] = static_cast<uint8_t>(200 + k + i);
+                    }
+                    return icubCanProto_codec_Skin_Encode(&sk, &f);
+                }
+                default:
+                {
+                    icubCanProto_is_periodic_t is {};
+                    is.source = 2;
+                    is.type = ICUBCANPROTO_PER_IS_MSG__IMU_TRIPLE;
+                    is.sequence = static_cast<uint8_t>(i);
+                    is.sensor = 1;
+                    is.values[0] = -1;
+                    is.values[1] = static_cast<int16_t>(i);
+                    is.values[2] = -32768;
+                    return icubCanProto_codec_ISperiodic_Encode(&is, &f);
+                }
+            }
+        };
+
+        for(uint32_t i=0; i<numberofframes; i++)
+        {
+            if(icubCanProto_codec_result_ok != encode(i))
+            {
+                runner.fail("utils.can", "", "cannot encode the frames");
+                return;
+            }
+        }
+
+        runner.run("utils.can.encode", "frames=64", "batch", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                for(uint32_t k=0; k<numberofframes; k++)
+                {
+                    items += (icubCanProto_codec_result_ok == encode(k)) ? 1 : 0;
+                }
+            }
+            return items;
+        });
+
+        runner.run("utils.can.decode", "frames=64", "batch", "frame", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += icubCanProto_codec_DecodeBatch(frames.data(), numberofframes, messages.data());
+            }
+            return items;
+        });
+    }
+
+
+    void s_maps(benchmarks::Runner &runner)
+    {
+        std::vector<std::string> types {};
+        std::vector<std::string> encoders {};
+
+        for(uint16_t v=0; v<256; v++)
+        {
+            std::string t = eoboards_type2string2(static_cast<eObrd_type_t>(v), eobool_true);
+            if(std::string::npos == t.find("unknown"))
+            {
+                types.push_back(t);
+            }
+            std::string e = eomc_encoder2string(static_cast<eOmc_encoder_t>(v), eobool_false);
+            if(std::string::npos == e.find("unknown"))
+            {
+                encoders.push_back(e);
+            }
+        }
+
+        runner.run("utils.map.string2value", "map=boards.type", "lookup", "lookup", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += (eobrd_unknown != eoboards_string2type2(types[i % types.size()].c_str(), eobool_true)) ? 1 : 0;
+            }
+            return items;
+        });
+
+        runner.run("utils.map.string2value", "map=mc.encoder", "lookup", "lookup", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                items += (eomc_enc_unknown != eomc_string2encoder(encoders[i % encoders.size()].c_str(), eobool_false)) ? 1 : 0;
+            }
+            return items;
+        });
+    }
+
+
+    void s_q17_14(benchmarks::Runner &runner)
+    {
+        constexpr uint32_t size {1024};
+        std::mt19937 rnd {1};
+        std::vector<eOq17_14_t> a(size), b(size), r(size);
+        std::vector<float> f(size);
+
+        for(uint32_t i=0; i<size; i++)
+        {
+            a[i] = static_cast<eOq17_14_t>(rnd()) >> (rnd() % 16);
+            b[i] = static_cast<eOq17_14_t>(rnd()) >> (8 + (rnd() % 16));
+        }
+
+        runner.run("utils.q17_14.multiply", "mode=batch", "array", "element", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                eo_common_Q17_14_batch_multiply(a.data(), b.data(), r.data(), size);
+            }
+            return n * size;
+        });
+
+        runner.run("utils.q17_14.multiply", "mode=scalar", "array", "element", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                for(uint32_t k=0; k<size; k++)
+                {
+                    eo_common_Q17_14_multiply(a[k], b[k], &r[k]);
+                }
+            }
+            return n * size;
+        });
+
+        runner.run("utils.q17_14.to_float", "mode=batch", "array", "element", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                eo_common_Q17_14_batch_to_float(a.data(), f.data(), size);
+            }
+            return n * size;
+        });
+
+        runner.run("utils.q17_14.to_float", "mode=scalar", "array", "element", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                for(uint32_t k=0; k<size; k++)
+                {
+                    f[k] = eo_common_Q17_14_to_float(a[k]);
+                }
+            }
+            return n * size;
+        });
+    }
+
+
+    void s_opc(benchmarks::Runner &runner)
+    {
+        for(uint16_t i=0; i<s_opcvariables; i++)
+        {
+            s_opcmap[i].var = static_cast<uint16_t>(i * 97);
+            s_opcmap[i].size = sizeof(uint32_t);
+            s_opcram[i] = i;
+        }
+
+        OPCprotocolManager *opc = opcprotman_New(&s_opccfg);
+        if(nullptr == opc)
+        {
+            runner.fail("utils.opc.formparse", "", "cannot create the OPCprotocolManager");
+            return;
+        }
+
+        uint32_t message[64] {};
+        uint32_t reply[64] {};
+
+        runner.run("utils.opc.formparse", "vars=512", "ask", "message", [&](std::uint64_t n, benchmarks::Context &)
+        {
+            std::uint64_t items = 0;
+            for(std::uint64_t i=0; i<n; i++)
+            {
+                uint16_t size = 0;
+                uint16_t replysize = 0;
+                opcprotman_message_t *m = reinterpret_cast<opcprotman_message_t*>(message);
+                opcprotman_message_t *r = reinterpret_cast<opcprotman_message_t*>(reply);
+                if(opcprotman_OK == opcprotman_Form(opc, opcprotman_opc_ask, s_opcmap[i % s_opcvariables].var, nullptr, m, &size))
+                {
+                    items += (opcprotman_OK_withreply == opcprotman_Parse(opc, m, r, &replysize)) ? 2 : 1;
+                }
+            }
+            return items;
+        });
+
+        opcprotman_Delete(opc);
+    }
+
+}
+
+
+void benchmarks::utils(Runner &runner)
+{
+    if(!runner.wants("utils"))
+    {
+        return;
+    }
+
+    s_skin(runner);
+    s_can(runner);
+    s_maps(runner);
+    s_q17_14(runner);
+    s_opc(runner);
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
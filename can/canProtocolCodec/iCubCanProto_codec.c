@@ -0,0 +1,819 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       iCubCanProto_codec.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "string.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "iCubCanProto_codec.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef icubCanProto_codec_result_t (*icubCanProto_codec_decoder_fp_t)(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+
+typedef enum
+{
+    s_view_none         = 0,    // the type has no codec
+    s_view_raw          = 1,
+    s_view_position     = 2,
+    s_view_velocity     = 3,
+    s_view_foc          = 4,
+    s_view_status       = 5,
+    s_view_words        = 6,
+    s_view_vector       = 7,
+    s_view_thermometer  = 8,
+    s_view_xyz          = 9,
+    s_view_triple       = 10,
+    s_view_quaternion   = 11,
+    s_view_imustatus    = 12
+} s_view_t;
+
+typedef struct
+{
+    uint8_t     view;       // use s_view_t
+    uint8_t     minsize;    // the payload must be at least this long
+} s_typeinfo_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static icubCanProto_codec_result_t s_decode_command(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+static icubCanProto_codec_result_t s_decode_mc(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+static icubCanProto_codec_result_t s_decode_as(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+static icubCanProto_codec_result_t s_decode_skin(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+static icubCanProto_codec_result_t s_decode_is(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+
+static void s_frame_init(icubCanProto_frame_t *frame, uint32_t id, uint8_t size);
+
+static int16_t s_get16(const uint8_t *data);
+static int32_t s_get32(const uint8_t *data);
+static void s_put16(uint8_t *data, int16_t value);
+static void s_put32(uint8_t *data, int32_t value);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+// indexed by the class of the frame
+static const icubCanProto_codec_decoder_fp_t s_decoders[8] =
+{
+    s_decode_command,   // ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL
+    s_decode_mc,        // ICUBCANPROTO_CLASS_PERIODIC_MOTORCONTROL
+    s_decode_command,   // ICUBCANPROTO_CLASS_POLLING_ANALOGSENSOR
+    s_decode_as,        // ICUBCANPROTO_CLASS_PERIODIC_ANALOGSENSOR
+    s_decode_skin,      // ICUBCANPROTO_CLASS_PERIODIC_SKIN
+    s_decode_is,        // ICUBCANPROTO_CLASS_PERIODIC_INERTIALSENSOR
+    NULL,               // ICUBCANPROTO_CLASS_PERIODIC_BATTERY
+    s_decode_command    // ICUBCANPROTO_CLASS_BOOTLOADER
+};
+
+// indexed by the type of the periodic frames
+static const s_typeinfo_t s_mc_types[16] =
+{
+    { s_view_foc,           8 },    // ICUBCANPROTO_PER_MC_MSG__2FOC
+    { s_view_position,      4 },    // ICUBCANPROTO_PER_MC_MSG__POSITION
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__PID_VAL
+    { s_view_status,        1 },    // ICUBCANPROTO_PER_MC_MSG__STATUS
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__CURRENT
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_MC_MSG__OVERFLOW
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_MC_MSG__PRINT
+    { s_view_velocity,      4 },    // ICUBCANPROTO_PER_MC_MSG__VELOCITY
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__PID_ERROR
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__DEBUG
+    { s_view_position,      4 },    // ICUBCANPROTO_PER_MC_MSG__MOTOR_POSITION
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__MOTOR_SPEED
+    { s_view_words,         2 },    // ICUBCANPROTO_PER_MC_MSG__ADDITIONAL_STATUS
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_words,         2 }     // ICUBCANPROTO_PER_MC_MSG__EMSTO2FOC_DESIRED_CURRENT
+};
+
+static const s_typeinfo_t s_as_types[16] =
+{
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_AS_MSG__USERDEF
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_AS_MSG__POS
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_raw,           0 },
+    { s_view_vector,        6 },    // ICUBCANPROTO_PER_AS_MSG__UNCALIBFORCE_VECTOR_DEBUGMODE
+    { s_view_vector,        6 },    // ICUBCANPROTO_PER_AS_MSG__UNCALIBTORQUE_VECTOR_DEBUGMODE
+    { s_view_vector,        6 },    // ICUBCANPROTO_PER_AS_MSG__FORCE_VECTOR
+    { s_view_vector,        6 },    // ICUBCANPROTO_PER_AS_MSG__TORQUE_VECTOR
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_AS_MSG__HES0TO6
+    { s_view_raw,           0 },    // ICUBCANPROTO_PER_AS_MSG__HES7TO14
+    { s_view_thermometer,   3 },    // ICUBCANPROTO_PER_AS_MSG__THERMOMETER_MEASURE
+    { s_view_raw,           0 }
+};
+
+static const s_typeinfo_t s_is_types[16] =
+{
+    { s_view_xyz,           6 },    // ICUBCANPROTO_PER_IS_MSG__DIGITAL_GYROSCOPE
+    { s_view_xyz,           6 },    // ICUBCANPROTO_PER_IS_MSG__DIGITAL_ACCELEROMETER
+    { s_view_xyz,           6 },    // ICUBCANPROTO_PER_IS_MSG__ANALOG_ACCELEROMETER
+    { s_view_triple,        8 },    // ICUBCANPROTO_PER_IS_MSG__IMU_TRIPLE
+    { s_view_quaternion,    8 },    // ICUBCANPROTO_PER_IS_MSG__IMU_QUATERNION
+    { s_view_imustatus,     2 },    // ICUBCANPROTO_PER_IS_MSG__IMU_STATUS
+    { s_view_none,          0 }, { s_view_none,          0 }, { s_view_none,          0 }, { s_view_none,          0 },
+    { s_view_none,          0 }, { s_view_none,          0 }, { s_view_none,          0 }, { s_view_none,          0 },
+    { s_view_none,          0 }, { s_view_none,          0 }
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Decode(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    icubCanProto_codec_decoder_fp_t decoder = NULL;
+    icubCanProto_codec_result_t res = icubCanProto_codec_result_unsupported;
+
+    message->cls = ICUBCANPROTO_CODEC_ID2CLASS(frame->id);
+    decoder = s_decoders[message->cls];
+
+    if(frame->size > 8)
+    {
+        res = icubCanProto_codec_result_wrongsize;
+    }
+    else if(NULL != decoder)
+    {
+        res = decoder(frame, message);
+    }
+
+    message->result = (uint8_t)res;
+    return(res);
+}
+
+
+extern uint32_t icubCanProto_codec_DecodeBatch(const icubCanProto_frame_t *frames, uint32_t number, icubCanProto_message_t *messages)
+{
+    uint32_t decoded = 0;
+    uint32_t i = 0;
+
+    for(i=0; i<number; i++)
+    {
+        if(icubCanProto_codec_result_ok == icubCanProto_codec_Decode(&frames[i], &messages[i]))
+        {
+            decoded++;
+        }
+    }
+
+    return(decoded);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Command_Decode(const icubCanProto_frame_t *frame, icubCanProto_command_t *command)
+{
+    uint8_t cls = ICUBCANPROTO_CODEC_ID2CLASS(frame->id);
+
+    if((ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL != cls) && (ICUBCANPROTO_CLASS_POLLING_ANALOGSENSOR != cls) && (ICUBCANPROTO_CLASS_BOOTLOADER != cls))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    if((frame->size < 1) || (frame->size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    command->source = ICUBCANPROTO_CODEC_ID2SOURCE(frame->id);
+    command->destination = ICUBCANPROTO_CODEC_ID2DESTINATION(frame->id);
+    if(ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL == cls)
+    {
+        command->command = frame->data[0] & 0x7f;
+        command->axis = frame->data[0] >> 7;
+    }
+    else
+    {
+        command->command = frame->data[0];
+        command->axis = 0;
+    }
+    command->numargs = frame->size - 1;
+    memcpy(command->args, &frame->data[1], sizeof(command->args));
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Command_Encode(uint8_t cls, const icubCanProto_command_t *command, icubCanProto_frame_t *frame)
+{
+    if((ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL != cls) && (ICUBCANPROTO_CLASS_POLLING_ANALOGSENSOR != cls) && (ICUBCANPROTO_CLASS_BOOTLOADER != cls))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    if(command->numargs > sizeof(command->args))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(cls, command->source, command->destination), 1 + command->numargs);
+    if(ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL == cls)
+    {
+        frame->data[0] = ICUBCANPROTO_CODEC_MC_AXIS2BYTE(command->axis) | (command->command & 0x7f);
+    }
+    else
+    {
+        frame->data[0] = command->command;
+    }
+    memcpy(&frame->data[1], command->args, command->numargs);
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_MCperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_mc_periodic_t *mc)
+{
+    const uint8_t *data = frame->data;
+    s_typeinfo_t info = {0};
+
+    if(ICUBCANPROTO_CLASS_PERIODIC_MOTORCONTROL != ICUBCANPROTO_CODEC_ID2CLASS(frame->id))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    mc->source = ICUBCANPROTO_CODEC_ID2SOURCE(frame->id);
+    mc->type = ICUBCANPROTO_CODEC_ID2DESTINATION(frame->id);
+    mc->size = frame->size;
+    info = s_mc_types[mc->type];
+
+    if((frame->size < info.minsize) || (frame->size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    switch(info.view)
+    {
+        case s_view_position:
+        {
+            mc->number = frame->size / 4;
+            mc->value.position[0] = s_get32(&data[0]);
+            mc->value.position[1] = (2 == mc->number) ? s_get32(&data[4]) : 0;
+        } break;
+
+        case s_view_velocity:
+        {
+            mc->number = frame->size / 4;
+            mc->value.velocity[0].velocity = s_get16(&data[0]);
+            mc->value.velocity[0].acceleration = s_get16(&data[2]);
+            mc->value.velocity[1].velocity = (2 == mc->number) ? s_get16(&data[4]) : 0;
+            mc->value.velocity[1].acceleration = (2 == mc->number) ? s_get16(&data[6]) : 0;
+        } break;
+
+        case s_view_foc:
+        {
+            mc->number = 1;
+            mc->value.foc.current = s_get16(&data[0]);
+            mc->value.foc.velocity = s_get16(&data[2]);
+            mc->value.foc.position = s_get32(&data[4]);
+        } break;
+
+        case s_view_status:
+        {   // the legacy boards send fewer bytes: the missing ones are zero
+            uint8_t padded[8] = {0};
+            memcpy(padded, data, frame->size);
+            mc->number = 1;
+            mc->value.status.controlmode = padded[0];
+            mc->value.status.quadencoderstate = padded[1];
+            mc->value.status.pwmfeedback = s_get16(&padded[2]);
+            mc->value.status.motorfaultstate = (uint32_t)s_get32(&padded[4]);
+        } break;
+
+        case s_view_words:
+        {
+            uint8_t i = 0;
+            mc->number = frame->size / 2;
+            for(i=0; i<4; i++)
+            {
+                mc->value.words[i] = (i < mc->number) ? s_get16(&data[2*i]) : 0;
+            }
+        } break;
+
+        default:
+        {
+            mc->number = frame->size;
+            memcpy(mc->value.raw, data, sizeof(mc->value.raw));
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_MCperiodic_Encode(const icubCanProto_mc_periodic_t *mc, icubCanProto_frame_t *frame)
+{
+    uint8_t *data = frame->data;
+    uint8_t size = 0;
+    uint8_t i = 0;
+
+    if(mc->type > 15)
+    {
+        return(icubCanProto_codec_result_unsupported);
+    }
+
+    switch(s_mc_types[mc->type].view)
+    {
+        case s_view_position:
+        case s_view_velocity:   size = 4 * mc->number;      break;
+        case s_view_foc:
+        case s_view_status:     size = 8;                   break;
+        case s_view_words:      size = 2 * mc->number;      break;
+        default:                size = mc->size;            break;
+    }
+
+    if((size < s_mc_types[mc->type].minsize) || (size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_PERIODIC_MOTORCONTROL, mc->source, mc->type), size);
+
+    switch(s_mc_types[mc->type].view)
+    {
+        case s_view_position:
+        {
+            for(i=0; i<mc->number; i++)
+            {
+                s_put32(&data[4*i], mc->value.position[i]);
+            }
+        } break;
+
+        case s_view_velocity:
+        {
+            for(i=0; i<mc->number; i++)
+            {
+                s_put16(&data[4*i], mc->value.velocity[i].velocity);
+                s_put16(&data[4*i+2], mc->value.velocity[i].acceleration);
+            }
+        } break;
+
+        case s_view_foc:
+        {
+            s_put16(&data[0], mc->value.foc.current);
+            s_put16(&data[2], mc->value.foc.velocity);
+            s_put32(&data[4], mc->value.foc.position);
+        } break;
+
+        case s_view_status:
+        {
+            data[0] = mc->value.status.controlmode;
+            data[1] = mc->value.status.quadencoderstate;
+            s_put16(&data[2], mc->value.status.pwmfeedback);
+            s_put32(&data[4], (int32_t)mc->value.status.motorfaultstate);
+        } break;
+
+        case s_view_words:
+        {
+            for(i=0; i<mc->number; i++)
+            {
+                s_put16(&data[2*i], mc->value.words[i]);
+            }
+        } break;
+
+        default:
+        {
+            memcpy(data, mc->value.raw, size);
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ASperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_as_periodic_t *as)
+{
+    const uint8_t *data = frame->data;
+    s_typeinfo_t info = {0};
+
+    if(ICUBCANPROTO_CLASS_PERIODIC_ANALOGSENSOR != ICUBCANPROTO_CODEC_ID2CLASS(frame->id))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    as->source = ICUBCANPROTO_CODEC_ID2SOURCE(frame->id);
+    as->type = ICUBCANPROTO_CODEC_ID2DESTINATION(frame->id);
+    as->size = frame->size;
+    info = s_as_types[as->type];
+
+    if((frame->size < info.minsize) || (frame->size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    switch(info.view)
+    {
+        case s_view_vector:
+        {
+            as->number = 3;
+            as->value.vector.values[0] = (uint16_t)s_get16(&data[0]);
+            as->value.vector.values[1] = (uint16_t)s_get16(&data[2]);
+            as->value.vector.values[2] = (uint16_t)s_get16(&data[4]);
+            as->value.vector.hassaturation = (frame->size > 6) ? 1 : 0;
+            as->value.vector.saturation = (frame->size > 6) ? data[6] : 0;
+        } break;
+
+        case s_view_thermometer:
+        {
+            as->number = 1;
+            as->value.thermometer.mask = data[0];
+            as->value.thermometer.filler = 0;
+            as->value.thermometer.temperature = s_get16(&data[1]);
+        } break;
+
+        default:
+        {
+            as->number = frame->size;
+            memcpy(as->value.raw, data, sizeof(as->value.raw));
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ASperiodic_Encode(const icubCanProto_as_periodic_t *as, icubCanProto_frame_t *frame)
+{
+    uint8_t *data = frame->data;
+    uint8_t size = 0;
+
+    if(as->type > 15)
+    {
+        return(icubCanProto_codec_result_unsupported);
+    }
+
+    switch(s_as_types[as->type].view)
+    {
+        case s_view_vector:         size = (0 != as->value.vector.hassaturation) ? 7 : 6;   break;
+        case s_view_thermometer:    size = 3;                                               break;
+        default:                    size = as->size;                                        break;
+    }
+
+    if(size > 8)
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_PERIODIC_ANALOGSENSOR, as->source, as->type), size);
+
+    switch(s_as_types[as->type].view)
+    {
+        case s_view_vector:
+        {
+            s_put16(&data[0], (int16_t)as->value.vector.values[0]);
+            s_put16(&data[2], (int16_t)as->value.vector.values[1]);
+            s_put16(&data[4], (int16_t)as->value.vector.values[2]);
+            data[6] = (7 == size) ? as->value.vector.saturation : 0;
+        } break;
+
+        case s_view_thermometer:
+        {
+            data[0] = as->value.thermometer.mask;
+            s_put16(&data[1], as->value.thermometer.temperature);
+        } break;
+
+        default:
+        {
+            memcpy(data, as->value.raw, size);
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Skin_Decode(const icubCanProto_frame_t *frame, icubCanProto_skin_periodic_t *skin)
+{
+    if(ICUBCANPROTO_CLASS_PERIODIC_SKIN != ICUBCANPROTO_CODEC_ID2CLASS(frame->id))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    if((frame->size < 1) || (frame->size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    skin->source = ICUBCANPROTO_CODEC_ID2SOURCE(frame->id);
+    skin->triangle = ICUBCANPROTO_CODEC_ID2DESTINATION(frame->id);
+    skin->info = frame->data[0];
+    skin->second = frame->data[0] >> 7;
+    skin->first = (0 == skin->second) ? 0 : 7;
+    skin->number = (0 == skin->second) ? 7 : (ICUBCANPROTO_CODEC_SKIN_TAXELS - 7);
+
+    if(frame->size < (1 + skin->number))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    memcpy(skin->taxels, &frame->data[1], sizeof(skin->taxels));
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Skin_Encode(const icubCanProto_skin_periodic_t *skin, icubCanProto_frame_t *frame)
+{
+    uint8_t number = (0 == skin->second) ? 7 : (ICUBCANPROTO_CODEC_SKIN_TAXELS - 7);
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_PERIODIC_SKIN, skin->source, skin->triangle), 1 + number);
+    frame->data[0] = (skin->info & 0x7f) | ((0 == skin->second) ? 0x00 : 0x80);
+    memcpy(&frame->data[1], skin->taxels, number);
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ISperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_is_periodic_t *is)
+{
+    const uint8_t *data = frame->data;
+    s_typeinfo_t info = {0};
+
+    if(ICUBCANPROTO_CLASS_PERIODIC_INERTIALSENSOR != ICUBCANPROTO_CODEC_ID2CLASS(frame->id))
+    {
+        return(icubCanProto_codec_result_wrongclass);
+    }
+
+    is->source = ICUBCANPROTO_CODEC_ID2SOURCE(frame->id);
+    is->type = ICUBCANPROTO_CODEC_ID2DESTINATION(frame->id);
+    is->size = frame->size;
+    info = s_is_types[is->type];
+
+    if(s_view_none == info.view)
+    {
+        return(icubCanProto_codec_result_unsupported);
+    }
+
+    if((frame->size < info.minsize) || (frame->size > 8))
+    {
+        return(icubCanProto_codec_result_wrongsize);
+    }
+
+    is->values[3] = 0;
+
+    switch(info.view)
+    {
+        case s_view_xyz:
+        {
+            is->number = 3;
+            is->sequence = 0;
+            is->sensor = 0;
+            is->values[0] = s_get16(&data[0]);
+            is->values[1] = s_get16(&data[2]);
+            is->values[2] = s_get16(&data[4]);
+        } break;
+
+        case s_view_triple:
+        {
+            is->number = 3;
+            is->sequence = data[0];
+            is->sensor = data[1];
+            is->values[0] = s_get16(&data[2]);
+            is->values[1] = s_get16(&data[4]);
+            is->values[2] = s_get16(&data[6]);
+        } break;
+
+        case s_view_quaternion:
+        {
+            is->number = 4;
+            is->sequence = 0;
+            is->sensor = 0;
+            is->values[0] = s_get16(&data[0]);
+            is->values[1] = s_get16(&data[2]);
+            is->values[2] = s_get16(&data[4]);
+            is->values[3] = s_get16(&data[6]);
+        } break;
+
+        default:
+        {   // s_view_imustatus
+            is->number = 0;
+            is->sequence = data[0];
+            is->sensor = data[1];
+            is->values[0] = is->values[1] = is->values[2] = 0;
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ISperiodic_Encode(const icubCanProto_is_periodic_t *is, icubCanProto_frame_t *frame)
+{
+    uint8_t *data = frame->data;
+    uint8_t view = (is->type > 15) ? s_view_none : s_is_types[is->type].view;
+
+    if(s_view_none == view)
+    {
+        return(icubCanProto_codec_result_unsupported);
+    }
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_PERIODIC_INERTIALSENSOR, is->source, is->type), s_is_types[is->type].minsize);
+
+    switch(view)
+    {
+        case s_view_xyz:
+        {
+            s_put16(&data[0], is->values[0]);
+            s_put16(&data[2], is->values[1]);
+            s_put16(&data[4], is->values[2]);
+        } break;
+
+        case s_view_triple:
+        {
+            data[0] = is->sequence;
+            data[1] = is->sensor;
+            s_put16(&data[2], is->values[0]);
+            s_put16(&data[4], is->values[1]);
+            s_put16(&data[6], is->values[2]);
+        } break;
+
+        case s_view_quaternion:
+        {
+            s_put16(&data[0], is->values[0]);
+            s_put16(&data[2], is->values[1]);
+            s_put16(&data[4], is->values[2]);
+            s_put16(&data[6], is->values[3]);
+        } break;
+
+        default:
+        {
+            data[0] = is->sequence;
+            data[1] = is->sensor;
+        } break;
+    }
+
+    return(icubCanProto_codec_result_ok);
+}
+
+
+extern void icubCanProto_codec_MC_SetControlMode_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_controlmode_t mode, icubCanProto_frame_t *frame)
+{
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL, source, destination), 2);
+    frame->data[0] = ICUBCANPROTO_CODEC_MC_AXIS2BYTE(axis) | ICUBCANPROTO_POL_MC_CMD__SET_CONTROL_MODE;
+    frame->data[1] = (uint8_t)mode;
+}
+
+
+extern void icubCanProto_codec_MC_PositionMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_position_t position, icubCanProto_velocity_t velocity, icubCanProto_frame_t *frame)
+{
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL, source, destination), 7);
+    frame->data[0] = ICUBCANPROTO_CODEC_MC_AXIS2BYTE(axis) | ICUBCANPROTO_POL_MC_CMD__POSITION_MOVE;
+    s_put32(&frame->data[1], position);
+    s_put16(&frame->data[5], velocity);
+}
+
+
+extern void icubCanProto_codec_MC_VelocityMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_velocity_t velocity, icubCanProto_acceleration_t acceleration, icubCanProto_frame_t *frame)
+{
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL, source, destination), 5);
+    frame->data[0] = ICUBCANPROTO_CODEC_MC_AXIS2BYTE(axis) | ICUBCANPROTO_POL_MC_CMD__VELOCITY_MOVE;
+    s_put16(&frame->data[1], velocity);
+    s_put16(&frame->data[3], acceleration);
+}
+
+
+extern void icubCanProto_codec_MC_DesiredCurrents_Encode(uint8_t source, const icubCanProto_current_t currents[4], icubCanProto_frame_t *frame)
+{
+    uint8_t i = 0;
+
+    s_frame_init(frame, ICUBCANPROTO_CODEC_ID(ICUBCANPROTO_CLASS_PERIODIC_MOTORCONTROL, source, ICUBCANPROTO_PER_MC_MSG__EMSTO2FOC_DESIRED_CURRENT), 8);
+    for(i=0; i<4; i++)
+    {
+        s_put16(&frame->data[2*i], currents[i]);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static icubCanProto_codec_result_t s_decode_command(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    return(icubCanProto_codec_Command_Decode(frame, &message->content.command));
+}
+
+
+static icubCanProto_codec_result_t s_decode_mc(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    return(icubCanProto_codec_MCperiodic_Decode(frame, &message->content.mc));
+}
+
+
+static icubCanProto_codec_result_t s_decode_as(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    return(icubCanProto_codec_ASperiodic_Decode(frame, &message->content.as));
+}
+
+
+static icubCanProto_codec_result_t s_decode_skin(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    return(icubCanProto_codec_Skin_Decode(frame, &message->content.skin));
+}
+
+
+static icubCanProto_codec_result_t s_decode_is(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+{
+    return(icubCanProto_codec_ISperiodic_Decode(frame, &message->content.is));
+}
+
+
+static void s_frame_init(icubCanProto_frame_t *frame, uint32_t id, uint8_t size)
+{
+    frame->id = id;
+    frame->id_type = 0;     // standard 11 bits
+    frame->frame_type = 0;  // data
+    frame->size = size;
+    frame->unused = 0;
+    memset(frame->data, 0, sizeof(frame->data));
+}
+
+
+// the payload is little endian. the byte by byte form is folded into a single load or store by the compilers
+// which target a little endian cpu, and it does not require the data to be aligned.
+
+static int16_t s_get16(const uint8_t *data)
+{
+    return((int16_t)((uint16_t)data[0] | ((uint16_t)data[1] << 8)));
+}
+
+
+static int32_t s_get32(const uint8_t *data)
+{
+    return((int32_t)((uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24)));
+}
+
+
+static void s_put16(uint8_t *data, int16_t value)
+{
+    data[0] = (uint8_t)((uint16_t)value & 0xff);
+    data[1] = (uint8_t)((uint16_t)value >> 8);
+}
+
+
+static void s_put32(uint8_t *data, int32_t value)
+{
+    data[0] = (uint8_t)((uint32_t)value & 0xff);
+    data[1] = (uint8_t)(((uint32_t)value >> 8) & 0xff);
+    data[2] = (uint8_t)(((uint32_t)value >> 16) & 0xff);
+    data[3] = (uint8_t)((uint32_t)value >> 24);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+
+#ifndef _ICUBCANPROTO_CODEC_H_
+#define _ICUBCANPROTO_CODEC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       iCubCanProto_codec.h
+    @brief      This header file gives typed encoders and decoders of the iCub CAN protocol messages.
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+    @ingroup    iCubCanProtocol
+**/
+
+/** @ingroup    iCubCanProtocol
+    @{
+ **/
+
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "stdint.h"
+#include "iCubCanProtocol.h"
+#include "iCubCanProto_types.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+// the 11 bits id is [class:3 | source:4 | destination:4] for the polling classes and the bootloader,
+// and it is [class:3 | source:4 | type:4] for the periodic classes. the skin uses the type as triangle number.
+#define ICUBCANPROTO_CODEC_ID(cls, src, dst)        ((((uint32_t)(cls) & 0x7) << 8) | (((uint32_t)(src) & 0xf) << 4) | ((uint32_t)(dst) & 0xf))
+#define ICUBCANPROTO_CODEC_ID2CLASS(id)             ((uint8_t)(((id) >> 8) & 0x7))
+#define ICUBCANPROTO_CODEC_ID2SOURCE(id)            ((uint8_t)(((id) >> 4) & 0xf))
+#define ICUBCANPROTO_CODEC_ID2DESTINATION(id)       ((uint8_t)((id) & 0xf))
+
+// in the polling motor control class the first byte of payload is [axis:1 | command:7]
+#define ICUBCANPROTO_CODEC_MC_AXIS2BYTE(axis)       ((uint8_t)(((axis) & 0x1) << 7))
+
+#define ICUBCANPROTO_CODEC_SKIN_TAXELS              12
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+/** @typedef    typedef struct icubCanProto_frame_t
+    @brief      a raw can frame. it has the same layout of eOcanframe_t of embobj, so that one can be cast into the other.
+ **/
+typedef struct              // size is 16 bytes
+{
+    uint32_t                id;             /**< can frame id    */
+    uint8_t                 id_type;        /**< can frame id format */
+    uint8_t                 frame_type;     /**< frame type */
+    uint8_t                 size;           /**< data size */
+    uint8_t                 unused;         /**< filler */
+    uint8_t                 data[8];        /**< the data (payload) */
+} icubCanProto_frame_t;
+
+
+/** @typedef    typedef enum icubCanProto_codec_result_t
+    @brief      the results of the encoders and decoders.
+ **/
+typedef enum
+{
+    icubCanProto_codec_result_ok            = 0,
+    icubCanProto_codec_result_wrongclass    = 1,    /**< the frame or the message are not of the expected class */
+    icubCanProto_codec_result_wrongsize     = 2,    /**< the payload is too short for its type */
+    icubCanProto_codec_result_unsupported   = 3     /**< the class or the type has no codec */
+} icubCanProto_codec_result_t;
+
+
+/** @typedef    typedef struct icubCanProto_command_t
+    @brief      a message of the polling classes (motor control, analog sensor, inertial sensor) and of the bootloader.
+                the axis is used only by the motor control class. the args are the payload after the command byte.
+ **/
+typedef struct
+{
+    uint8_t                 source;
+    uint8_t                 destination;
+    uint8_t                 command;
+    uint8_t                 axis;
+    uint8_t                 numargs;
+    uint8_t                 args[7];
+} icubCanProto_command_t;
+
+
+/** @typedef    typedef struct icubCanProto_mc_periodic_t
+    @brief      a message of class ICUBCANPROTO_CLASS_PERIODIC_MOTORCONTROL. the view to use depends on the type:
+                - position: ICUBCANPROTO_PER_MC_MSG__POSITION, ICUBCANPROTO_PER_MC_MSG__MOTOR_POSITION
+                - velocity: ICUBCANPROTO_PER_MC_MSG__VELOCITY
+                - foc:      ICUBCANPROTO_PER_MC_MSG__2FOC
+                - status:   ICUBCANPROTO_PER_MC_MSG__STATUS
+                - words:    ICUBCANPROTO_PER_MC_MSG__PID_VAL, __CURRENT, __PID_ERROR, __MOTOR_SPEED, __DEBUG,
+                            __ADDITIONAL_STATUS, __EMSTO2FOC_DESIRED_CURRENT
+                - raw:      all the others
+                the number tells how many values (or axes) the payload carries.
+ **/
+typedef struct
+{
+    uint8_t                 source;
+    uint8_t                 type;
+    uint8_t                 size;
+    uint8_t                 number;
+    union
+    {
+        int32_t             position[2];
+        struct
+        {
+            int16_t         velocity;
+            int16_t         acceleration;
+        }                   velocity[2];
+        struct
+        {
+            int16_t         current;
+            int16_t         velocity;
+            int32_t         position;
+        }                   foc;
+        struct
+        {
+            uint8_t         controlmode;
+            uint8_t         quadencoderstate;
+            int16_t         pwmfeedback;
+            uint32_t        motorfaultstate;
+        }                   status;
+        int16_t             words[4];
+        uint8_t             raw[8];
+    } value;
+} icubCanProto_mc_periodic_t;
+
+
+/** @typedef    typedef struct icubCanProto_as_periodic_t
+    @brief      a message of class ICUBCANPROTO_CLASS_PERIODIC_ANALOGSENSOR. the view to use depends on the type:
+                - vector:       ICUBCANPROTO_PER_AS_MSG__FORCE_VECTOR, __TORQUE_VECTOR and their __DEBUGMODE versions.
+                                the saturation is valid only if the payload has the seventh byte.
+                - thermometer:  ICUBCANPROTO_PER_AS_MSG__THERMOMETER_MEASURE. temperature is in 0.1 Celsius degrees
+                - raw:          all the others
+ **/
+typedef struct
+{
+    uint8_t                 source;
+    uint8_t                 type;
+    uint8_t                 size;
+    uint8_t                 number;
+    union
+    {
+        struct
+        {
+            uint16_t        values[3];
+            uint8_t         saturation;     // use icubCanProto_strain_saturationInfo_t
+            uint8_t         hassaturation;
+        }                   vector;
+        struct
+        {
+            uint8_t         mask;
+            uint8_t         filler;
+            int16_t         temperature;
+        }                   thermometer;
+        uint8_t             raw[8];
+    } value;
+} icubCanProto_as_periodic_t;
+
+
+/** @typedef    typedef struct icubCanProto_skin_periodic_t
+    @brief      a message of class ICUBCANPROTO_CLASS_PERIODIC_SKIN. a triangle of 12 taxels is sent in two frames:
+                the first has the bit 7 of info cleared and carries taxels [0, 6], the second has it set and carries
+                taxels [7, 11]. the taxels are as on the bus: 255 means no pressure.
+ **/
+typedef struct
+{
+    uint8_t                 source;
+    uint8_t                 triangle;
+    uint8_t                 info;
+    uint8_t                 second;
+    uint8_t                 first;          // index of taxels[0] inside the triangle
+    uint8_t                 number;
+    uint8_t                 taxels[7];
+} icubCanProto_skin_periodic_t;
+
+
+/** @typedef    typedef struct icubCanProto_is_periodic_t
+    @brief      a message of class ICUBCANPROTO_CLASS_PERIODIC_INERTIALSENSOR. the values are:
+                - x, y, z:      ICUBCANPROTO_PER_IS_MSG__DIGITAL_GYROSCOPE, __DIGITAL_ACCELEROMETER, __ANALOG_ACCELEROMETER
+                - x, y, z:      ICUBCANPROTO_PER_IS_MSG__IMU_TRIPLE, which also has sequence and sensor (icubCanProto_imu_sensor_t)
+                - w, x, y, z:   ICUBCANPROTO_PER_IS_MSG__IMU_QUATERNION
+                - none:         ICUBCANPROTO_PER_IS_MSG__IMU_STATUS, which has sequence and the calibration status in sensor
+ **/
+typedef struct
+{
+    uint8_t                 source;
+    uint8_t                 type;
+    uint8_t                 size;
+    uint8_t                 number;
+    uint8_t                 sequence;
+    uint8_t                 sensor;
+    int16_t                 values[4];
+} icubCanProto_is_periodic_t;
+
+
+/** @typedef    typedef struct icubCanProto_message_t
+    @brief      a decoded frame of any class. use the member of content which matches cls.
+ **/
+typedef struct
+{
+    uint8_t                 cls;            /**< use ICUBCANPROTO_CLASS_* */
+    uint8_t                 result;         /**< use icubCanProto_codec_result_t */
+    uint8_t                 filler[2];
+    union
+    {
+        icubCanProto_command_t          command;
+        icubCanProto_mc_periodic_t      mc;
+        icubCanProto_as_periodic_t      as;
+        icubCanProto_skin_periodic_t    skin;
+        icubCanProto_is_periodic_t      is;
+    } content;
+} icubCanProto_message_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern icubCanProto_codec_result_t icubCanProto_codec_Decode(const icubCanProto_frame_t *frame, icubCanProto_message_t *message)
+    @brief      decodes a frame of any class with the decoder of its class.
+    @param      frame       the frame
+    @param      message     the decoded message. its fields cls and result are always filled.
+    @return     icubCanProto_codec_result_ok or the reason of failure.
+ **/
+extern icubCanProto_codec_result_t icubCanProto_codec_Decode(const icubCanProto_frame_t *frame, icubCanProto_message_t *message);
+
+
+/** @fn         extern uint32_t icubCanProto_codec_DecodeBatch(const icubCanProto_frame_t *frames, uint32_t number, icubCanProto_message_t *messages)
+    @brief      decodes an array of frames in one pass. the i-th message is the decoding of the i-th frame, also when
+                it fails: the field result of each message tells its outcome.
+    @param      frames      the frames
+    @param      number      their number
+    @param      messages    array of number messages
+    @return     the number of frames decoded successfully.
+ **/
+extern uint32_t icubCanProto_codec_DecodeBatch(const icubCanProto_frame_t *frames, uint32_t number, icubCanProto_message_t *messages);
+
+
+// the decoders and the encoders of each class.
+// the polling classes and the bootloader share icubCanProto_command_t: cls is one of ICUBCANPROTO_CLASS_POLLING_MOTORCONTROL,
+// ICUBCANPROTO_CLASS_POLLING_ANALOGSENSOR, ICUBCANPROTO_CLASS_BOOTLOADER. the inertial sensor has no polling commands
+// and uses ICUBCANPROTO_CLASS_POLLING_ANALOGSENSOR.
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Command_Decode(const icubCanProto_frame_t *frame, icubCanProto_command_t *command);
+extern icubCanProto_codec_result_t icubCanProto_codec_Command_Encode(uint8_t cls, const icubCanProto_command_t *command, icubCanProto_frame_t *frame);
+
+extern icubCanProto_codec_result_t icubCanProto_codec_MCperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_mc_periodic_t *mc);
+extern icubCanProto_codec_result_t icubCanProto_codec_MCperiodic_Encode(const icubCanProto_mc_periodic_t *mc, icubCanProto_frame_t *frame);
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ASperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_as_periodic_t *as);
+extern icubCanProto_codec_result_t icubCanProto_codec_ASperiodic_Encode(const icubCanProto_as_periodic_t *as, icubCanProto_frame_t *frame);
+
+extern icubCanProto_codec_result_t icubCanProto_codec_Skin_Decode(const icubCanProto_frame_t *frame, icubCanProto_skin_periodic_t *skin);
+extern icubCanProto_codec_result_t icubCanProto_codec_Skin_Encode(const icubCanProto_skin_periodic_t *skin, icubCanProto_frame_t *frame);
+
+extern icubCanProto_codec_result_t icubCanProto_codec_ISperiodic_Decode(const icubCanProto_frame_t *frame, icubCanProto_is_periodic_t *is);
+extern icubCanProto_codec_result_t icubCanProto_codec_ISperiodic_Encode(const icubCanProto_is_periodic_t *is, icubCanProto_frame_t *frame);
+
+
+// helpers for the most used motor control commands
+
+/** @fn         extern void icubCanProto_codec_MC_SetControlMode_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_controlmode_t mode, icubCanProto_frame_t *frame)
+    @brief      fills frame with ICUBCANPROTO_POL_MC_CMD__SET_CONTROL_MODE.
+ **/
+extern void icubCanProto_codec_MC_SetControlMode_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_controlmode_t mode, icubCanProto_frame_t *frame);
+
+/** @fn         extern void icubCanProto_codec_MC_PositionMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_position_t position, icubCanProto_velocity_t velocity, icubCanProto_frame_t *frame)
+    @brief      fills frame with ICUBCANPROTO_POL_MC_CMD__POSITION_MOVE.
+ **/
+extern void icubCanProto_codec_MC_PositionMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_position_t position, icubCanProto_velocity_t velocity, icubCanProto_frame_t *frame);
+
+/** @fn         extern void icubCanProto_codec_MC_VelocityMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_velocity_t velocity, icubCanProto_acceleration_t acceleration, icubCanProto_frame_t *frame)
+    @brief      fills frame with ICUBCANPROTO_POL_MC_CMD__VELOCITY_MOVE.
+ **/
+extern void icubCanProto_codec_MC_VelocityMove_Encode(uint8_t source, uint8_t destination, uint8_t axis, icubCanProto_velocity_t velocity, icubCanProto_acceleration_t acceleration, icubCanProto_frame_t *frame);
+
+/** @fn         extern void icubCanProto_codec_MC_DesiredCurrents_Encode(uint8_t source, const icubCanProto_current_t currents[4], icubCanProto_frame_t *frame)
+    @brief      fills frame with the periodic ICUBCANPROTO_PER_MC_MSG__EMSTO2FOC_DESIRED_CURRENT of four motors.
+ **/
+extern void icubCanProto_codec_MC_DesiredCurrents_Encode(uint8_t source, const icubCanProto_current_t currents[4], icubCanProto_frame_t *frame);
+
+
+/** @} **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -0,0 +1,461 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - public interface
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "embot_core_utils_MappedStorage.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EMBOT_CORE_UTILS_MAPPEDSTORAGE_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - pimpl: private implementation (see scott meyers: item 22 of effective modern c++, item 31 of effective c++
+// --------------------------------------------------------------------------------------------------------------------
+
+struct embot::core::utils::MappedStorage::Impl
+{
+    static constexpr std::uint32_t nopage {0xffffffff};
+
+    struct CachedPage
+    {
+        std::uint32_t page {nopage};
+        std::uint64_t lastuse {0};
+        bool modified {false};
+        std::vector<std::uint8_t> data {};
+    };
+
+    Config config {};
+    bool initted {false};
+
+    int fd {-1};
+    std::uint8_t *mem {nullptr};
+    std::uint32_t numberofpages {0};
+    std::vector<std::uint32_t> erasecounts {};
+    std::vector<bool> dirty {};                 // pages of the map not yet synced to the file
+    std::vector<CachedPage> cache {};
+    std::vector<std::uint32_t> page2slot {};    // the slot of the cache which holds the page, or nopage
+    std::uint64_t usecounter {0};
+    Stats stats {};
+
+
+    Impl() = default;
+
+    ~Impl()
+    {
+        deinit();
+    }
+
+    bool init(const Config &c)
+    {
+        if(initted || !c.isvalid())
+        {
+            return false;
+        }
+
+        config = c;
+        numberofpages = config.size / config.pagesize;
+
+#if defined(EMBOT_CORE_UTILS_MAPPEDSTORAGE_POSIX)
+
+        fd = ::open(config.filename.c_str(), O_RDWR | O_CREAT, 0644);
+        if(fd < 0)
+        {
+            return false;
+        }
+
+        struct stat st {};
+        if((0 != ::fstat(fd, &st)) || (0 != ::ftruncate(fd, config.size)))
+        {
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+
+        void *m = ::mmap(nullptr, config.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(MAP_FAILED == m)
+        {
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+        mem = static_cast<std::uint8_t*>(m);
+
+        erasecounts.assign(numberofpages, 0);
+        dirty.assign(numberofpages, false);
+        page2slot.assign(numberofpages, nopage);
+        cache.resize(config.cachepages);
+        for(auto &s : cache)
+        {
+            s.data.resize(config.pagesize);
+        }
+        usecounter = 0;
+        stats = {};
+
+        // the bytes which the file did not have are erased, as a new flash
+        std::uint32_t oldsize = (st.st_size < static_cast<off_t>(config.size)) ? static_cast<std::uint32_t>(st.st_size) : config.size;
+        if(oldsize < config.size)
+        {
+            std::memset(mem + oldsize, 0xff, config.size - oldsize);
+            for(std::uint32_t p = oldsize / config.pagesize; p < numberofpages; p++)
+            {
+                dirty[p] = true;
+            }
+        }
+
+        initted = true;
+        return true;
+
+#else
+        return false;
+#endif
+    }
+
+    bool deinit()
+    {
+        if(!initted)
+        {
+            return false;
+        }
+
+        flush();
+
+#if defined(EMBOT_CORE_UTILS_MAPPEDSTORAGE_POSIX)
+        ::munmap(mem, config.size);
+        ::close(fd);
+#endif
+
+        mem = nullptr;
+        fd = -1;
+        cache.clear();
+        page2slot.clear();
+        dirty.clear();
+        erasecounts.clear();
+        initted = false;
+        return true;
+    }
+
+    bool isvalid(std::uint32_t address, std::uint32_t size) const
+    {
+        return initted && (address >= config.baseaddress) && (0 != size) &&
+               ((static_cast<std::uint64_t>(address) + size) <= (static_cast<std::uint64_t>(config.baseaddress) + config.size));
+    }
+
+    void wait(embot::core::relTime latency)
+    {
+        if(0 != latency)
+        {
+            stats.latency += latency;
+            std::this_thread::sleep_for(std::chrono::microseconds(latency));
+        }
+    }
+
+    void program(std::uint32_t page)
+    {
+        dirty[page] = true;
+        stats.programs++;
+        wait(config.pageprogramlatency);
+    }
+
+    void writeback(CachedPage &slot)
+    {
+        if(slot.modified)
+        {
+            std::memcpy(mem + slot.page * config.pagesize, slot.data.data(), config.pagesize);
+            slot.modified = false;
+            program(slot.page);
+        }
+    }
+
+    CachedPage & cached(std::uint32_t page)
+    {   // it gives the slot of the page, and if it is not in cache it evicts the least recently used
+        std::uint32_t s = page2slot[page];
+        if(nopage != s)
+        {
+            stats.cachehits++;
+        }
+        else
+        {
+            stats.cachemisses++;
+            s = static_cast<std::uint32_t>(std::min_element(cache.begin(), cache.end(), [](const CachedPage &a, const CachedPage &b) { return a.lastuse < b.lastuse; }) - cache.begin());
+            CachedPage &victim = cache[s];
+            if(nopage != victim.page)
+            {
+                writeback(victim);
+                page2slot[victim.page] = nopage;
+            }
+            victim.page = page;
+            std::memcpy(victim.data.data(), mem + page * config.pagesize, config.pagesize);
+            page2slot[page] = s;
+        }
+        cache[s].lastuse = ++usecounter;
+        return cache[s];
+    }
+
+    // it calls f(page, offset inside the page, offset inside the range, size) on every page of the range
+    template<typename F>
+    void forpages(std::uint32_t address, std::uint32_t size, F f)
+    {
+        std::uint32_t offset = address - config.baseaddress;
+        std::uint32_t done = 0;
+        while(done < size)
+        {
+            std::uint32_t page = offset / config.pagesize;
+            std::uint32_t inpage = offset % config.pagesize;
+            std::uint32_t n = std::min(size - done, config.pagesize - inpage);
+            f(page, inpage, done, n);
+            offset += n;
+            done += n;
+        }
+    }
+
+    bool erase(std::uint32_t address, std::uint32_t size)
+    {
+        if(!isvalid(address, size))
+        {
+            return false;
+        }
+
+        forpages(address, size, [this](std::uint32_t page, std::uint32_t inpage, std::uint32_t, std::uint32_t n)
+        {
+            std::memset(mem + page * config.pagesize + inpage, 0xff, n);
+            if(nopage != page2slot[page])
+            {   // the cached copy must stay coherent with the map
+                std::memset(cache[page2slot[page]].data.data() + inpage, 0xff, n);
+            }
+            dirty[page] = true;
+            stats.erases++;
+            stats.maxerasecount = std::max(stats.maxerasecount, ++erasecounts[page]);
+            wait(config.pageeraselatency);
+        });
+
+        return true;
+    }
+
+    bool read(std::uint32_t address, std::uint32_t size, void *data)
+    {
+        if((!isvalid(address, size)) || (nullptr == data))
+        {
+            return false;
+        }
+
+        std::uint8_t *d = static_cast<std::uint8_t*>(data);
+        forpages(address, size, [this, d](std::uint32_t page, std::uint32_t inpage, std::uint32_t done, std::uint32_t n)
+        {
+            const std::uint8_t *src = (nopage != page2slot[page]) ? cache[page2slot[page]].data.data() : (mem + page * config.pagesize);
+            std::memcpy(d + done, src + inpage, n);
+        });
+
+        stats.reads++;
+        return true;
+    }
+
+    bool write(std::uint32_t address, std::uint32_t size, const void *data)
+    {
+        if((!isvalid(address, size)) || (nullptr == data))
+        {
+            return false;
+        }
+
+        const std::uint8_t *s = static_cast<const std::uint8_t*>(data);
+        forpages(address, size, [this, s](std::uint32_t page, std::uint32_t inpage, std::uint32_t done, std::uint32_t n)
+        {
+            if(cache.empty())
+            {
+                std::memcpy(mem + page * config.pagesize + inpage, s + done, n);
+                program(page);
+            }
+            else
+            {
+                CachedPage &slot = cached(page);
+                std::memcpy(slot.data.data() + inpage, s + done, n);
+                slot.modified = true;
+            }
+        });
+
+        stats.writes++;
+        return true;
+    }
+
+    const void * view(std::uint32_t address, std::uint32_t size)
+    {
+        if(!isvalid(address, size))
+        {
+            return nullptr;
+        }
+
+        forpages(address, size, [this](std::uint32_t page, std::uint32_t, std::uint32_t, std::uint32_t)
+        {
+            if(nopage != page2slot[page])
+            {
+                writeback(cache[page2slot[page]]);
+            }
+        });
+
+        return mem + (address - config.baseaddress);
+    }
+
+    bool flush()
+    {
+        if(!initted)
+        {
+            return false;
+        }
+
+        for(auto &slot : cache)
+        {
+            if(nopage != slot.page)
+            {
+                writeback(slot);
+            }
+        }
+
+        bool ok = true;
+
+#if defined(EMBOT_CORE_UTILS_MAPPEDSTORAGE_POSIX)
+        // the consecutive dirty pages are synced together. msync() wants the start aligned to the page of the os
+        const std::uint32_t ospage = static_cast<std::uint32_t>(::sysconf(_SC_PAGESIZE));
+        std::uint32_t p = 0;
+        while(p < numberofpages)
+        {
+            if(!dirty[p])
+            {
+                p++;
+                continue;
+            }
+            std::uint32_t first = p;
+            for(; (p < numberofpages) && dirty[p]; p++)
+            {
+                dirty[p] = false;
+                stats.syncs++;
+            }
+            std::uint32_t from = (first * config.pagesize) / ospage * ospage;
+            std::uint32_t to = p * config.pagesize;
+            if(0 != ::msync(mem + from, to - from, MS_SYNC))
+            {
+                ok = false;
+            }
+        }
+#endif
+
+        return ok;
+    }
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - all the rest
+// --------------------------------------------------------------------------------------------------------------------
+
+
+embot::core::utils::MappedStorage::MappedStorage()
+: pImpl(new Impl)
+{
+}
+
+embot::core::utils::MappedStorage::~MappedStorage()
+{
+    delete pImpl;
+}
+
+bool embot::core::utils::MappedStorage::init(const Config &config)
+{
+    return pImpl->init(config);
+}
+
+bool embot::core::utils::MappedStorage::deinit()
+{
+    return pImpl->deinit();
+}
+
+bool embot::core::utils::MappedStorage::isInitted()
+{
+    return pImpl->initted;
+}
+
+bool embot::core::utils::MappedStorage::isAddressValid(std::uint32_t address)
+{
+    return pImpl->isvalid(address, 1);
+}
+
+std::uint32_t embot::core::utils::MappedStorage::getBaseAddress()
+{
+    return pImpl->config.baseaddress;
+}
+
+std::uint32_t embot::core::utils::MappedStorage::getSize()
+{
+    return pImpl->initted ? pImpl->config.size : 0;
+}
+
+bool embot::core::utils::MappedStorage::fullerase()
+{
+    return pImpl->initted ? pImpl->erase(pImpl->config.baseaddress, pImpl->config.size) : false;
+}
+
+bool embot::core::utils::MappedStorage::erase(std::uint32_t address, std::uint32_t size)
+{
+    return pImpl->erase(address, size);
+}
+
+bool embot::core::utils::MappedStorage::read(std::uint32_t address, std::uint32_t size, void *data)
+{
+    return pImpl->read(address, size, data);
+}
+
+bool embot::core::utils::MappedStorage::write(std::uint32_t address, std::uint32_t size, const void *data)
+{
+    return pImpl->write(address, size, data);
+}
+
+const void * embot::core::utils::MappedStorage::view(std::uint32_t address, std::uint32_t size)
+{
+    return pImpl->view(address, size);
+}
+
+bool embot::core::utils::MappedStorage::flush()
+{
+    return pImpl->flush();
+}
+
+const embot::core::utils::MappedStorage::Stats & embot::core::utils::MappedStorage::stats() const
+{
+    return pImpl->stats;
+}
+
+std::uint32_t embot::core::utils::MappedStorage::erasecount(std::uint32_t page) const
+{
+    return (page < pImpl->erasecounts.size()) ? pImpl->erasecounts[page] : 0;
+}
+
+void embot::core::utils::MappedStorage::resetstats()
+{
+    std::uint32_t maxerasecount = pImpl->stats.maxerasecount;
+    pImpl->stats = {};
+    pImpl->stats.maxerasecount = maxerasecount;
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
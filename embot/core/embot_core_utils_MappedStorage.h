@@ -0,0 +1,111 @@
+
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+
+#ifndef _EMBOT_CORE_UTILS_MAPPEDSTORAGE_H_
+#define _EMBOT_CORE_UTILS_MAPPEDSTORAGE_H_
+
+#include "embot_core.h"
+#include "embot_core_utils.h"
+#include <string>
+
+
+namespace embot { namespace core { namespace utils {
+
+    // a Storage for the host which emulates a flash with a file mapped in memory, so that its content persists
+    // between runs. the storage is divided in pages of Config::pagesize bytes, as the sectors of a flash:
+    // - erase() fills with 0xff and counts the erasures of every page it touches, so that wear can be measured.
+    // - write() goes into the map or, if Config::cachepages is not zero, into a write-combining cache of pages
+    //   which are written back to the map only when evicted or at flush(). many small writes to the same page
+    //   thus cost one program of the page.
+    // - flush() writes back the cache and then syncs to the file only the pages which have changed.
+    // - view() gives read access to the map without any copy.
+    // the latencies of Config are added to every page erased or programmed, so that the timing of a real flash
+    // can be emulated. the object is not thread safe, and it is available only on posix systems.
+
+    class MappedStorage : public Storage
+    {
+    public:
+        struct Config
+        {
+            std::string filename {};
+            std::uint32_t baseaddress {0};
+            std::uint32_t size {0};                                 // it must be a multiple of pagesize
+            std::uint32_t pagesize {2048};
+            std::uint32_t cachepages {0};                           // 0 means no cache
+            embot::core::relTime pageeraselatency {0};
+            embot::core::relTime pageprogramlatency {0};
+            Config() = default;
+            Config(const std::string &f, std::uint32_t b, std::uint32_t s, std::uint32_t ps = 2048, std::uint32_t cp = 0,
+                   embot::core::relTime el = 0, embot::core::relTime pl = 0)
+                : filename(f), baseaddress(b), size(s), pagesize(ps), cachepages(cp), pageeraselatency(el), pageprogramlatency(pl) {}
+            bool isvalid() const
+            {
+                return (!filename.empty()) && (0 != pagesize) && (0 != size) && (0 == (size % pagesize)) &&
+                       ((static_cast<std::uint64_t>(baseaddress) + size) <= 0x100000000) && (cachepages <= (size / pagesize));
+            }
+        };
+
+        struct Stats
+        {
+            std::uint64_t reads {0};
+            std::uint64_t writes {0};
+            std::uint64_t erases {0};               // pages erased
+            std::uint64_t programs {0};             // pages written into the map, directly or by write-back of the cache
+            std::uint64_t cachehits {0};
+            std::uint64_t cachemisses {0};
+            std::uint64_t syncs {0};                // pages synced to the file by flush()
+            std::uint32_t maxerasecount {0};        // the erasures of the most worn page
+            embot::core::Time latency {0};          // the sum of the emulated latencies
+            Stats() = default;
+        };
+
+        MappedStorage();
+        ~MappedStorage();
+
+        // usage: init(), then the Storage interface. the file is created if it does not exist, or it is resized to
+        // Config::size and the new bytes are erased.
+        bool init(const Config &config);
+        bool deinit();
+
+        // the Storage interface
+        bool isInitted() override;
+        bool isAddressValid(std::uint32_t address) override;
+        std::uint32_t getBaseAddress() override;
+        std::uint32_t getSize() override;
+        bool fullerase() override;
+        bool erase(std::uint32_t address, std::uint32_t size) override;
+        bool read(std::uint32_t address, std::uint32_t size, void *data) override;
+        bool write(std::uint32_t address, std::uint32_t size, const void *data) override;
+
+        // it returns a pointer inside the map, or nullptr if the range is not valid. the cached pages of the range
+        // are written back before. the pointer is valid until deinit(), but the writes which stay in the cache are
+        // seen through it only after they are written back.
+        const void * view(std::uint32_t address, std::uint32_t size);
+
+        bool flush();
+
+        const Stats & stats() const;
+        std::uint32_t erasecount(std::uint32_t page) const;
+        // it clears the counters of Stats but not the erasures of the pages, which are the wear of the storage
+        void resetstats();
+
+    private:
+        struct Impl;
+        Impl *pImpl;
+    };
+
+
+}}} // namespace embot { namespace core { namespace utils {
+
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
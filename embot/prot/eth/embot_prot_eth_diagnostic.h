@@ -47,7 +47,7 @@ namespace embot { namespace prot { namespace eth { namespace diagnostic {
     enum class TYP : uint16_t { info = 0, debug = 1, warning = 2, error = 3, fatal = 4, max = 7 }; // uses 3 bits -> up to value = 7
     enum class SRC : uint16_t { board = 0, can1 = 1, can2 = 2, max  = 7 }; // uses 3 bits -> up to value = 7 
     enum class ADR : uint16_t { zero = 0, one = 1, two, three, four, five, six, seven, eigth, nine, ten, eleven, twelve, thirteen, fourteen, fifteen = 15, max = 15 };
-    enum class EXT : uint16_t { none = 0, verbal = 1, compact1 = 2, max = 3 }; // uses 2 bits -> up to value = 3
+    enum class EXT : uint16_t { none = 0, verbal = 1, compact1 = 2, aggregated = 3, max = 3 }; // uses 2 bits -> up to value = 3
     enum class FFU : uint16_t { none = 0, max = 15 };
 
     struct InfoProperties 
@@ -116,6 +116,24 @@ namespace embot { namespace prot { namespace eth { namespace diagnostic {
     };  static_assert(sizeof(Info) == Info::sizeofobject, "embot::prot::eth::diagnostic::Info has wrong sizeofobject. it must be 72");
 
 
+    // it is placed in Info::extra when EXT is aggregated: the Info represents count equal infos (same code, flags, par16, par64)
+    // which were received by the node between first and last. the basic part is the one of the first info but with timestamp = last.
+    struct Aggregate
+    {
+        // -> memory layout
+        uint32_t count {0};
+        uint32_t filler {0};
+        embot::core::Time first {0};
+        embot::core::Time last {0};
+        // <- memory layout
+
+        Aggregate() = default;
+        constexpr Aggregate(uint32_t c, embot::core::Time f, embot::core::Time l) : count(c), first(f), last(l) {}
+        constexpr static uint16_t sizeofobject = 24;
+    };  static_assert(sizeof(Aggregate) == Aggregate::sizeofobject, "embot::prot::eth::diagnostic::Aggregate has wrong sizeofobject. it must be 24");
+    static_assert(Aggregate::sizeofobject <= Info::extrasizeof, "embot::prot::eth::diagnostic::Aggregate must fit inside Info::extra");
+
+
     struct InfoLarge
     {
         constexpr static uint16_t extrasizeof = 224;
@@ -20,6 +20,8 @@
 
 #include "embot_prot_eth_rop.h"
 #include "embot_prot_eth_ropframe.h"
+#include <algorithm>
+#include <atomic>
 
 // --------------------------------------------------------------------------------------------------------------------
 // - pimpl: private implementation (see scott meyers: item 22 of effective modern c++, item 31 of effective c++
@@ -32,11 +34,16 @@ struct embot::prot::eth::diagnostic::Node::Impl
 
     embot::prot::eth::ropframe::Former *_ropframeformer {nullptr};
     // used by _ropframeformer
-    uint8_t *ropframedata {nullptr};
-    embot::core::Data buffer {nullptr, 0};
-    uint8_t *bufferdata {nullptr};
-    size_t buffercapacity {0};
+    // two ropframes in ping-pong: _ropframeformer adds rops into ropframedata[active] while the other one
+    // is the spare, which holds the frame made by the last prepare() and which can be lent to the caller
+    enum class Spare : uint8_t { free = 0, prepared = 1, borrowed = 2 };
+    uint8_t *ropframedata[2] {nullptr, nullptr};
+    uint8_t active {0};
+    Spare spare {Spare::free};
+    uint16_t sizeofspare {0};
     uint64_t sequencenumber {0};
+    // it protects _ropframeformer and the aggregation stage if concurrentuse is true
+    mutable std::atomic_flag guard = ATOMIC_FLAG_INIT;
     // used by _ropframeformer
     embot::prot::eth::rop::Stream *_ropstream {nullptr};
    
@@ -45,8 +52,61 @@ struct embot::prot::eth::diagnostic::Node::Impl
     embot::prot::eth::rop::Stream *ropstr_info {nullptr};
     embot::prot::eth::rop::Stream *ropstr_infobasic {nullptr};
     
+    // the aggregation stage
+    enum class Kind : uint8_t { basic = 0, info = 1, large = 2 };
+    
+    struct Tracked
+    {
+        bool used {false};
+        bool pending {false};           // the first info is still to be emitted
+        Kind kind {Kind::basic};
+        uint32_t count {0};             // number of equal infos inside the window, the first included
+        embot::core::Time opened {0};   // time of the node when the window was opened
+        embot::core::Time last {0};     // timestamp of the last equal info
+        embot::prot::eth::diagnostic::InfoLarge item {};    // the first info. InfoBasic and Info use only the first part of it
+    };
+    
+    struct Bucket
+    {
+        bool used {false};
+        uint16_t tokens {0};
+        uint32_t code {0};
+        embot::core::Time refilled {0};
+    };
+    
+    Tracked *tracked {nullptr};
+    Bucket *buckets {nullptr};
+    Counters counters {};
+    
     
     Impl() = default;   
+    
+    struct Guard
+    {
+        const Impl *impl {nullptr};
+        Guard(const Impl *i) : impl(i->config.concurrentuse ? i : nullptr) { if(nullptr != impl) { impl->lock(); } }
+        ~Guard() { if(nullptr != impl) { impl->unlock(); } }
+    };
+    
+    void lock() const
+    {
+        if(nullptr != config.lock)
+        {
+            config.lock();
+            return;
+        }
+        while(guard.test_and_set(std::memory_order_acquire)) {}
+    }
+    
+    void unlock() const
+    {
+        if(nullptr != config.unlock)
+        {
+            config.unlock();
+            return;
+        }
+        guard.clear(std::memory_order_release);
+    }
 
     ~Impl()
     {
@@ -64,18 +124,17 @@ struct embot::prot::eth::diagnostic::Node::Impl
             }
         }
 
-        if(nullptr != bufferdata)
-        {
-            delete[] bufferdata;
-            bufferdata = nullptr;
-            buffercapacity = 0;
-        }
-
-        if(nullptr != ropframedata)
+        for(auto &fd : ropframedata)
         {
-            delete[] ropframedata;
-            ropframedata = nullptr;
+            if(nullptr != fd)
+            {
+                delete[] fd;
+                fd = nullptr;
+            }
         }
+        active = 0;
+        spare = Spare::free;
+        sizeofspare = 0;
 
         if(nullptr != _ropframeformer)
         {
@@ -107,6 +166,18 @@ struct embot::prot::eth::diagnostic::Node::Impl
             delete _ropstream;
             _ropstream =  nullptr;
         }
+        
+        if(nullptr != tracked)
+        {
+            delete[] tracked;
+            tracked = nullptr;
+        }
+        
+        if(nullptr != buckets)
+        {
+            delete[] buckets;
+            buckets = nullptr;
+        }
 
         initted = false;
 
@@ -128,14 +199,14 @@ struct embot::prot::eth::diagnostic::Node::Impl
         config = c;
         _ropframeformer = new embot::prot::eth::ropframe::Former; // empty shell
         uint16_t nbytes4frame = config.ropframecapacity;
-        ropframedata = new uint8_t[nbytes4frame];
+        ropframedata[0] = new uint8_t[nbytes4frame];
+        ropframedata[1] = new uint8_t[nbytes4frame];
+        active = 0;
+        spare = Spare::free;
+        sizeofspare = 0;
         // give memory to the empty shell, so that it contains the header-ropspace-footer + a service ropstream
         _ropstream = new embot::prot::eth::rop::Stream(config.singleropstreamcapacity);
-        _ropframeformer->load({ropframedata, nbytes4frame}, _ropstream);         
-        // and give memory to my buffer
-        buffercapacity = nbytes4frame;
-        bufferdata = new uint8_t[buffercapacity];
-        buffer.clear(); // so that it is not valid
+        _ropframeformer->load({ropframedata[active], nbytes4frame}, _ropstream);         
         
         
         constexpr embot::prot::eth::rop::PLUS plusMODE = embot::prot::eth::rop::PLUS::none;
@@ -175,6 +246,14 @@ struct embot::prot::eth::diagnostic::Node::Impl
             plusMODE
         };
         ropstr_infolarge->load(sig_infolarge);
+        
+        if(config.aggregationcapacity > 0)
+        {
+            tracked = new Tracked[config.aggregationcapacity];
+            buckets = new Bucket[config.aggregationcapacity];
+        }
+        counters = {};
+        
         initted = true;
         return true;
     }
@@ -191,6 +270,7 @@ struct embot::prot::eth::diagnostic::Node::Impl
             return false;
         }
 
+        Guard g {this};
         uint16_t availspace = 0;
         return _ropframeformer->pushback(ropstream, availspace);
     }
@@ -208,6 +288,7 @@ struct embot::prot::eth::diagnostic::Node::Impl
             return false;
         }        
           
+        Guard g {this};
         uint16_t availspace = 0;
         return _ropframeformer->pushback(ropdes, availspace);
         return false;
@@ -219,7 +300,57 @@ struct embot::prot::eth::diagnostic::Node::Impl
         if(!initted)
         {
             return false;
-        }        
+        }
+        
+        Guard g {this};
+        counters.added++;
+        
+        if(aggregating(infobasic))
+        {
+            return track(infobasic, Kind::basic, nullptr, 0);
+        }
+        
+        return push(infobasic);
+    }
+    
+    bool add(const embot::prot::eth::diagnostic::Info &info)
+    {
+        if(!initted)
+        {
+            return false;
+        }
+        
+        Guard g {this};
+        counters.added++;
+        
+        if(aggregating(info.basic))
+        {
+            return track(info.basic, Kind::info, info.extra, sizeof(info.extra));
+        }
+        
+        return push(info);
+    }
+    
+    bool add(const embot::prot::eth::diagnostic::InfoLarge &infolarge)
+    {
+        if(!initted)
+        {
+            return false;
+        }
+        
+        Guard g {this};
+        counters.added++;
+        
+        if(aggregating(infolarge.basic))
+        {
+            return track(infolarge.basic, Kind::large, infolarge.extral, sizeof(infolarge.extral));
+        }
+        
+        return push(infolarge);
+    }
+
+    bool push(const embot::prot::eth::diagnostic::InfoBasic &infobasic)
+    {
         // i need a pre-former rop (or ropstream) where to just add the infobasic stuff
         embot::core::Data da{const_cast<embot::prot::eth::diagnostic::InfoBasic*>(&infobasic), embot::prot::eth::diagnostic::InfoBasic::sizeofobject};
         //embot::core::Data da{&infobasic, embot::prot::eth::diagnostic::InfoBasic::size};
@@ -234,13 +365,8 @@ struct embot::prot::eth::diagnostic::Node::Impl
         return _ropframeformer->pushback({strm, ss}, availspace);
     }
 
-    bool add(const embot::prot::eth::diagnostic::Info &info)
+    bool push(const embot::prot::eth::diagnostic::Info &info)
     {
-        if(!initted)
-        {
-            return false;
-        }
-
         embot::prot::eth::rop::Stream *stream = (embot::prot::eth::diagnostic::EXT::none == info.basic.flags.getEXT()) ? ropstr_infobasic : ropstr_info;        
         
         // i need a pre-former rop (or ropstream) where to just add the info stuff
@@ -256,13 +382,8 @@ struct embot::prot::eth::diagnostic::Node::Impl
         return _ropframeformer->pushback({strm, ss}, availspace);
     }
 
-    bool add(const embot::prot::eth::diagnostic::InfoLarge &infolarge)
+    bool push(const embot::prot::eth::diagnostic::InfoLarge &infolarge)
     {
-        if(!initted)
-        {
-            return false;
-        }
-        
         embot::prot::eth::rop::Stream *stream = (embot::prot::eth::diagnostic::EXT::none == infolarge.basic.flags.getEXT()) ? ropstr_infobasic : ropstr_infolarge; 
 
         // i need a pre-former rop (or ropstream) where to just add the infobasic stuff
@@ -278,6 +399,238 @@ struct embot::prot::eth::diagnostic::Node::Impl
         return _ropframeformer->pushback({strm, ss}, availspace);
     }
     
+    bool aggregating(const embot::prot::eth::diagnostic::InfoBasic &basic) const
+    {
+        return (nullptr != tracked) && (basic.flags.getTYP() < config.bypass);
+    }
+    
+    static bool equal(const embot::prot::eth::diagnostic::InfoBasic &a, const embot::prot::eth::diagnostic::InfoBasic &b)
+    {
+        return (a.code == b.code) && (a.flags.flags == b.flags.flags) && (a.par16 == b.par16) && (a.par64 == b.par64);
+    }
+    
+    bool expired(const Tracked &t, embot::core::Time now) const
+    {
+        return (now - t.opened) >= config.aggregationwindow;
+    }
+    
+    bool track(const embot::prot::eth::diagnostic::InfoBasic &basic, Kind kind, const void *extra, size_t sizeofextra)
+    {
+        embot::core::Time now = embot::core::now();
+        Tracked *slot = nullptr;
+        Tracked *victim = nullptr;
+        
+        for(uint16_t i=0; i<config.aggregationcapacity; i++)
+        {
+            Tracked &t = tracked[i];
+            
+            if(!t.used)
+            {
+                if(nullptr == slot)
+                {
+                    slot = &t;
+                }
+                continue;
+            }
+            
+            // an expired window does not accept more infos. prepare() will close it
+            if(equal(t.item.basic, basic) && !expired(t, now))
+            {
+                t.count++;
+                t.last = basic.timestamp;
+                counters.coalesced++;
+                return true;
+            }
+            
+            // the victim is the oldest amongst the ones with lowest TYP
+            if((nullptr == victim) || (t.item.basic.flags.getTYP() < victim->item.basic.flags.getTYP()) ||
+               ((t.item.basic.flags.getTYP() == victim->item.basic.flags.getTYP()) && (t.opened < victim->opened)))
+            {
+                victim = &t;
+            }
+        }
+        
+        if(nullptr == slot)
+        {
+            if(basic.flags.getTYP() < victim->item.basic.flags.getTYP())
+            {
+                counters.lost++;
+                return false;
+            }
+            close(*victim, now);
+            counters.evicted++;
+            slot = victim;
+        }
+        
+        slot->used = true;
+        slot->pending = true;
+        slot->kind = kind;
+        slot->count = 1;
+        slot->opened = now;
+        slot->last = basic.timestamp;
+        slot->item.basic = basic;
+        if(nullptr != extra)
+        {
+            std::memmove(slot->item.extral, extra, sizeofextra);
+        }
+        
+        return true;
+    }
+    
+    // it returns the bucket of the code already refilled or nullptr if there is no rate limitation
+    Bucket * bucket(uint32_t code, embot::core::Time now)
+    {
+        if(0 == config.ratelimitburst)
+        {
+            return nullptr;
+        }
+        
+        Bucket *b = nullptr;
+        Bucket *recycle = nullptr;
+        for(uint16_t i=0; i<config.aggregationcapacity; i++)
+        {
+            if(buckets[i].used && (code == buckets[i].code))
+            {
+                b = &buckets[i];
+                break;
+            }
+            
+            if((nullptr == recycle) || (recycle->used && (!buckets[i].used || (buckets[i].refilled < recycle->refilled))))
+            {
+                recycle = &buckets[i];
+            }
+        }
+        
+        if(nullptr == b)
+        {
+            b = recycle;
+            b->used = true;
+            b->code = code;
+            b->tokens = config.ratelimitburst;
+            b->refilled = now;
+            return b;
+        }
+        
+        uint64_t n = (now - b->refilled) / config.ratelimitperiod;
+        if(n > 0)
+        {
+            b->tokens = static_cast<uint16_t>(std::min<uint64_t>(config.ratelimitburst, b->tokens + n));
+            b->refilled = (config.ratelimitburst == b->tokens) ? now : (b->refilled + n*config.ratelimitperiod);
+        }
+        
+        return b;
+    }
+    
+    bool emitfirst(const Tracked &t)
+    {
+        switch(t.kind)
+        {
+            case Kind::large:   return push(t.item);
+            case Kind::info:    return push(embot::prot::eth::diagnostic::Info{t.item.basic, t.item.extral});
+            default:            return push(t.item.basic);
+        }
+    }
+    
+    bool emitsummary(const Tracked &t)
+    {
+        embot::prot::eth::diagnostic::InfoBasic basic {t.item.basic};
+        basic.timestamp = t.last;
+        basic.flags.load(basic.flags.getTYP(), basic.flags.getSRC(), basic.flags.getADR(), embot::prot::eth::diagnostic::EXT::aggregated, basic.flags.getFFU());
+        embot::prot::eth::diagnostic::Info info {basic};
+        embot::prot::eth::diagnostic::Aggregate aggregate {t.count, t.item.basic.timestamp, t.last};
+        std::memmove(info.extra, &aggregate, sizeof(aggregate));
+        if(!push(info))
+        {
+            return false;
+        }
+        counters.summaries++;
+        return true;
+    }
+    
+    // it emits whatever is still due by t, if possible, and frees it
+    void close(Tracked &t, embot::core::Time now)
+    {
+        bool ok = true;
+        if(t.count > 1)
+        {   // the summary also tells about the first one
+            ok = emitsummary(t);
+        }
+        else if(t.pending)
+        {
+            Bucket *b = bucket(t.item.basic.code, now);
+            if((nullptr != b) && (0 == b->tokens))
+            {
+                counters.ratelimited++;
+            }
+            else if((ok = emitfirst(t)) && (nullptr != b))
+            {
+                b->tokens--;
+            }
+        }
+        
+        if(!ok)
+        {
+            counters.lost++;
+        }
+        
+        t.used = false;
+    }
+    
+    // it moves the tracked infos into the ropframe, in order of decreasing TYP, until there is room 
+    void flush()
+    {
+        if(nullptr == tracked)
+        {
+            return;
+        }
+        
+        embot::core::Time now = embot::core::now();
+        
+        for(int typ = embot::core::tointegral(embot::prot::eth::diagnostic::TYP::max); typ >= 0; typ--)
+        {
+            for(uint16_t i=0; i<config.aggregationcapacity; i++)
+            {
+                Tracked &t = tracked[i];
+                
+                if(!t.used || (typ != embot::core::tointegral(t.item.basic.flags.getTYP())))
+                {
+                    continue;
+                }
+                
+                if(t.pending)
+                {
+                    Bucket *b = bucket(t.item.basic.code, now);
+                    if((nullptr != b) && (0 == b->tokens))
+                    {   // it will be told by the summary if other equal infos arrive
+                        t.pending = false;
+                        counters.ratelimited++;
+                    }
+                    else if(emitfirst(t))
+                    {
+                        t.pending = false;
+                        if(nullptr != b)
+                        {
+                            b->tokens--;
+                        }
+                    }
+                    else
+                    {   // the ropframe is full: the rest waits for next time
+                        return;
+                    }
+                }
+                
+                if(expired(t, now))
+                {
+                    if((t.count > 1) && !emitsummary(t))
+                    {
+                        return;
+                    }
+                    t.used = false;
+                }
+            }
+        }
+    }
+    
     bool prepare(size_t &sizeofropframe)
     {
         if(!initted)
@@ -290,6 +643,15 @@ struct embot::prot::eth::diagnostic::Node::Impl
 
         sizeofropframe = 0;
 #if 1
+        if(Spare::borrowed == spare)
+        {   // the caller still uses the other frame: the rops stay where they are and go with the next one
+            return false;
+        }
+        
+        Guard g {this};
+        
+        flush();
+        
         if(0 == _ropframeformer->getNumberOfROPs())
         {
             return false;
@@ -298,15 +660,17 @@ struct embot::prot::eth::diagnostic::Node::Impl
         embot::core::Time timenow = embot::core::now();
         _ropframeformer->set(timenow, sequencenumber++);
         
-        // copy into buffer
         embot::core::Data fr {};
         _ropframeformer->get(fr); 
-        std::memmove(bufferdata, fr.pointer, fr.capacity); 
-        buffer.load(bufferdata, fr.capacity); // now buffer is valid ...        
+        sizeofspare = fr.capacity;
+        spare = Spare::prepared;
+        
+        // swap: the frame just done becomes the spare and the former continues on the other one, which it formats
+        active ^= 1;
+        _ropframeformer->unload();
+        _ropframeformer->load({ropframedata[active], config.ropframecapacity}, _ropstream);
         
-        sizeofropframe = fr.capacity;
-        // format
-        _ropframeformer->format();
+        sizeofropframe = sizeofspare;
             
         return true;
         
@@ -360,30 +724,63 @@ struct embot::prot::eth::diagnostic::Node::Impl
             return false;
         }
 
-        // in here i could lock buffer ..
+        // the spare is never touched by add(), hence i dont need to lock
 
-        if(!buffer.isvalid())
+        if(Spare::free == spare)
         {
             return false;
         }
 
-        if(datainropframe.capacity < buffer.capacity)
+        if(datainropframe.capacity < sizeofspare)
         {
             return false;
         }
 
-        // i am ok: i can copy buffer into ropframe
-
-        datainropframe.capacity = buffer.capacity;
-        std::memmove(datainropframe.pointer, buffer.pointer, buffer.capacity); 
-
-        // ok, i could unlock
+        datainropframe.capacity = sizeofspare;
+        std::memmove(datainropframe.pointer, ropframedata[active^1], sizeofspare); 
 
         return true;
     }
     
+    bool borrow(embot::core::Data &ropframe)
+    {
+        if(!initted)
+        {
+            return false;
+        }
+        
+        if(Spare::prepared != spare)
+        {
+            return false;
+        }
+        
+        spare = Spare::borrowed;
+        ropframe.load(ropframedata[active^1], sizeofspare);
+        
+        return true;
+    }
+    
+    bool release()
+    {
+        if(!initted)
+        {
+            return false;
+        }
+        
+        if(Spare::borrowed != spare)
+        {
+            return false;
+        }
+        
+        spare = Spare::free;
+        sizeofspare = 0;
+        
+        return true;
+    }
+    
     uint16_t getNumberOfROPs() const
     {
+        Guard g {this};
         return _ropframeformer->getNumberOfROPs();
     }
 
@@ -460,10 +857,30 @@ bool embot::prot::eth::diagnostic::Node::retrieve(embot::core::Data &datainropfr
     return pImpl->retrieve(datainropframe);
 }
 
+bool embot::prot::eth::diagnostic::Node::borrow(embot::core::Data &ropframe)
+{
+    return pImpl->borrow(ropframe);
+}
+
+bool embot::prot::eth::diagnostic::Node::release()
+{
+    return pImpl->release();
+}
+
 uint16_t embot::prot::eth::diagnostic::Node::getNumberOfROPs() const
 {
     return pImpl->getNumberOfROPs();
 }
+
+const embot::prot::eth::diagnostic::Node::Counters & embot::prot::eth::diagnostic::Node::getCounters() const
+{
+    return pImpl->counters;
+}
+
+void embot::prot::eth::diagnostic::Node::resetCounters()
+{
+    pImpl->counters = {};
+}
     
 
 // - end-of-file (leave a blank line after)----------------------------------------------------------------------------
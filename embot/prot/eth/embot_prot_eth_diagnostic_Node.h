@@ -27,21 +27,58 @@ namespace embot { namespace prot { namespace eth { namespace diagnostic {
     public:
         struct Config
         {
-            bool concurrentuse {false}; // ffu
+            // if true, add() can be called by a thread while another one calls prepare() / borrow() / release().
+            // lock and unlock protect the ropframe being formed: if they are nullptr, a spinlock is used.
+            bool concurrentuse {false};
+            embot::core::fpWorker lock {nullptr};
+            embot::core::fpWorker unlock {nullptr};
             uint16_t singleropstreamcapacity {128};
             uint16_t ropframecapacity {512};
+            // aggregation stage of the infos. it is active only if aggregationcapacity > 0. when active, the infos with
+            // TYP lower than bypass are not put into the ropframe by add() but are tracked and emitted by prepare() 
+            // in order of decreasing TYP. equal infos (same code, flags, par16, par64) which arrive inside 
+            // aggregationwindow are emitted only once and at the end of the window a single Info with EXT::aggregated 
+            // tells how many they were. if ratelimitburst > 0, every code can emit at most ratelimitburst infos at once 
+            // and then one every ratelimitperiod.
+            uint16_t aggregationcapacity {0};   // number of different infos tracked at the same time
+            embot::core::relTime aggregationwindow {100*embot::core::time1millisec};
+            uint16_t ratelimitburst {0};
+            embot::core::relTime ratelimitperiod {10*embot::core::time1millisec};
+            embot::prot::eth::diagnostic::TYP bypass {embot::prot::eth::diagnostic::TYP::fatal};
             // todo: 
             // - add any customisation such as: capacityofropframe, maxropsize, capacity of fifo of ropframes, etc.  
             Config() = default;
             constexpr Config(bool cu, uint16_t src, uint16_t rfc) : concurrentuse(cu), singleropstreamcapacity(src), ropframecapacity(rfc) {}
-            bool isvalid() const { return (ropframecapacity > (28+32)) && (singleropstreamcapacity > 32); }
+            constexpr Config(bool cu, uint16_t src, uint16_t rfc, uint16_t ac, embot::core::relTime aw, uint16_t rb, embot::core::relTime rp, embot::prot::eth::diagnostic::TYP by) 
+                : concurrentuse(cu), singleropstreamcapacity(src), ropframecapacity(rfc), 
+                  aggregationcapacity(ac), aggregationwindow(aw), ratelimitburst(rb), ratelimitperiod(rp), bypass(by) {}
+            bool isvalid() const 
+            { 
+                return (ropframecapacity > (28+32)) && (singleropstreamcapacity > 32) && 
+                       ((0 == aggregationcapacity) || (aggregationwindow > 0)) && ((0 == ratelimitburst) || (ratelimitperiod > 0)); 
+            }
         };         
+        
+        struct Counters
+        {
+            uint32_t added {0};         // infos given to add()
+            uint32_t coalesced {0};     // infos merged into an equal one inside its window
+            uint32_t ratelimited {0};   // infos not emitted because their code had no tokens
+            uint32_t summaries {0};     // infos with EXT::aggregated emitted at the end of a window
+            uint32_t evicted {0};       // tracked infos closed before the end of their window to make room
+            uint32_t lost {0};          // infos which were never emitted because there was no room (not counting ratelimited)
+            Counters() = default;
+        };
                
         Node();  
         ~Node();
 
         // usage: init(), then add() as many rops one wants, then when one wants to attempt transmit: 
         // if(prepare()) { retrieve(data); <alert the sender>}
+        // or, w/out any copy: 
+        // if(prepare() && borrow(data)) { <transmit data>; release(); }
+        // the node has two ropframes: add() fills one while the other is lent by borrow() until release(). 
+        // in the meantime prepare() returns false and the rops stay in the frame being formed.
 
         bool init(const Config &config);
         bool initted() const;
@@ -52,7 +89,11 @@ namespace embot { namespace prot { namespace eth { namespace diagnostic {
         bool add(const embot::prot::eth::diagnostic::InfoLarge &infolarge);
         bool prepare(size_t &sizeofropframe); // returns true if anything to retrieve. in sizeofropframe the size of required mem
         bool retrieve(embot::core::Data &datainropframe); // it copies the ropframe. 
+        bool borrow(embot::core::Data &ropframe); // it gives the ropframe by reference. it stays valid until release()
+        bool release();
         uint16_t getNumberOfROPs() const;
+        const Counters & getCounters() const;
+        void resetCounters();
 
     private:    
         struct Impl;
@@ -26,6 +26,7 @@
 #include "EoCommon.h"
 #include "EOtheErrorManager.h"
 #include "EOVmutex.h"
+#include "EoAtomic.h"
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -77,6 +78,10 @@ static void s_memfree(void *p);
 
 static void * s_memrealloc(void *p, uint32_t s);
 
+static void s_eo_mempool_usedbytesheap_add(uint32_t bytes);
+
+static void s_eo_mempool_usedbytesheap_sub(uint32_t bytes);
+
 //static size_t s_eo_mempool_heap_sizeof_allocated_pointer(void* p);
 
 //static uint16_t s_align_size(eOmempool_alignment_t alignmode, uint16_t size);
@@ -347,8 +352,11 @@ extern void * eo_mempool_GetMemory(EOtheMemoryPool *p, eOmempool_alignment_t ali
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_GetMemory() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytespool += usedbytespool; 
-    s_the_mempool.stats.usedbytesheap += usedbytesheap;
+    if(0 != usedbytespool)
+    {   // only the static pools use it and they are not shared by threads
+        s_the_mempool.stats.usedbytespool += usedbytespool; 
+    }
+    s_eo_mempool_usedbytesheap_add(usedbytesheap);
     
     return(ret);   
 }
@@ -379,7 +387,7 @@ extern void * eo_mempool_New(EOtheMemoryPool *p, uint32_t size)
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_New() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);      
+    s_eo_mempool_usedbytesheap_add(eo_common_msize(ret));      
 
     return(ret);   
 }
@@ -409,7 +417,7 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
     
     if(NULL != m)
     {
-        s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
+        s_eo_mempool_usedbytesheap_sub(eo_common_msize(m));
     }    
     
     ret = s_the_mempool.theheap.reallocate(m, size);
@@ -424,7 +432,7 @@ extern void * eo_mempool_Realloc(EOtheMemoryPool *p, void *m, uint32_t size)
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "eo_mempool_Realloc() no more memory", s_eobj_ownname, &errdes);
     }
     
-    s_the_mempool.stats.usedbytesheap += eo_common_msize(ret);  
+    s_eo_mempool_usedbytesheap_add(eo_common_msize(ret));  
     
     return(ret);   
 }
@@ -443,7 +451,7 @@ extern void eo_mempool_Delete(EOtheMemoryPool *p, void *m)
         return;
     }        
         
-    s_the_mempool.stats.usedbytesheap -= eo_common_msize(m); 
+    s_eo_mempool_usedbytesheap_sub(eo_common_msize(m));
 
     s_the_mempool.theheap.release(m);          
 }
@@ -568,6 +576,18 @@ static void * s_memrealloc(void *p, uint32_t s)
     return(realloc(p, s));
 }
 
+// the heap is used also by more threads at the same time, as when the host creates its transceivers in parallel.
+static void s_eo_mempool_usedbytesheap_add(uint32_t bytes)
+{
+    eo_atomic_u32_Add(&s_the_mempool.stats.usedbytesheap, (int32_t)bytes);
+}
+
+
+static void s_eo_mempool_usedbytesheap_sub(uint32_t bytes)
+{
+    eo_atomic_u32_Add(&s_the_mempool.stats.usedbytesheap, -(int32_t)bytes);
+}
+
 //static size_t s_eo_mempool_heap_sizeof_allocated_pointer(void* p)
 //{   // not sure it is portable on 64 bit architectures.
 //    size_t* xx = (size_t*)p;
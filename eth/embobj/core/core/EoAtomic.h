@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOATOMIC_H_
+#define _EOATOMIC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EoAtomic.h
+    @brief      This header file contains the atomic operations used inside embobj, with inline functions only.
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_atomic Atomic operations
+    The few atomic operations which embobj needs to share variables amongst the threads of the host. They are not
+    meant to be used outside embobj.
+
+    The loads have acquire semantics, the stores have release semantics and a compare-and-swap which succeeds has
+    acquire semantics. With gcc and clang the functions use the __atomic builtins. With msvc they use the interlocked
+    intrinsics also for loads, stores and fences, because they are full barriers for the compiler and for the cpu on
+    any architecture, whereas _ReadWriteBarrier() is only for the compiler. With armcc 5 of the ARM boards, which has
+    no atomic builtins, the loads and stores are single instructions followed or preceded by a memory barrier, and the 
+    compare-and-swap and the add are done with the interrupts masked, so that neither an irq handler nor the rtos can
+    preempt them. Any other compiler is an error.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#if defined(__GNUC__)
+    // the __atomic builtins. also armclang has them
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__CC_ARM)
+    // the intrinsics of armcc: __disable_irq(), __enable_irq() and __dmb()
+#else
+#error EoAtomic.h: there are no atomic operations for this compiler
+#endif
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+#if !defined(__GNUC__) && !defined(_MSC_VER) && defined(__CC_ARM)
+// the critical section of armcc: it masks the interrupts and it gives back the previous mask. they are not for the user.
+EO_static_inline uint32_t eo_atomic_irq_Disable(void)
+{
+    register uint32_t primask __asm("primask");
+    uint32_t prev = primask;
+    __disable_irq();
+    return(prev);
+}
+
+EO_static_inline void eo_atomic_irq_Restore(uint32_t prev)
+{
+    if(0 == (prev & 1))
+    {
+        __enable_irq();
+    }
+}
+#endif
+
+/** @fn         EO_static_inline uint8_t eo_atomic_u08_Load(const volatile uint8_t *v)
+    @brief      reads v with acquire semantics: the loads and stores after it are not done before it.
+ **/
+EO_static_inline uint8_t eo_atomic_u08_Load(const volatile uint8_t *v)
+{
+#if defined(__GNUC__)
+    return(__atomic_load_n(v, __ATOMIC_ACQUIRE));
+#elif defined(_MSC_VER)
+    return((uint8_t)_InterlockedCompareExchange8((volatile char*)v, 0, 0));
+#else
+    uint8_t value = *v;
+    __dmb(0xF);
+    return(value);
+#endif
+}
+
+
+/** @fn         EO_static_inline void eo_atomic_u08_Store(volatile uint8_t *v, uint8_t value)
+    @brief      writes v with release semantics: the loads and stores before it are done before it.
+ **/
+EO_static_inline void eo_atomic_u08_Store(volatile uint8_t *v, uint8_t value)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(v, value, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    _InterlockedExchange8((volatile char*)v, (char)value);
+#else
+    __dmb(0xF);
+    *v = value;
+#endif
+}
+
+
+/** @fn         EO_static_inline eObool_t eo_atomic_u08_CompareExchange(volatile uint8_t *v, uint8_t expected, uint8_t desired)
+    @brief      writes desired into v only if v is equal to expected.
+    @return     eobool_true if v was written.
+ **/
+EO_static_inline eObool_t eo_atomic_u08_CompareExchange(volatile uint8_t *v, uint8_t expected, uint8_t desired)
+{
+#if defined(__GNUC__)
+    return(__atomic_compare_exchange_n(v, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE) ? eobool_true : eobool_false);
+#elif defined(_MSC_VER)
+    return((expected == (uint8_t)_InterlockedCompareExchange8((volatile char*)v, (char)desired, (char)expected)) ? eobool_true : eobool_false);
+#else
+    eObool_t done = eobool_false;
+    uint32_t prev = eo_atomic_irq_Disable();
+    if(expected == *v)
+    {
+        *v = desired;
+        done = eobool_true;
+    }
+    eo_atomic_irq_Restore(prev);
+    __dmb(0xF);
+    return(done);
+#endif
+}
+
+
+/** @fn         EO_static_inline uint32_t eo_atomic_u32_Load(const volatile uint32_t *v)
+    @brief      reads v with acquire semantics: the loads and stores after it are not done before it.
+ **/
+EO_static_inline uint32_t eo_atomic_u32_Load(const volatile uint32_t *v)
+{
+#if defined(__GNUC__)
+    return(__atomic_load_n(v, __ATOMIC_ACQUIRE));
+#elif defined(_MSC_VER)
+    return((uint32_t)_InterlockedCompareExchange((volatile long*)v, 0, 0));
+#else
+    uint32_t value = *v;
+    __dmb(0xF);
+    return(value);
+#endif
+}
+
+
+/** @fn         EO_static_inline void eo_atomic_u32_Store(volatile uint32_t *v, uint32_t value)
+    @brief      writes v with release semantics: the loads and stores before it are done before it.
+ **/
+EO_static_inline void eo_atomic_u32_Store(volatile uint32_t *v, uint32_t value)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(v, value, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    _InterlockedExchange((volatile long*)v, (long)value);
+#else
+    __dmb(0xF);
+    *v = value;
+#endif
+}
+
+
+/** @fn         EO_static_inline eObool_t eo_atomic_u32_CompareExchange(volatile uint32_t *v, uint32_t expected, uint32_t desired)
+    @brief      writes desired into v only if v is equal to expected.
+    @return     eobool_true if v was written.
+ **/
+EO_static_inline eObool_t eo_atomic_u32_CompareExchange(volatile uint32_t *v, uint32_t expected, uint32_t desired)
+{
+#if defined(__GNUC__)
+    return(__atomic_compare_exchange_n(v, &expected, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ? eobool_true : eobool_false);
+#elif defined(_MSC_VER)
+    return((expected == (uint32_t)_InterlockedCompareExchange((volatile long*)v, (long)desired, (long)expected)) ? eobool_true : eobool_false);
+#else
+    eObool_t done = eobool_false;
+    uint32_t prev = eo_atomic_irq_Disable();
+    if(expected == *v)
+    {
+        *v = desired;
+        done = eobool_true;
+    }
+    eo_atomic_irq_Restore(prev);
+    __dmb(0xF);
+    return(done);
+#endif
+}
+
+
+/** @fn         EO_static_inline void eo_atomic_u32_Add(volatile uint32_t *v, int32_t delta)
+    @brief      adds delta to v. it does not order the other loads and stores, so it is good only for counters.
+ **/
+EO_static_inline void eo_atomic_u32_Add(volatile uint32_t *v, int32_t delta)
+{
+#if defined(__GNUC__)
+    __atomic_fetch_add(v, (uint32_t)delta, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+    _InterlockedExchangeAdd((volatile long*)v, (long)delta);
+#else
+    uint32_t prev = eo_atomic_irq_Disable();
+    *v += (uint32_t)delta;
+    eo_atomic_irq_Restore(prev);
+#endif
+}
+
+
+/** @fn         EO_static_inline void eo_atomic_FenceAcquire(void)
+    @brief      the loads before it are done before the loads and stores after it.
+ **/
+EO_static_inline void eo_atomic_FenceAcquire(void)
+{
+#if defined(__GNUC__)
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+    // as MemoryBarrier() does, without the need of windows.h
+    volatile long fence = 0;
+    _InterlockedExchange(&fence, 0);
+#else
+    __dmb(0xF);
+#endif
+}
+
+
+/** @fn         EO_static_inline void eo_atomic_FenceRelease(void)
+    @brief      the loads and stores before it are done before the stores after it.
+ **/
+EO_static_inline void eo_atomic_FenceRelease(void)
+{
+#if defined(__GNUC__)
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    volatile long fence = 0;
+    _InterlockedExchange(&fence, 0);
+#else
+    __dmb(0xF);
+#endif
+}
+
+
+/** @}
+    end of group eo_atomic
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -22,6 +22,15 @@
 
 #include "stdlib.h"
 #include "string.h"
+#include "EoAtomic.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
@@ -81,6 +90,11 @@ const eOipv4addr_t eok_ipv4addr_localhost   = EO_COMMON_IPV4ADDR_LOCALHOST;
 // - declaration of static functions
 // --------------------------------------------------------------------------------------------------------------------
 
+static eObool_t s_eo_common_map_index_ready(eOmap_str_str_u08_index_t * index);
+static void s_eo_common_map_index_build(eOmap_str_str_u08_index_t * index);
+static const eOmap_str_str_u08_t * s_eo_common_map_index_item(const eOmap_str_str_u08_index_t * index, uint8_t pos);
+static uint32_t s_eo_common_map_index_hash(const char * string);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -401,11 +415,30 @@ static eOresult_t s_eo_common_Q17_14_clip(int64_t in, eOq17_14_t *out)
     return(eores_OK);        
 }
 
+static eOresult_t s_eo_common_float_to_Q17_14_clip(float in, eOq17_14_t *out)
+{
+    float ff = in * 16384.0f;   // note: 16384.0 = 2^14
+    
+    // clip in float before the cast, which is undefined beyond the int64_t range. we keep the truncation of the cast
+    if(ff >= 2147483648.0f)
+    {
+        *out = EOK_Q17_14_POS_BIGGEST;
+        return(eores_NOK_generic);
+    }
+    
+    if(ff < -2147483648.0f)
+    {
+        *out = EOK_Q17_14_NEG_BIGGEST;
+        return(eores_NOK_generic);
+    }
+    
+    return(s_eo_common_Q17_14_clip((int64_t)ff, out));
+}
+
 extern eOq17_14_t eo_common_float_to_Q17_14(float f_num)
 {   // check vs overflow and clip ....
     eOq17_14_t ret = 0;
-    int64_t rr = (int64_t)(f_num * 16384.0f);    // note: 16384.0 = 2^14
-    s_eo_common_Q17_14_clip(rr, &ret);
+    s_eo_common_float_to_Q17_14_clip(f_num, &ret);
     return(ret);
 }
 
@@ -420,7 +453,7 @@ extern float eo_common_Q17_14_to_float(eOq17_14_t q_num)
 // if the sum is valid return is eores_OK
 extern eOresult_t eo_common_Q17_14_add(eOq17_14_t q_num1, eOq17_14_t q_num2, eOq17_14_t *q_res)
 {
-    int64_t rr = (int64_t)q_num1 + (int64_t)q_num1;
+    int64_t rr = (int64_t)q_num1 + (int64_t)q_num2;
 
     return(s_eo_common_Q17_14_clip(rr, q_res));
 }
@@ -470,6 +503,138 @@ extern eOresult_t eo_common_Q17_14_divide(eOq17_14_t q_num1, eOq17_14_t q_num2,
 }
 
 
+extern uint32_t eo_common_Q17_14_batch_from_float(const float *f_num, eOq17_14_t *q_res, uint32_t n)
+{
+    uint32_t clipped = 0;
+    uint32_t i = 0;
+    
+#if defined(__SSE2__)
+    const __m128 scale = _mm_set1_ps(16384.0f);
+    const __m128 posbig = _mm_set1_ps(2147483648.0f);
+    const __m128 negbig = _mm_set1_ps(-2147483648.0f);
+    
+    for(; (i+4) <= n; i+=4)
+    {
+        __m128 p = _mm_mul_ps(_mm_loadu_ps(&f_num[i]), scale);
+        // the conversion truncates as the cast does and gives 0x80000000 out of range: only the positive side must be fixed
+        __m128 hi = _mm_cmpge_ps(p, posbig);
+        __m128 lo = _mm_cmplt_ps(p, negbig);
+        __m128i r = _mm_cvttps_epi32(p);
+        r = _mm_or_si128(_mm_andnot_si128(_mm_castps_si128(hi), r), _mm_and_si128(_mm_castps_si128(hi), _mm_set1_epi32(EOK_Q17_14_POS_BIGGEST)));
+        _mm_storeu_si128((__m128i*)&q_res[i], r);
+        clipped += eo_common_byte_bitsetcount((uint8_t)_mm_movemask_ps(_mm_or_ps(hi, lo)));
+    }
+#endif
+
+    for(; i<n; i++)
+    {
+        if(eores_OK != s_eo_common_float_to_Q17_14_clip(f_num[i], &q_res[i]))
+        {
+            clipped++;
+        }
+    }
+    
+    return(clipped);
+}
+
+
+extern void eo_common_Q17_14_batch_to_float(const eOq17_14_t *q_num, float *f_res, uint32_t n)
+{
+    uint32_t i = 0;
+    
+#if defined(__SSE2__)
+    // the multiplication by 2^-14 is exact as the division by 2^14 
+    const __m128 scale = _mm_set1_ps(1.0f / 16384.0f);
+    
+    for(; (i+4) <= n; i+=4)
+    {
+        __m128 f = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)&q_num[i]));
+        _mm_storeu_ps(&f_res[i], _mm_mul_ps(f, scale));
+    }
+#endif
+
+    for(; i<n; i++)
+    {
+        f_res[i] = eo_common_Q17_14_to_float(q_num[i]);
+    }
+}
+
+
+extern uint32_t eo_common_Q17_14_batch_add(const eOq17_14_t *q_num1, const eOq17_14_t *q_num2, eOq17_14_t *q_res, uint32_t n)
+{
+    uint32_t clipped = 0;
+    uint32_t i = 0;
+    
+#if defined(__SSE2__)
+    for(; (i+4) <= n; i+=4)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)&q_num1[i]);
+        __m128i b = _mm_loadu_si128((const __m128i*)&q_num2[i]);
+        __m128i s = _mm_add_epi32(a, b);
+        // the wrapped sum overflows if its sign differs from the one of both addends. it then clips towards that sign
+        __m128i ov = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, s), _mm_xor_si128(b, s)), 31);
+        __m128i sat = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(EOK_Q17_14_POS_BIGGEST));
+        s = _mm_or_si128(_mm_andnot_si128(ov, s), _mm_and_si128(ov, sat));
+        _mm_storeu_si128((__m128i*)&q_res[i], s);
+        clipped += eo_common_byte_bitsetcount((uint8_t)_mm_movemask_ps(_mm_castsi128_ps(ov)));
+    }
+#endif
+
+    for(; i<n; i++)
+    {
+        if(eores_OK != eo_common_Q17_14_add(q_num1[i], q_num2[i], &q_res[i]))
+        {
+            clipped++;
+        }
+    }
+    
+    return(clipped);
+}
+
+
+extern uint32_t eo_common_Q17_14_batch_multiply(const eOq17_14_t *q_num1, const eOq17_14_t *q_num2, eOq17_14_t *q_res, uint32_t n)
+{
+    uint32_t clipped = 0;
+    uint32_t i = 0;
+    
+#if defined(__SSE4_1__)
+    const __m128i half = _mm_set1_epi64x(1 << 13);
+    
+    for(; (i+4) <= n; i+=4)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)&q_num1[i]);
+        __m128i b = _mm_loadu_si128((const __m128i*)&q_num2[i]);
+        // the 64 bits products of items 0, 2 and of items 1, 3 plus the rounding
+        __m128i p02 = _mm_add_epi64(_mm_mul_epi32(a, b), half);
+        __m128i p13 = _mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), half);
+        // their low and high halves in the order of the items
+        __m128i t0 = _mm_unpacklo_epi32(p02, p13);
+        __m128i t1 = _mm_unpackhi_epi32(p02, p13);
+        __m128i lo = _mm_unpacklo_epi64(t0, t1);
+        __m128i hi = _mm_unpackhi_epi64(t0, t1);
+        // the product >> 14 fits 32 bits only if the bits [45, 63] of the product are all equal
+        __m128i r = _mm_or_si128(_mm_srli_epi32(lo, 14), _mm_slli_epi32(hi, 18));
+        __m128i sign = _mm_srai_epi32(hi, 31);
+        __m128i ov = _mm_xor_si128(_mm_cmpeq_epi32(_mm_srai_epi32(hi, 13), sign), _mm_set1_epi32(-1));
+        __m128i sat = _mm_xor_si128(sign, _mm_set1_epi32(EOK_Q17_14_POS_BIGGEST));
+        r = _mm_blendv_epi8(r, sat, ov);
+        _mm_storeu_si128((__m128i*)&q_res[i], r);
+        clipped += eo_common_byte_bitsetcount((uint8_t)_mm_movemask_ps(_mm_castsi128_ps(ov)));
+    }
+#endif
+
+    for(; i<n; i++)
+    {
+        if(eores_OK != eo_common_Q17_14_multiply(q_num1[i], q_num2[i], &q_res[i]))
+        {
+            clipped++;
+        }
+    }
+    
+    return(clipped);
+}
+
+
 extern uint64_t eo_common_canframe_data2u64(eOcanframe_t *frame)
 {
     if(NULL == frame)
@@ -682,6 +847,91 @@ extern uint8_t eo_common_map_str_str_u08__string2value(const eOmap_str_str_u08_t
     return(defvalue);
 }
 
+
+extern int16_t eo_common_map_str_str_u08__index_string2position(eOmap_str_str_u08_index_t * index, const char * string, eObool_t usestr0)
+{
+    uint8_t i = 0;
+    
+    if(NULL == string)
+    {
+        return(-1);
+    }
+    
+    if(eobool_true == s_eo_common_map_index_ready(index))
+    {
+        const uint8_t *slots = (eobool_true == usestr0) ? (&index->slots[0]) : (&index->slots[index->mask+1]);
+        uint8_t s = s_eo_common_map_index_hash(string) & index->mask;
+        
+        // the load is at most 1/2, thus there is always an empty slot which stops the search
+        for(; 0 != slots[s]; s = (s+1) & index->mask)
+        {
+            const eOmap_str_str_u08_t *item = s_eo_common_map_index_item(index, slots[s]-1);
+            const char * str = (eobool_true == usestr0) ? item->str0 : item->str1;
+            if(0 == strcmp(string, str))
+            {
+                return(slots[s]-1);
+            }
+        }
+        
+        return(-1);
+    }
+    
+    for(i=0; i<index->size; i++)
+    {
+        const eOmap_str_str_u08_t *item = s_eo_common_map_index_item(index, i);
+        const char * str = (eobool_true == usestr0) ? item->str0 : item->str1;
+        if(0 == strcmp(string, str))
+        {
+            return(i);
+        }
+    }
+    
+    return(-1);
+}
+
+
+extern uint8_t eo_common_map_str_str_u08__index_string2value(eOmap_str_str_u08_index_t * index, const char * string, eObool_t usestr0, uint8_t defvalue)
+{
+    int16_t pos = eo_common_map_str_str_u08__index_string2position(index, string, usestr0);
+    
+    return((pos < 0) ? defvalue : s_eo_common_map_index_item(index, (uint8_t)pos)->val0);
+}
+
+
+extern const char * eo_common_map_str_str_u08__index_value2string(eOmap_str_str_u08_index_t * index, uint8_t value, eObool_t usestr0)
+{
+    const eOmap_str_str_u08_t *item = NULL;
+    uint8_t i = 0;
+    
+    if(eobool_true == s_eo_common_map_index_ready(index))
+    {
+        const uint8_t *slots = &index->slots[2*(index->mask+1)];
+        uint8_t s = value & index->mask;
+        
+        for(; 0 != slots[s]; s = (s+1) & index->mask)
+        {
+            item = s_eo_common_map_index_item(index, slots[s]-1);
+            if(value == item->val0)
+            {
+                return((eobool_true == usestr0) ? item->str0 : item->str1);
+            }
+        }
+        
+        return(NULL);
+    }
+    
+    for(i=0; i<index->size; i++)
+    {
+        item = s_eo_common_map_index_item(index, i);
+        if(value == item->val0)
+        {
+            return((eobool_true == usestr0) ? item->str0 : item->str1);
+        }
+    }
+    
+    return(NULL);
+}
+
 extern eOipv4addr_t eo_common_ipv4addr(uint8_t ip1, uint8_t ip2, uint8_t ip3, uint8_t ip4)
 {
     return(EO_COMMON_IPV4ADDR(ip1, ip2, ip3, ip4));
@@ -708,6 +958,100 @@ extern eObool_t eo_common_event_check(eOevent_t event, eOevent_t mask)
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
 
+static eObool_t s_eo_common_map_index_ready(eOmap_str_str_u08_index_t * index)
+{   // the first caller builds the index. who arrives while it is being built uses the linear search
+    uint8_t state = eo_atomic_u08_Load(&index->state);
+    if((0 == state) && (eobool_true == eo_atomic_u08_CompareExchange(&index->state, 0, 1)))
+    {
+        s_eo_common_map_index_build(index);
+        state = eo_atomic_u08_Load(&index->state);
+    }
+    return((2 == state) ? eobool_true : eobool_false);
+}
+
+
+static void s_eo_common_map_index_build(eOmap_str_str_u08_index_t * index)
+{
+    const uint16_t numslots = (uint16_t)index->mask + 1;
+    uint8_t *slots0 = &index->slots[0];
+    uint8_t *slots1 = &index->slots[numslots];
+    uint8_t *slotsv = &index->slots[2*numslots];
+    uint8_t state = 2;
+    uint8_t i = 0;
+    uint8_t s = 0;
+    
+    if((NULL == index->slots) || (0 != (numslots & index->mask)) || (numslots < 2*(uint16_t)index->size) || (255 == index->size))
+    {
+        state = 3;
+    }
+    else
+    {
+        memset(index->slots, 0, 3*numslots);
+        
+        // if an item is repeated, only its first occurrence is kept. it is what the linear search finds
+        for(i=0; i<index->size; i++)
+        {
+            const eOmap_str_str_u08_t *item = s_eo_common_map_index_item(index, i);
+            
+            for(s = s_eo_common_map_index_hash(item->str0) & index->mask; 0 != slots0[s]; s = (s+1) & index->mask)
+            {
+                if(0 == strcmp(item->str0, s_eo_common_map_index_item(index, slots0[s]-1)->str0))
+                {
+                    break;
+                }
+            }
+            if(0 == slots0[s])
+            {
+                slots0[s] = i + 1;
+            }
+            
+            for(s = s_eo_common_map_index_hash(item->str1) & index->mask; 0 != slots1[s]; s = (s+1) & index->mask)
+            {
+                if(0 == strcmp(item->str1, s_eo_common_map_index_item(index, slots1[s]-1)->str1))
+                {
+                    break;
+                }
+            }
+            if(0 == slots1[s])
+            {
+                slots1[s] = i + 1;
+            }
+            
+            for(s = item->val0 & index->mask; 0 != slotsv[s]; s = (s+1) & index->mask)
+            {
+                if(item->val0 == s_eo_common_map_index_item(index, slotsv[s]-1)->val0)
+                {
+                    break;
+                }
+            }
+            if(0 == slotsv[s])
+            {
+                slotsv[s] = i + 1;
+            }
+        }
+    }
+
+    eo_atomic_u08_Store(&index->state, state);
+}
+
+
+static const eOmap_str_str_u08_t * s_eo_common_map_index_item(const eOmap_str_str_u08_index_t * index, uint8_t pos)
+{   // all the maps with two strings begin as eOmap_str_str_u08_t
+    return((const eOmap_str_str_u08_t *)((const uint8_t *)index->map + (uint32_t)pos * index->itemsize));
+}
+
+
+static uint32_t s_eo_common_map_index_hash(const char * string)
+{   // fnv-1a
+    uint32_t h = 2166136261u;
+    for(; 0 != *string; string++)
+    {
+        h = (h ^ (uint8_t)*string) * 16777619u;
+    }
+    // the upper bits are better mixed
+    return(h ^ (h >> 16));
+}
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
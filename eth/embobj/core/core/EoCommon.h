@@ -606,6 +606,31 @@ typedef struct
 } eOmap_int32_u08_t;
 
 
+/** @typedef    typedef struct eOmap_str_str_u08_index_t
+    @brief      it is a hash index of a map of type eOmap_str_str_u08_t, eOmap_str_str_u08_u08_t or eOmap_str_str_u08_u08_u08_t,
+                which makes the string to value and the value to string conversions independent from the size of the map.
+                the index is built at the first use inside the slots given by the user, which must be 
+                EO_COMMON_MAP_INDEX_SLOTS(numslots) bytes, where numslots is a power of two not smaller than twice the
+                size of the map and not bigger than 256. if they are not, the index works with a linear search. 
+                use the macro EO_COMMON_MAP_INDEX() to initialise it, as in:
+                static uint8_t s_slots[EO_COMMON_MAP_INDEX_SLOTS(64)] = {0};
+                static eOmap_str_str_u08_index_t s_index = EO_COMMON_MAP_INDEX(s_map, mapsize, 64, s_slots);
+ **/
+typedef struct
+{
+    const void *        map;        /**< the map: its items begin with str0, str1, val0 */
+    uint16_t            itemsize;   /**< the size of an item of the map */
+    uint8_t             size;       /**< the number of items of the map */
+    uint8_t             mask;       /**< the number of slots minus 1 */
+    volatile uint8_t    state;      /**< 0: to be built, 1: being built, 2: ready, 3: not usable */
+    uint8_t *           slots;      /**< three tables of slots for str0, str1 and val0. they keep 1 + position in map or 0 */
+} eOmap_str_str_u08_index_t;
+
+#define EO_COMMON_MAP_INDEX_SLOTS(numslots)                     (3*(numslots))
+
+#define EO_COMMON_MAP_INDEX(map, size, numslots, slots)         { (map), sizeof((map)[0]), (size), (uint8_t)((numslots)-1), 0, (slots) }
+
+
 // --
 
 typedef enum
@@ -782,6 +807,17 @@ extern eOresult_t eo_common_Q17_14_multiply(eOq17_14_t q_num1, eOq17_14_t q_num2
 
 extern eOresult_t eo_common_Q17_14_divide(eOq17_14_t q_num1, eOq17_14_t q_num2, eOq17_14_t *q_res);
 
+// the batch versions of the above work on arrays of n items and give bit exact results. they use sse2 or sse4.1
+// when the compiler targets them, otherwise plain c. the output array may be one of the inputs but must not partially 
+// overlap them. the ones which can clip return how many results were clipped.
+extern uint32_t eo_common_Q17_14_batch_from_float(const float *f_num, eOq17_14_t *q_res, uint32_t n);
+
+extern void eo_common_Q17_14_batch_to_float(const eOq17_14_t *q_num, float *f_res, uint32_t n);
+
+extern uint32_t eo_common_Q17_14_batch_add(const eOq17_14_t *q_num1, const eOq17_14_t *q_num2, eOq17_14_t *q_res, uint32_t n);
+
+extern uint32_t eo_common_Q17_14_batch_multiply(const eOq17_14_t *q_num1, const eOq17_14_t *q_num2, eOq17_14_t *q_res, uint32_t n);
+
 
 extern uint64_t eo_common_canframe_data2u64(eOcanframe_t *frame);
 
@@ -799,6 +835,13 @@ extern const char * eo_common_map_str_str_u08__value2string(const eOmap_str_str_
 
 extern uint8_t eo_common_map_str_str_u08__string2value(const eOmap_str_str_u08_t * map, uint8_t size, const char * string, eObool_t usestr0, uint8_t defvalue);
 
+// they behave as the above functions but use the index. the first one returns the position in map of the item or -1
+extern int16_t eo_common_map_str_str_u08__index_string2position(eOmap_str_str_u08_index_t * index, const char * string, eObool_t usestr0);
+
+extern uint8_t eo_common_map_str_str_u08__index_string2value(eOmap_str_str_u08_index_t * index, const char * string, eObool_t usestr0, uint8_t defvalue);
+
+extern const char * eo_common_map_str_str_u08__index_value2string(eOmap_str_str_u08_index_t * index, uint8_t value, eObool_t usestr0);
+
 
 extern eOipv4addr_t eo_common_ipv4addr(uint8_t ip1, uint8_t ip2, uint8_t ip3, uint8_t ip4);
 extern eOmacaddr_t eo_common_macaddr(uint8_t m1, uint8_t m2, uint8_t m3, uint8_t m4, uint8_t m5, uint8_t m6);
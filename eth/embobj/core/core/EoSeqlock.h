@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOSEQLOCK_H_
+#define _EOSEQLOCK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @file       EoSeqlock.h
+    @brief      This header file implements a sequence lock with inline functions only.
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_seqlock Sequence lock
+    The eOseqlock_t protects data which is written seldom and read often without ever blocking the readers.
+    The writer makes the sequence odd, changes the data and makes the sequence even again. The reader takes the
+    sequence before copying the data and checks after the copy that it has not changed: if it changed, the copy
+    may be torn and must be done again. More writers are serialised amongst themselves by a compare-and-swap on the
+    sequence, so a writer spins only against another writer.
+
+    The reader must only copy the protected data between eo_seqlock_ReadBegin() and eo_seqlock_ReadRetry() and use
+    it after the check, as in:
+    
+    @code
+    uint32_t s;
+    do
+    {
+        s = eo_seqlock_ReadBegin(&lock);
+        memcpy(&copy, &data, sizeof(copy));
+    } while(eo_seqlock_ReadRetry(&lock, s));
+    @endcode
+
+    The functions use the atomic operations of EoAtomic.h, so they build only on the compilers which it supports.
+    
+    @{        
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoAtomic.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+  
+
+// - declaration of public user-defined types ------------------------------------------------------------------------- 
+
+/** @typedef    typedef struct eOseqlock_t
+    @brief      eOseqlock_t contains the sequence. it is odd while a writer is changing the protected data.
+ **/
+typedef struct
+{
+    volatile uint32_t   sequence;
+} eOseqlock_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         EO_static_inline void eo_seqlock_Init(eOseqlock_t *l)
+    @brief      initialises the lock with an even sequence.
+ **/
+EO_static_inline void eo_seqlock_Init(eOseqlock_t *l)
+{
+    l->sequence = 0;
+}
+
+
+/** @fn         EO_static_inline void eo_seqlock_WriteBegin(eOseqlock_t *l)
+    @brief      marks the start of a write. it spins while another writer is inside.
+ **/
+EO_static_inline void eo_seqlock_WriteBegin(eOseqlock_t *l)
+{
+    uint32_t s = 0;
+    for(;;)
+    {
+        s = eo_atomic_u32_Load(&l->sequence);
+        if((0 == (s & 1)) && (eobool_true == eo_atomic_u32_CompareExchange(&l->sequence, s, s+1)))
+        {
+            break;
+        }
+    }
+    // the stores to the data must not be seen before the odd sequence
+    eo_atomic_FenceRelease();
+}
+
+
+/** @fn         EO_static_inline void eo_seqlock_WriteEnd(eOseqlock_t *l)
+    @brief      marks the end of a write and makes the sequence even again.
+ **/
+EO_static_inline void eo_seqlock_WriteEnd(eOseqlock_t *l)
+{
+    eo_atomic_u32_Store(&l->sequence, l->sequence+1);
+}
+
+
+/** @fn         EO_static_inline uint32_t eo_seqlock_ReadBegin(const eOseqlock_t *l)
+    @brief      marks the start of a read. it spins while a writer is inside.
+    @return     the sequence to be given to eo_seqlock_ReadRetry().
+ **/
+EO_static_inline uint32_t eo_seqlock_ReadBegin(const eOseqlock_t *l)
+{
+    uint32_t s;
+    while(0 != ((s = eo_atomic_u32_Load(&l->sequence)) & 1))
+    {
+        ;
+    }
+    return(s);
+}
+
+
+/** @fn         EO_static_inline eObool_t eo_seqlock_ReadRetry(const eOseqlock_t *l, uint32_t start)
+    @brief      marks the end of a read.
+    @param      start       the value returned by eo_seqlock_ReadBegin()
+    @return     eobool_true if a writer has changed the data during the read, which must then be done again.
+ **/
+EO_static_inline eObool_t eo_seqlock_ReadRetry(const eOseqlock_t *l, uint32_t start)
+{
+    // the loads of the data must be completed before the sequence is read again
+    eo_atomic_FenceAcquire();
+    return((start != eo_atomic_u32_Load(&l->sequence)) ? eobool_true : eobool_false);
+}
+
+
+/** @}            
+    end of group eo_seqlock  
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif 
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
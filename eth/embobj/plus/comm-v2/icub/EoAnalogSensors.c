@@ -106,6 +106,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_postypes[] =
     {"none", "eoas_pos_TYPE_none", eoas_pos_TYPE_none},
     {"unknown", "eoas_pos_TYPE_unknown", eoas_pos_TYPE_unknown}    
 };  EO_VERIFYsizeof(s_boards_map_of_postypes, (eoas_pos_TYPE_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_postypes[EO_COMMON_MAP_INDEX_SLOTS(8)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_postypes = EO_COMMON_MAP_INDEX(s_boards_map_of_postypes, eoas_pos_TYPE_numberof+2, 8, s_boards_slots_of_postypes);
 
 
 static const eOmap_str_str_u08_t s_boards_map_of_posrots[] =
@@ -119,6 +121,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_posrots[] =
     {"unknown", "eoas_pos_ROT_unknown", eoas_pos_ROT_unknown}
     
 };  EO_VERIFYsizeof(s_boards_map_of_posrots, (eoas_pos_ROT_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_posrots[EO_COMMON_MAP_INDEX_SLOTS(16)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_posrots = EO_COMMON_MAP_INDEX(s_boards_map_of_posrots, eoas_pos_ROT_numberof+2, 16, s_boards_slots_of_posrots);
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables
@@ -179,7 +183,7 @@ extern const char * eoas_postype2string(eoas_pos_TYPE_t postype, eObool_t usecom
     const eOmap_str_str_u08_t * map = s_boards_map_of_postypes;
     const uint8_t size = eoas_pos_TYPE_numberof+2;
     const uint8_t value = postype;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_postypes, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -192,11 +196,9 @@ extern const char * eoas_postype2string(eoas_pos_TYPE_t postype, eObool_t usecom
 
 extern eoas_pos_TYPE_t eoas_string2postype(const char * string, eObool_t usecompactstring)
 {    
-    const eOmap_str_str_u08_t * map = s_boards_map_of_postypes;
-    const uint8_t size = eoas_pos_TYPE_numberof+2;
     const uint8_t defvalue = eoas_pos_TYPE_unknown;
     
-    return((eoas_pos_TYPE_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));     
+    return((eoas_pos_TYPE_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_postypes, string, usecompactstring, defvalue));     
 }
 
 extern const char * eoas_posrot2string(eoas_pos_ROT_t posrot, eObool_t usecompactstring)
@@ -204,7 +206,7 @@ extern const char * eoas_posrot2string(eoas_pos_ROT_t posrot, eObool_t usecompac
     const eOmap_str_str_u08_t * map = s_boards_map_of_posrots;
     const uint8_t size = eoas_pos_ROT_numberof+2;
     const uint8_t value = posrot;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_posrots, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -217,11 +219,9 @@ extern const char * eoas_posrot2string(eoas_pos_ROT_t posrot, eObool_t usecompac
 
 extern eoas_pos_ROT_t eoas_string2posrot(const char * string, eObool_t usecompactstring)
 {    
-    const eOmap_str_str_u08_t * map = s_boards_map_of_posrots;
-    const uint8_t size = eoas_pos_ROT_numberof+2;
     const uint8_t defvalue = eoas_pos_ROT_unknown;
     
-    return((eoas_pos_ROT_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));    
+    return((eoas_pos_ROT_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_posrots, string, usecompactstring, defvalue));    
 }
 
 enum { in3_mtb_pos = 0, in3_mtb4_pos = 1, in3_strain2_pos = 2, in3_rfe_pos = 3, in3_mtb4c_pos = 4, in3_strain2c_pos = 5 };
@@ -139,6 +139,8 @@ static const eOmap_str_str_u08_t s_eoboards_map_of_boards[] =
     {"none", "eobrd_none", eobrd_none},
     {"unknown", "eobrd_unknown", eobrd_unknown}
 };  EO_VERIFYsizeof(s_eoboards_map_of_boards, (eobrd_type_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_eoboards_slots_of_boards[EO_COMMON_MAP_INDEX_SLOTS(64)] = {0};
+static eOmap_str_str_u08_index_t s_eoboards_index_of_boards = EO_COMMON_MAP_INDEX(s_eoboards_map_of_boards, eobrd_type_numberof+2, 64, s_eoboards_slots_of_boards);
 
 // just to check that the number of can type board is lower than 32 otherwise we go up to the ems.
 // if that happens, the can boards will have a hole between [32, 63] ...
@@ -193,6 +195,8 @@ static const eOmap_str_str_u08_t s_eoboards_map_of_connectors[] =
     {"none", "eobrd_conn_none", eobrd_conn_none},
     {"unknown", "eobrd_conn_unknown", eobrd_conn_unknown}
 };  EO_VERIFYsizeof(s_eoboards_map_of_connectors, (eobrd_connectors_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_eoboards_slots_of_connectors[EO_COMMON_MAP_INDEX_SLOTS(128)] = {0};
+static eOmap_str_str_u08_index_t s_eoboards_index_of_connectors = EO_COMMON_MAP_INDEX(s_eoboards_map_of_connectors, eobrd_connectors_numberof+2, 128, s_eoboards_slots_of_connectors);
 
 
 static const eOmap_str_str_u08_u08_u08_t s_eoboards_map_of_ports[] =
@@ -263,6 +267,8 @@ static const eOmap_str_str_u08_u08_u08_t s_eoboards_map_of_ports[] =
     {"none", "eobrd_port_none", eobrd_port_none, eobrd_none, eobrd_conn_none},
     {"unknown", "eobrd_port_unknown", eobrd_port_unknown, eobrd_unknown, eobrd_conn_unknown}
 };  EO_VERIFYsizeof(s_eoboards_map_of_ports, (eobrd_ports_numberof+2)*sizeof(eOmap_str_str_u08_u08_u08_t))
+static uint8_t s_eoboards_slots_of_ports[EO_COMMON_MAP_INDEX_SLOTS(128)] = {0};
+static eOmap_str_str_u08_index_t s_eoboards_index_of_ports = EO_COMMON_MAP_INDEX(s_eoboards_map_of_ports, eobrd_ports_numberof+2, 128, s_eoboards_slots_of_ports);
 
 
 static const eOmap_str_str_u08_t s_boards_map_of_portmaiss[] =
@@ -278,6 +284,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_portmaiss[] =
     {"none", "eobrd_portmais_none", eobrd_portmais_none},
     {"unknown", "eobrd_portmais_unknown", eobrd_portmais_unknown}    
 };  EO_VERIFYsizeof(s_boards_map_of_portmaiss, (eobrd_portmaiss_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_portmaiss[EO_COMMON_MAP_INDEX_SLOTS(32)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_portmaiss = EO_COMMON_MAP_INDEX(s_boards_map_of_portmaiss, eobrd_portmaiss_numberof+2, 32, s_boards_slots_of_portmaiss);
 
 
 static const eOmap_str_str_u08_t s_boards_map_of_portpscs[] =
@@ -288,6 +296,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_portpscs[] =
     {"none", "eobrd_portpsc_none", eobrd_portpsc_none},
     {"unknown", "eobrd_portpsc_unknown", eobrd_portpsc_unknown}    
 };  EO_VERIFYsizeof(s_boards_map_of_portpscs, (eobrd_portpscs_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_portpscs[EO_COMMON_MAP_INDEX_SLOTS(8)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_portpscs = EO_COMMON_MAP_INDEX(s_boards_map_of_portpscs, eobrd_portpscs_numberof+2, 8, s_boards_slots_of_portpscs);
 
 
 static const eOmap_str_str_u08_t s_boards_map_of_portposs[] =
@@ -303,6 +313,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_portposs[] =
     {"none", "eobrd_portpos_none", eobrd_portpos_none},
     {"unknown", "eobrd_portpos_unknown", eobrd_portpos_unknown}    
 };  EO_VERIFYsizeof(s_boards_map_of_portposs, (eobrd_portposs_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_portposs[EO_COMMON_MAP_INDEX_SLOTS(32)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_portposs = EO_COMMON_MAP_INDEX(s_boards_map_of_portposs, eobrd_portposs_numberof+2, 32, s_boards_slots_of_portposs);
 
 
 static const eOmap_str_str_u08_t s_boards_map_of_reportmodes[] =
@@ -315,6 +327,8 @@ static const eOmap_str_str_u08_t s_boards_map_of_reportmodes[] =
     {"none", "eobrd_canmonitor_reportmode_none", eobrd_canmonitor_reportmode_none},
     {"unknown", "eobrd_canmonitor_reportmode_unknown", eobrd_canmonitor_reportmode_unknown}    
 };  EO_VERIFYsizeof(s_boards_map_of_reportmodes, (eobrd_reportmodes_numberof+2)*sizeof(eOmap_str_str_u08_t))
+static uint8_t s_boards_slots_of_reportmodes[EO_COMMON_MAP_INDEX_SLOTS(16)] = {0};
+static eOmap_str_str_u08_index_t s_boards_index_of_reportmodes = EO_COMMON_MAP_INDEX(s_boards_map_of_reportmodes, eobrd_reportmodes_numberof+2, 16, s_boards_slots_of_reportmodes);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -406,11 +420,9 @@ extern const char * eoboards_type2string(eObrd_type_t type)
 
 extern eObrd_type_t eoboards_string2type2(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eoboards_map_of_boards;
-    const uint8_t size = eobrd_type_numberof+2;
     const uint8_t defvalue = eobrd_unknown;
     
-    return((eObrd_type_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));    
+    return((eObrd_type_t)eo_common_map_str_str_u08__index_string2value(&s_eoboards_index_of_boards, string, usecompactstring, defvalue));    
 }
 
 
@@ -419,7 +431,7 @@ extern const char * eoboards_type2string2(eObrd_type_t type, eObool_t usecompact
     const eOmap_str_str_u08_t * map = s_eoboards_map_of_boards;
     const uint8_t size = eobrd_type_numberof+2;
     const uint8_t value = type;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eoboards_index_of_boards, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -432,11 +444,9 @@ extern const char * eoboards_type2string2(eObrd_type_t type, eObool_t usecompact
 
 extern eObrd_connector_t eoboards_string2connector(const char * string, eObool_t usecompactstring)
 {    
-    const eOmap_str_str_u08_t * map = s_eoboards_map_of_connectors;
-    const uint8_t size = eobrd_connectors_numberof+2;
     const uint8_t defvalue = eobrd_conn_unknown;
     
-    return((eObrd_connector_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eObrd_connector_t)eo_common_map_str_str_u08__index_string2value(&s_eoboards_index_of_connectors, string, usecompactstring, defvalue));
 }
 
 
@@ -445,7 +455,7 @@ extern const char * eoboards_connector2string(eObrd_connector_t connector, eOboo
     const eOmap_str_str_u08_t * map = s_eoboards_map_of_connectors;
     const uint8_t size = eobrd_connectors_numberof+2;
     const uint8_t value = connector;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eoboards_index_of_connectors, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -459,25 +469,10 @@ extern const char * eoboards_connector2string(eObrd_connector_t connector, eOboo
 extern eObrd_port_t eoboards_string2port(const char * string, eObool_t usecompactstring)
 {    
     const eOmap_str_str_u08_u08_u08_t * map = s_eoboards_map_of_ports;
-    const uint8_t size = eobrd_ports_numberof+2;
     const uint8_t defvalue = eobrd_port_unknown;    
+    int16_t pos = eo_common_map_str_str_u08__index_string2position(&s_eoboards_index_of_ports, string, usecompactstring);
     
-    uint8_t i = 0;    
-    if(NULL == string)
-    {
-        return((eObrd_port_t)defvalue);
-    }
-      
-    for(i=0; i<size; i++)
-    {
-        const char * str = (eobool_true == usecompactstring) ? map[i].str0 : map[i].str1;
-        if(0 == strcmp(string, str))
-        {
-            return((eObrd_port_t)map[i].val0);
-        }
-    }
-    
-    return((eObrd_port_t)defvalue);       
+    return((pos < 0) ? ((eObrd_port_t)defvalue) : ((eObrd_port_t)map[pos].val0));       
 }
 
 
@@ -582,7 +577,7 @@ extern const char * eoboards_portmais2string(eObrd_portmais_t portmais, eObool_t
     const eOmap_str_str_u08_t * map = s_boards_map_of_portmaiss;
     const uint8_t size = eobrd_portmaiss_numberof+2;
     const uint8_t value = portmais;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_portmaiss, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -595,11 +590,9 @@ extern const char * eoboards_portmais2string(eObrd_portmais_t portmais, eObool_t
 
 extern eObrd_portmais_t eoboards_string2portmais(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_boards_map_of_portmaiss;
-    const uint8_t size = eobrd_portmaiss_numberof+2;
     const uint8_t defvalue = eobrd_portmais_unknown;
     
-    return((eObrd_portmais_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));        
+    return((eObrd_portmais_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_portmaiss, string, usecompactstring, defvalue));        
 }
 
 
@@ -608,7 +601,7 @@ extern const char * eoboards_portpsc2string(eObrd_portpsc_t portpsc, eObool_t us
     const eOmap_str_str_u08_t * map = s_boards_map_of_portpscs;
     const uint8_t size = eobrd_portpscs_numberof+2;
     const uint8_t value = portpsc;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_portpscs, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -621,11 +614,9 @@ extern const char * eoboards_portpsc2string(eObrd_portpsc_t portpsc, eObool_t us
 
 extern eObrd_portpsc_t eoboards_string2portpsc(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_boards_map_of_portpscs;
-    const uint8_t size = eobrd_portpscs_numberof+2;
     const uint8_t defvalue = eobrd_portpsc_unknown;
     
-    return((eObrd_portpsc_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));        
+    return((eObrd_portpsc_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_portpscs, string, usecompactstring, defvalue));        
 }
 
 
@@ -634,7 +625,7 @@ extern const char * eoboards_portpos2string(eObrd_portpos_t portpos, eObool_t us
     const eOmap_str_str_u08_t * map = s_boards_map_of_portposs;
     const uint8_t size = eobrd_portposs_numberof+2;
     const uint8_t value = portpos;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_portposs, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -647,11 +638,9 @@ extern const char * eoboards_portpos2string(eObrd_portpos_t portpos, eObool_t us
 
 extern eObrd_portpos_t eoboards_string2portpos(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_boards_map_of_portposs;
-    const uint8_t size = eobrd_portposs_numberof+2;
     const uint8_t defvalue = eobrd_portpos_unknown;
     
-    return((eObrd_portpos_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));        
+    return((eObrd_portpos_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_portposs, string, usecompactstring, defvalue));        
 }
 
 extern const char * eoboards_reportmode2string(eObrd_canmonitor_reportmode_t mode, eObool_t usecompactstring)
@@ -659,7 +648,7 @@ extern const char * eoboards_reportmode2string(eObrd_canmonitor_reportmode_t mod
     const eOmap_str_str_u08_t * map = s_boards_map_of_reportmodes;
     const uint8_t size = eobrd_reportmodes_numberof+2;
     const uint8_t value = mode;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_boards_index_of_reportmodes, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -672,11 +661,9 @@ extern const char * eoboards_reportmode2string(eObrd_canmonitor_reportmode_t mod
 
 extern eObrd_canmonitor_reportmode_t eoboards_string2reportmode(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_boards_map_of_reportmodes;
-    const uint8_t size = eobrd_reportmodes_numberof+2;
     const uint8_t defvalue = eobrd_canmonitor_reportmode_unknown;
     
-    return((eObrd_canmonitor_reportmode_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));        
+    return((eObrd_canmonitor_reportmode_t)eo_common_map_str_str_u08__index_string2value(&s_boards_index_of_reportmodes, string, usecompactstring, defvalue));        
 }
 
 extern uint8_t eoboards_type2numberofcores(eObrd_type_t type)
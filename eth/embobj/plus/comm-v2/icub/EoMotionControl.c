@@ -78,6 +78,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_actuators[] =
     {"none", "eomc_act_none", eomc_act_none},
     {"unknown", "eomc_act_unknown", eomc_act_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_actuators, (eomc_actuators_numberof+2)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_actuators[EO_COMMON_MAP_INDEX_SLOTS(16)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_actuators = EO_COMMON_MAP_INDEX(s_eomc_map_of_actuators, eomc_actuators_numberof+2, 16, s_eomc_slots_of_actuators);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_encoders[] =
@@ -100,6 +102,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_encoders[] =
     {"none", "eomc_enc_none", eomc_enc_none},
     {"unknown", "eomc_enc_unknown", eomc_enc_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_encoders, (eomc_encoders_numberof+2)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_encoders[EO_COMMON_MAP_INDEX_SLOTS(32)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_encoders = EO_COMMON_MAP_INDEX(s_eomc_map_of_encoders, eomc_encoders_numberof+2, 32, s_eomc_slots_of_encoders);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_positions[] =
@@ -110,6 +114,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_positions[] =
     {"none", "eomc_pos_none", eomc_pos_none},
     {"unknown", "eomc_pos_unknown", eomc_pos_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_positions, (eomc_positions_numberof+2)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_positions[EO_COMMON_MAP_INDEX_SLOTS(8)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_positions = EO_COMMON_MAP_INDEX(s_eomc_map_of_positions, eomc_positions_numberof+2, 8, s_eomc_slots_of_positions);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_ctrlboards[] =
@@ -137,6 +143,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_ctrlboards[] =
     {"none", "eomc_ctrlboard_none", eomc_ctrlboard_none},
     {"unknown", "eomc_ctrlboard_unknown", eomc_ctrlboard_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_ctrlboards, (eomc_ctrlboards_numberof+2)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_ctrlboards[EO_COMMON_MAP_INDEX_SLOTS(64)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_ctrlboards = EO_COMMON_MAP_INDEX(s_eomc_map_of_ctrlboards, eomc_ctrlboards_numberof+2, 64, s_eomc_slots_of_ctrlboards);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_mc4broadcasts[] =
@@ -150,6 +158,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_mc4broadcasts[] =
     {"none", "eomc_mc4broadcast_none", eomc_mc4broadcast_none},
     {"unknown", "eomc_mc4broadcast_unknown", eomc_mc4broadcast_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_mc4broadcasts, (eomc_mc4broadcasts_numberof+2)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_mc4broadcasts[EO_COMMON_MAP_INDEX_SLOTS(16)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_mc4broadcasts = EO_COMMON_MAP_INDEX(s_eomc_map_of_mc4broadcasts, eomc_mc4broadcasts_numberof+2, 16, s_eomc_slots_of_mc4broadcasts);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_pidoutputtypes[] =
@@ -161,6 +171,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_pidoutputtypes[] =
     {"unknown", "eomc_pidoutputtype_unknown", eomc_pidoutputtype_unknown}
 
 };  EO_VERIFYsizeof(s_eomc_map_of_pidoutputtypes, (eomc_pidoutputtypes_numberof +1)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_pidoutputtypes[EO_COMMON_MAP_INDEX_SLOTS(8)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_pidoutputtypes = EO_COMMON_MAP_INDEX(s_eomc_map_of_pidoutputtypes, eomc_pidoutputtypes_numberof +1, 8, s_eomc_slots_of_pidoutputtypes);
 
 
 static const eOmap_str_str_u08_t s_eomc_map_of_jsetconstraints[] =
@@ -173,6 +185,8 @@ static const eOmap_str_str_u08_t s_eomc_map_of_jsetconstraints[] =
     
     {"unknown", "eomc_jsetconstraint_unknown", eomc_jsetconstraint_unknown}
 };  EO_VERIFYsizeof(s_eomc_map_of_jsetconstraints, (eomc_jsetconstraints_numberof + 1)*sizeof(eOmap_str_str_u08_t));
+static uint8_t s_eomc_slots_of_jsetconstraints[EO_COMMON_MAP_INDEX_SLOTS(16)] = {0};
+static eOmap_str_str_u08_index_t s_eomc_index_of_jsetconstraints = EO_COMMON_MAP_INDEX(s_eomc_map_of_jsetconstraints, eomc_jsetconstraints_numberof + 1, 16, s_eomc_slots_of_jsetconstraints);
 
 static const eOmap_int32_u08_t s_eomc_map_of_calib14rot[] =
 {
@@ -203,7 +217,7 @@ extern const char * eomc_actuator2string(eOmc_actuator_t actuator, eObool_t usec
     const eOmap_str_str_u08_t * map = s_eomc_map_of_actuators;
     const uint8_t size = eomc_actuators_numberof+2;
     const uint8_t value = actuator;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_actuators, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -216,11 +230,9 @@ extern const char * eomc_actuator2string(eOmc_actuator_t actuator, eObool_t usec
 
 extern eOmc_actuator_t eomc_string2actuator(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_actuators;
-    const uint8_t size = eomc_actuators_numberof+2;
     const uint8_t defvalue = eomc_act_unknown;
     
-    return((eOmc_actuator_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_actuator_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_actuators, string, usecompactstring, defvalue));
 }
 
 
@@ -229,7 +241,7 @@ extern const char * eomc_encoder2string(eOmc_encoder_t encoder, eObool_t usecomp
     const eOmap_str_str_u08_t * map = s_eomc_map_of_encoders;
     const uint8_t size = eomc_encoders_numberof+2;
     const uint8_t value = encoder;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_encoders, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -242,11 +254,9 @@ extern const char * eomc_encoder2string(eOmc_encoder_t encoder, eObool_t usecomp
 
 extern eOmc_encoder_t eomc_string2encoder(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_encoders;
-    const uint8_t size = eomc_encoders_numberof+2;
     const uint8_t defvalue = eomc_enc_unknown;
     
-    return((eOmc_encoder_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_encoder_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_encoders, string, usecompactstring, defvalue));
 }
 
 
@@ -255,7 +265,7 @@ extern const char * eomc_position2string(eOmc_position_t position, eObool_t usec
     const eOmap_str_str_u08_t * map = s_eomc_map_of_positions;
     const uint8_t size = eomc_positions_numberof+2;
     const uint8_t value = position;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_positions, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -268,11 +278,9 @@ extern const char * eomc_position2string(eOmc_position_t position, eObool_t usec
 
 extern eOmc_position_t eomc_string2position(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_positions;
-    const uint8_t size = eomc_positions_numberof+2;
     const uint8_t defvalue = eomc_pos_unknown; 
     
-    return((eOmc_position_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));    
+    return((eOmc_position_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_positions, string, usecompactstring, defvalue));    
 }
 
 
@@ -327,11 +335,9 @@ extern uint8_t eomc_encoder_get_numberofcomponents(eOmc_encoder_t encoder)
 
 extern eOmc_ctrlboard_t eomc_string2controllerboard(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_ctrlboards;
-    const uint8_t size = eomc_ctrlboards_numberof+2;
     const uint8_t defvalue = eomc_ctrlboard_unknown;
     
-    return((eOmc_ctrlboard_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_ctrlboard_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_ctrlboards, string, usecompactstring, defvalue));
 }
 
 
@@ -340,7 +346,7 @@ extern const char * eomc_controllerboard2string(eOmc_ctrlboard_t ctrlboard, eObo
     const eOmap_str_str_u08_t * map = s_eomc_map_of_ctrlboards;
     const uint8_t size = eomc_ctrlboards_numberof+2;
     const uint8_t value = ctrlboard;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_ctrlboards, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -353,11 +359,9 @@ extern const char * eomc_controllerboard2string(eOmc_ctrlboard_t ctrlboard, eObo
 
 extern eOmc_mc4broadcast_t eomc_string2mc4broadcast(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_mc4broadcasts;
-    const uint8_t size = eomc_mc4broadcasts_numberof+2;
     const uint8_t defvalue = eomc_mc4broadcast_unknown;
     
-    return((eOmc_mc4broadcast_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_mc4broadcast_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_mc4broadcasts, string, usecompactstring, defvalue));
 }
 
 
@@ -366,7 +370,7 @@ extern const char * eomc_mc4broadcast2string(eOmc_mc4broadcast_t mode, eObool_t
     const eOmap_str_str_u08_t * map = s_eomc_map_of_mc4broadcasts;
     const uint8_t size = eomc_mc4broadcasts_numberof+2;
     const uint8_t value = mode;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_mc4broadcasts, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -378,11 +382,9 @@ extern const char * eomc_mc4broadcast2string(eOmc_mc4broadcast_t mode, eObool_t
 
 extern eOmc_pidoutputtype_t eomc_string2pidoutputtype(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_pidoutputtypes;
-    const uint8_t size = eomc_pidoutputtypes_numberof+1;
     const uint8_t defvalue = eomc_pidoutputtype_unknown;
     
-    return((eOmc_pidoutputtype_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_pidoutputtype_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_pidoutputtypes, string, usecompactstring, defvalue));
 }
 
 
@@ -391,7 +393,7 @@ extern const char * eomc_pidoutputtype2string(eOmc_pidoutputtype_t pidoutputtype
     const eOmap_str_str_u08_t * map = s_eomc_map_of_pidoutputtypes;
     const uint8_t size = eomc_pidoutputtypes_numberof+1;
     const uint8_t value = pidoutputtype;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_pidoutputtypes, value, usecompactstring);
     
     if(NULL == str)
     {
@@ -404,20 +406,18 @@ extern const char * eomc_pidoutputtype2string(eOmc_pidoutputtype_t pidoutputtype
 
 extern eOmc_jsetconstraint_t eomc_string2jsetconstraint(const char * string, eObool_t usecompactstring)
 {
-    const eOmap_str_str_u08_t * map = s_eomc_map_of_jsetconstraints;
-    const uint8_t size = eomc_jsetconstraints_numberof+1;
     const uint8_t defvalue = eomc_jsetconstraint_unknown;
     
-    return((eOmc_jsetconstraint_t)eo_common_map_str_str_u08__string2value(map, size, string, usecompactstring, defvalue));
+    return((eOmc_jsetconstraint_t)eo_common_map_str_str_u08__index_string2value(&s_eomc_index_of_jsetconstraints, string, usecompactstring, defvalue));
 }
 
 
 extern const char * eomc_jsetconstraint2string(eOmc_jsetconstraint_t jsetconstraint, eObool_t usecompactstring)
 {
     const eOmap_str_str_u08_t * map = s_eomc_map_of_jsetconstraints;
-    const uint8_t size = eomc_jsetconstraints_numberof+2;
+    const uint8_t size = eomc_jsetconstraints_numberof+1;
     const uint8_t value = jsetconstraint;
-    const char * str = eo_common_map_str_str_u08__value2string(map, size, value, usecompactstring);
+    const char * str = eo_common_map_str_str_u08__index_value2string(&s_eomc_index_of_jsetconstraints, value, usecompactstring);
     
     if(NULL == str)
     {
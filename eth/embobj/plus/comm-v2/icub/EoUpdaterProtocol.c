@@ -249,6 +249,65 @@ extern uint32_t eouprot_get_capabilities(eOuprot_process_t proc, uint8_t protoco
                 uprot_canDO_LEGACY_cangateway
             ),
             
+            (   // eApplPROGupdater            
+                uprot_canDO_reply2discover |
+                uprot_canDO_reply2moreinfo |
+                uprot_canDO_PROG_updater |                 
+                uprot_canDO_restart | 
+                uprot_canDO_IPaddr_set |
+                uprot_canDO_DEF2RUN_set |
+                uprot_canDO_JUMP2UPDATER |
+                uprot_canDO_LEGACY_IPmask_set |
+                uprot_canDO_LEGACY_MAC_set |                
+                uprot_canDO_LEGACY_scan |
+                uprot_canDO_LEGACY_IPaddr_set |
+                uprot_canDO_LEGACY_procs |
+                uprot_canDO_blink |
+                uprot_canDO_PAGE_get |
+                uprot_canDO_JUMP2ADDRESS
+            )
+        },
+        {   // version 3: the same as version 2. uprot_canDO_PROG_window is not here: the firmware which implements the
+            // windowed programming adds it to the capabilities it sends back
+            
+            (   // eLoader
+                uprot_canDO_nothing
+            ),
+            
+            (   // eUpdater
+                uprot_canDO_reply2discover |
+                uprot_canDO_reply2moreinfo |
+                uprot_canDO_PROG_loader | 
+                uprot_canDO_PROG_application |
+                uprot_canDO_restart | 
+                uprot_canDO_cangateway |
+                uprot_canDO_IPaddr_set |
+                uprot_canDO_EEPROM_erase |
+                uprot_canDO_EEPROM_read |
+                uprot_canDO_DEF2RUN_set |
+                uprot_canDO_PAGE_get |
+                uprot_canDO_PAGE_set |
+                uprot_canDO_PAGE_clr |
+                uprot_canDO_LEGACY_IPmask_set |
+                uprot_canDO_LEGACY_MAC_set |
+                uprot_canDO_LEGACY_cangateway |
+                uprot_canDO_LEGACY_scan |
+                uprot_canDO_LEGACY_IPaddr_set |
+                uprot_canDO_LEGACY_EEPROM_erase |
+                uprot_canDO_LEGACY_procs |
+                uprot_canDO_blink |
+                uprot_canDO_JUMP2ADDRESS
+            ),
+            
+            (   // eApplication
+                uprot_canDO_reply2discover |
+                uprot_canDO_reply2moreinfo |
+                uprot_canDO_LEGACY_scan |
+                uprot_canDO_restart |
+                uprot_canDO_cangateway |
+                uprot_canDO_LEGACY_cangateway
+            ),
+            
             (   // eApplPROGupdater            
                 uprot_canDO_reply2discover |
                 uprot_canDO_reply2moreinfo |
@@ -354,6 +413,28 @@ extern eObool_t eouprot_can_process_opcode(eOuprot_process_t proc, uint8_t proto
             }       
         } break;
 
+        case uprot_OPC_PROG_WIN_DATA:
+        case uprot_OPC_PROG_WIN_START: 
+        case uprot_OPC_PROG_WIN_END:
+        {
+            if(uprot_partitionLOADER == param)
+            {
+                targetcapability = uprot_canDO_PROG_loader | uprot_canDO_PROG_window; 
+            }
+            else if(uprot_partitionUPDATER == param)
+            {
+                targetcapability = uprot_canDO_PROG_updater | uprot_canDO_PROG_window;                
+            }
+            else if(uprot_partitionAPPLICATION == param)
+            {
+                targetcapability = uprot_canDO_PROG_application | uprot_canDO_PROG_window;
+            }
+            else
+            {
+                targetcapability = uprot_canDO_PROG_window;
+            }
+        } break;
+
         case uprot_OPC_DEF2RUN:
         {
             targetcapability = uprot_canDO_DEF2RUN_set;
@@ -474,8 +555,89 @@ extern eOuprot_process_t eouprot_raw2process(uint8_t rawvalue)
 }
 
 
+extern void eouprot_progwin_init(eOuprot_progwin_t *w, uint8_t window)
+{
+    if(NULL == w)
+    {
+        return;
+    }
+    
+    w->cumulative = 0;
+    w->window = (window > uprot_PROGWINmaxsize) ? (uprot_PROGWINmaxsize) : (window);
+    w->filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+    w->received = 0;
+}
+
+
+extern eObool_t eouprot_progwin_accept(eOuprot_progwin_t *w, uint16_t seqnum)
+{
+    uint16_t distance = 0;
+    
+    if((NULL == w) || (seqnum < w->cumulative))
+    {   // already received
+        return(eobool_false);
+    }
+    
+    distance = seqnum - w->cumulative;
+    
+    if(0 == distance)
+    {   // it is the first missing: cumulative moves forward also over the ones already received after it
+        w->cumulative++;
+        while(0 != (w->received & 0x1))
+        {
+            w->received >>= 1;
+            w->cumulative++;
+        }
+        w->received >>= 1;
+        return(eobool_true);
+    }
+    
+    if((distance >= w->window) || (distance > 32))
+    {   // outside the window
+        return(eobool_false);
+    }
+    
+    if(0 != (w->received & (0x1UL << (distance-1))))
+    {
+        return(eobool_false);
+    }
+    
+    w->received |= (0x1UL << (distance-1));
+    return(eobool_true);
+}
+
+
+extern void eouprot_progwin_fillack(const eOuprot_progwin_t *w, uint16_t seqnum, eOuprot_result_t res, eOuprot_cmd_PROG_WIN_ACK_t *ack)
+{
+    if((NULL == w) || (NULL == ack))
+    {
+        return;
+    }
+    
+    ack->reply.opc = uprot_OPC_PROG_WIN_DATA;
+    ack->reply.res = res;
+    ack->reply.protversion = EOUPROT_PROTOCOL_VERSION;
+    ack->reply.sizeofextra = sizeof(eOuprot_cmd_PROG_WIN_ACK_t) - sizeof(eOuprot_cmdREPLY_t);
+    ack->cumulative = w->cumulative;
+    ack->seqnum = seqnum;
+    ack->received = w->received;
+}
+
+
+extern eObool_t eouprot_progwin_complete(const eOuprot_progwin_t *w, uint16_t numberofchunks)
+{
+    if(NULL == w)
+    {
+        return(eobool_false);
+    }
+    
+    return((w->cumulative >= numberofchunks) ? (eobool_true) : (eobool_false));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
+
 // --------------------------------------------------------------------------------------------------------------------
 // empty-section
 
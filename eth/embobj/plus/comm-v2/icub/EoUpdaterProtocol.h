@@ -50,7 +50,7 @@ extern "C" {
 // - public #define  --------------------------------------------------------------------------------------------------
 
 
-#define EOUPROT_PROTOCOL_VERSION        2
+#define EOUPROT_PROTOCOL_VERSION        3
 
 #define EOUPROT_VALUE_OF_UNUSED_BYTE    255
 
@@ -94,6 +94,10 @@ typedef enum
     uprot_OPC_PROG_START        = 0x01,
     uprot_OPC_PROG_DATA         = 0x02,
     uprot_OPC_PROG_END          = 0x04,
+    
+    uprot_OPC_PROG_WIN_START    = 0x41,
+    uprot_OPC_PROG_WIN_DATA     = 0x42,
+    uprot_OPC_PROG_WIN_END      = 0x44,
 
 
     uprot_OPC_DEF2RUN           = 0x05,
@@ -152,6 +156,8 @@ typedef enum
 
 enum { uprot_pagemaxsize = 128, uprot_UDPmaxsize = 1200, uprot_PROGmaxsize = 512, uprot_EEPROMmaxsize = 1024, uprot_TEXTmaxsize = 1024 }; 
 
+enum { uprot_PROGWINmaxsize = 32 };
+
 
 typedef enum
 {   // to be used as bitfields
@@ -179,7 +185,8 @@ typedef enum
     uprot_canDO_LEGACY_EEPROM_erase = 0x1 << 19,
     uprot_canDO_LEGACY_procs        = 0x1 << 20,
     uprot_canDO_blink               = 0x1 << 21,
-    uprot_canDO_JUMP2ADDRESS        = 0x1 << 22
+    uprot_canDO_JUMP2ADDRESS        = 0x1 << 22,
+    uprot_canDO_PROG_window         = 0x1 << 23
 } eOuprot_proc_capabilities_t;
 
 typedef struct
@@ -372,6 +379,79 @@ typedef struct
 } eOuprot_cmd_PROG_END_t;    EO_VERIFYsizeof(eOuprot_cmd_PROG_END_t, 4)
 
 
+// - windowed programming (since EOUPROT_PROTOCOL_VERSION 3 and only if capabilities has uprot_canDO_PROG_window).
+//   eouprot_get_capabilities() never gives uprot_canDO_PROG_window: the firmware which implements the windowed programming 
+//   adds it to the capabilities it sends back and to the mask it checks.
+//   the host sends up to window PROG_WIN_DATA without waiting for their reply. every PROG_WIN_DATA has a seqnum which starts 
+//   from 0, and every received PROG_WIN_DATA is acked with a eOuprot_cmd_PROG_WIN_ACK_t which tells which chunks the board 
+//   has written so far. the host sends again only the chunks which are missing. the board writes every chunk as soon as it 
+//   receives it, because the chunk contains its address. the functions eouprot_progwin_*() implement the board side.
+
+
+// used to start the windowed programming onto flash of a process.
+// at reception the board sends back: a eOuprot_cmd_PROG_WIN_START_REPLY_t. a board which does not know this command does not reply.
+typedef struct
+{
+    uint8_t             opc;            // it must be 0x41 (uprot_OPC_PROG_WIN_START) 
+    uint8_t             partition;      // use eOuprot_partition2prog_t
+    uint8_t             window;         // the number of PROG_WIN_DATA that the host would like to keep in flight. at most uprot_PROGWINmaxsize
+    uint8_t             filler[1];      // it must be {EOUPROT_VALUE_OF_UNUSED_BYTE}
+    uint32_t            size;           // the total number of bytes that the host is going to send
+} eOuprot_cmd_PROG_WIN_START_t; EO_VERIFYsizeof(eOuprot_cmd_PROG_WIN_START_t, 8)
+
+
+typedef struct
+{
+    eOuprot_cmdREPLY_t  reply;          // opc = uprot_OPC_PROG_WIN_START, res = uprot_RES_OK, protversion = EOUPROT_PROTOCOL_VERSION, sizeofextra = 4
+    uint8_t             window;         // the window granted by the board. it is not higher than the one requested
+    uint8_t             filler[3];      // it must be {EOUPROT_VALUE_OF_UNUSED_BYTE}
+} eOuprot_cmd_PROG_WIN_START_REPLY_t; EO_VERIFYsizeof(eOuprot_cmd_PROG_WIN_START_REPLY_t, 8)
+
+
+// used to carry a chunk of data to be programmed onto flash. it is a variable sized command: the last size bytes of data are not sent.
+// at reception the board sends back: a eOuprot_cmd_PROG_WIN_ACK_t, also if the chunk was already received.
+typedef struct
+{
+    uint8_t             opc;            // it must be 0x42 (uprot_OPC_PROG_WIN_DATA) 
+    uint8_t             filler[1];      // it must be {EOUPROT_VALUE_OF_UNUSED_BYTE}
+    uint16_t            seqnum;         // the number of the chunk, starting from 0
+    uint32_t            address;        // the flash address where to write the data
+    uint16_t            size;           // the size of the data. at most uprot_PROGmaxsize
+    uint8_t             filler2[2];     // it must be {EOUPROT_VALUE_OF_UNUSED_BYTE}
+    uint8_t             data[uprot_PROGmaxsize];
+} eOuprot_cmd_PROG_WIN_DATA_t; EO_VERIFYsizeof(eOuprot_cmd_PROG_WIN_DATA_t, uprot_PROGmaxsize+12)
+
+
+typedef struct
+{
+    eOuprot_cmdREPLY_t  reply;          // opc = uprot_OPC_PROG_WIN_DATA, res = uprot_RES_OK (or uprot_RES_ERR_FLASH), protversion = EOUPROT_PROTOCOL_VERSION, sizeofextra = 8
+    uint16_t            cumulative;     // all the chunks with seqnum lower than cumulative have been written
+    uint16_t            seqnum;         // the seqnum of the PROG_WIN_DATA which has triggered this ack
+    uint32_t            received;       // bit i tells that chunk cumulative+1+i has been written
+} eOuprot_cmd_PROG_WIN_ACK_t; EO_VERIFYsizeof(eOuprot_cmd_PROG_WIN_ACK_t, 12)
+
+
+// used to end the windowed programming.
+// at reception the board sends back: a eOuprot_cmdREPLY_t with fields {.opc = uprot_OPC_PROG_WIN_END, .res = uprot_RES_OK, .protversion = EOUPROT_PROTOCOL_VERSION, .sizeofextra = 0}
+// but res is uprot_RES_ERR_LOST if not all the numberofchunks have been written.
+typedef struct
+{
+    uint8_t             opc;            // it must be 0x44 (uprot_OPC_PROG_WIN_END) 
+    uint8_t             filler[1];      // it must be {EOUPROT_VALUE_OF_UNUSED_BYTE}
+    uint16_t            numberofchunks; // number of PROG_WIN_DATA (retransmissions excluded) that the host has sent
+} eOuprot_cmd_PROG_WIN_END_t;    EO_VERIFYsizeof(eOuprot_cmd_PROG_WIN_END_t, 4)
+
+
+// it keeps the state of the windowed programming on the board side
+typedef struct
+{
+    uint16_t            cumulative;     // all the chunks with seqnum lower than cumulative have been received
+    uint8_t             window;
+    uint8_t             filler[1];
+    uint32_t            received;       // bit i tells that chunk cumulative+1+i has been received
+} eOuprot_progwin_t;
+
+
 // former BOOT
 // used to change the def2run process (the one executing after the 5 seconds). this command also forces the startup process to be the eUpdater.
 // the format of the command has NOT changed from the legacy one. only it is 4 bytes long instead of 2. 
@@ -601,6 +681,19 @@ extern uint8_t eouprot_process2index(eOuprot_process_t process);
 
 extern eOuprot_process_t eouprot_raw2process(uint8_t rawvalue);
 
+// board side of the windowed programming. 
+// eouprot_progwin_init() is called at reception of PROG_WIN_START with the granted window.
+extern void eouprot_progwin_init(eOuprot_progwin_t *w, uint8_t window);
+
+// it is called at reception of PROG_WIN_DATA. it returns eobool_true if the chunk is new and inside the window, and in such a case 
+// the board must write it. in any case the board must send back the ack filled by eouprot_progwin_fillack().
+extern eObool_t eouprot_progwin_accept(eOuprot_progwin_t *w, uint16_t seqnum);
+
+extern void eouprot_progwin_fillack(const eOuprot_progwin_t *w, uint16_t seqnum, eOuprot_result_t res, eOuprot_cmd_PROG_WIN_ACK_t *ack);
+
+// it tells if all the chunks with seqnum lower than numberofchunks have been received
+extern eObool_t eouprot_progwin_complete(const eOuprot_progwin_t *w, uint16_t numberofchunks);
+
 
 /** @}            
     end of group eo_cevcwervcrev666  
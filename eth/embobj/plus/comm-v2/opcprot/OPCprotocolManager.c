@@ -44,7 +44,8 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - #define with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+#define OPCPROTMAN_INDEX_MINSLOTS   16
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of extern variables, but better using _get(), _set() 
@@ -66,6 +67,10 @@
 static opcprotman_var_map_t* s_opcprotman_find(OPCprotocolManager* p, opcprotman_header_t* head);
 static opcprotman_res_t s_opcprotman_process_operation(opcprotman_message_t* msg, opcprotman_var_map_t* map, opcprotman_message_t* reply, uint16_t* replysize);
 static opcprotman_var_map_t* s_opcprotman_find_var(OPCprotocolManager* p, uint16_t var);
+static opcprotman_res_t s_opcprotman_index_init(OPCprotocolManager* p);
+static opcprotman_res_t s_opcprotman_index_insert(OPCprotocolManager* p, opcprotman_var_map_t* map);
+static opcprotman_res_t s_opcprotman_index_grow(OPCprotocolManager* p);
+static uint32_t s_opcprotman_index_hash(uint16_t var);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -99,11 +104,18 @@ extern OPCprotocolManager * opcprotman_New(const opcprotman_cfg_t *cfg)
     
     p->cfg = cfg;
     
+    // the index must be ready before the personalisation, which looks for the variables
+    if(opcprotman_OK != s_opcprotman_index_init(p))
+    {
+        opcprotman_Delete(p);
+        return(NULL);
+    }
     
     res = opcprotman_personalize_database(p);  
     
     if(opcprotman_OK != res)
     {
+        opcprotman_Delete(p);
         return(NULL);
     }
     
@@ -111,6 +123,29 @@ extern OPCprotocolManager * opcprotman_New(const opcprotman_cfg_t *cfg)
 
 }
 
+
+extern void opcprotman_Delete(OPCprotocolManager* p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+    
+    free(p->index);
+    free(p);
+}
+
+
+extern opcprotman_res_t opcprotman_Register(OPCprotocolManager* p, opcprotman_var_map_t* map)
+{
+    if((NULL == p) || (NULL == map))
+    {
+        return(opcprotman_NOK_generic);
+    }
+    
+    return(s_opcprotman_index_insert(p, map));
+}
+
 // they must be defined externally, even if we dont use the opcprotocol manager
 //EO_weak extern opcprotman_cfg_t* opcprotman_getconfiguration(void)
 //{
@@ -349,19 +384,114 @@ static opcprotman_var_map_t* s_opcprotman_find(OPCprotocolManager* p, opcprotman
 
 static opcprotman_var_map_t* s_opcprotman_find_var(OPCprotocolManager* p, uint16_t var)
 {
+    uint32_t s = s_opcprotman_index_hash(var) & p->indexmask;
+    
+    // the index is at most half full, thus there is always an empty slot which stops the search
+    for(; NULL != p->index[s]; s = (s+1) & p->indexmask)
+    {
+        if(var == p->index[s]->var)
+        {
+            return(p->index[s]);
+        }
+    }
+    
+    return(NULL);
+}
+
+
+static opcprotman_res_t s_opcprotman_index_init(OPCprotocolManager* p)
+{
+    uint32_t numslots = OPCPROTMAN_INDEX_MINSLOTS;
     uint16_t i;
-    opcprotman_var_map_t* map = NULL;
     
+    if((0 != p->cfg->numberofvariables) && (NULL == p->cfg->arrayofvariablemap))
+    {
+        return(opcprotman_NOK_generic);
+    }
+    
+    while(numslots < 2*(uint32_t)p->cfg->numberofvariables)
+    {
+        numslots <<= 1;
+    }
+    
+    if(NULL == (p->index = (opcprotman_var_map_t**) calloc(numslots, sizeof(opcprotman_var_map_t*))))
+    {
+        return(opcprotman_NOK_generic);
+    }
+    
+    p->indexmask = numslots - 1;
+    p->numberofvariables = 0;
+    
+    // if a var is repeated in the cfg only its first occurrence is kept, as the former linear search did
     for(i=0; i<p->cfg->numberofvariables; i++)
     {
-        if(var == p->cfg->arrayofvariablemap[i].var)
+        s_opcprotman_index_insert(p, &p->cfg->arrayofvariablemap[i]);
+    }
+    
+    return(opcprotman_OK);
+}
+
+
+static opcprotman_res_t s_opcprotman_index_insert(OPCprotocolManager* p, opcprotman_var_map_t* map)
+{
+    uint32_t s = 0;
+    
+    if((2*(p->numberofvariables+1) > (p->indexmask+1)) && (opcprotman_OK != s_opcprotman_index_grow(p)))
+    {
+        return(opcprotman_NOK_generic);
+    }
+    
+    for(s = s_opcprotman_index_hash(map->var) & p->indexmask; NULL != p->index[s]; s = (s+1) & p->indexmask)
+    {
+        if(map->var == p->index[s]->var)
         {
-            map = &p->cfg->arrayofvariablemap[i];
-            break;
+            return(opcprotman_NOK_generic);
         }
     }
     
-    return(map);
+    p->index[s] = map;
+    p->numberofvariables++;
+    
+    return(opcprotman_OK);
+}
+
+
+static opcprotman_res_t s_opcprotman_index_grow(OPCprotocolManager* p)
+{   // doubling the slots keeps the cost of opcprotman_Register() constant when averaged over the calls
+    uint32_t numslots = 2*(p->indexmask+1);
+    opcprotman_var_map_t** index = NULL;
+    uint32_t i = 0;
+    uint32_t s = 0;
+    
+    if(NULL == (index = (opcprotman_var_map_t**) calloc(numslots, sizeof(opcprotman_var_map_t*))))
+    {
+        return(opcprotman_NOK_generic);
+    }
+    
+    for(i=0; i<=p->indexmask; i++)
+    {
+        if(NULL != p->index[i])
+        {
+            for(s = s_opcprotman_index_hash(p->index[i]->var) & (numslots-1); NULL != index[s]; s = (s+1) & (numslots-1))
+            {
+                ;
+            }
+            index[s] = p->index[i];
+        }
+    }
+    
+    free(p->index);
+    p->index = index;
+    p->indexmask = numslots - 1;
+    
+    return(opcprotman_OK);
+}
+
+
+static uint32_t s_opcprotman_index_hash(uint16_t var)
+{   // fibonacci hashing spreads also the ids which are multiple of the number of slots
+    uint32_t h = (uint32_t)var * 0x9E3779B1;
+    return(h ^ (h >> 16));
 }
 
 
@@ -171,6 +171,26 @@ extern opcprotman_res_t opcprotman_personalize_database(OPCprotocolManager *p);
 extern OPCprotocolManager * opcprotman_New(const opcprotman_cfg_t *cfg);
 
 
+/** @fn         extern void opcprotman_Delete(OPCprotocolManager* p)
+    @brief      Destroys the OPCprotocolManager object. The variables added with opcprotman_Register() are not 
+                freed as they belong to the caller.
+    @arg        p           The handle
+ **/
+extern void opcprotman_Delete(OPCprotocolManager* p);
+
+
+/** @fn         extern opcprotman_res_t opcprotman_Register(OPCprotocolManager* p, opcprotman_var_map_t* map)
+    @brief      Adds a variable to the ones of the configuration. The map is not copied, thus it must stay valid
+                for the life of the object. Lookup and registration take constant time whatever the number of 
+                variables. It must not be called while another thread is inside opcprotman_Parse() or 
+                opcprotman_Form().
+    @arg        p           The handle
+    @arg        map         The variable. Its var must be different from the ones already present.
+    @return     opcprotman_OK, or opcprotman_NOK_generic if var is already present or if there is no memory.
+ **/
+extern opcprotman_res_t opcprotman_Register(OPCprotocolManager* p, opcprotman_var_map_t* map);
+
+
 // opcprotman_OK if it has signature, opcprotman_NOK_generic otherwise
 extern opcprotman_res_t opcprotman_Has_Signature(OPCprotocolManager* p, opcprotman_message_t* msg);
 
@@ -55,6 +55,9 @@ extern "C" {
 struct OPCprotocolManager_hid 
 {
     const opcprotman_cfg_t* cfg;
+    opcprotman_var_map_t**  index;              /**< open addressing table of the variables, hashed by var. it is at most half full */
+    uint32_t                indexmask;          /**< number of slots of index - 1 */
+    uint32_t                numberofvariables;  /**< the variables in index: those of cfg plus those added with opcprotman_Register() */
 };
 
 
@@ -76,6 +76,9 @@ static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o);
 static EOrop * s_eo_agent_rop_prepare_reply(EOrop *ropin, EOrop *ropout);
 static eObool_t s_eo_agent_rop_cannot_manage(EOrop *ropin);
 
+static eOresult_t s_eo_agent_rop_unzip(EOagent *p, EOrop *rop, eOipv4addr_t fromipaddr);
+static eo_agent_zipvar_t * s_eo_agent_zipvar_get(EOagent *p, eOipv4addr_t ipaddr, eOnvID32_t id32);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -107,6 +110,11 @@ extern EOagent* eo_agent_New(const eOagent_cfg_t *cfg)
     retptr = (EOagent*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(EOagent), 1);
     
     memcpy(&retptr->config, cfg, sizeof(eOagent_cfg_t));
+    
+    retptr->zipvars = NULL;
+    // the rx path does not allocate: the scratch has the size of the biggest data field of a received rop
+    retptr->zipscratchsize = eo_rop_datafield_effective_size(cfg->capacityofrop);
+    retptr->zipscratch = (0 == retptr->zipscratchsize) ? (NULL) : ((uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, retptr->zipscratchsize, 1));
                
     return(retptr);       
 }    
@@ -124,6 +132,15 @@ extern void eo_agent_Delete(EOagent *p)
         return;
     }
     
+    if(NULL != p->zipvars)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->zipvars);
+    }
+    if(NULL != p->zipscratch)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->zipscratch);
+    }
+    
     memset(p, 0, sizeof(EOagent));
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
     return;         
@@ -222,6 +239,13 @@ extern eOresult_t eo_agent_InpROPprocess(EOagent *p, EOrop *ropin, eOipv4addr_t
         {
             eo_nv_Clear(&ropin->netvar);    
         }
+        else if(eo_ropcode_sigz == ropc)
+        {   // we expand it into a sig<> so that it is processed as any other sig<>. if we cannot, it is as if the nv did not exist
+            if(eores_OK != s_eo_agent_rop_unzip(p, ropin, fromipaddr))
+            {
+                eo_nv_Clear(&ropin->netvar);
+            }
+        }
         
         // process the rop even if the netvar is not found (res is not eores_OK)
         // because we may need to send back a nack. 
@@ -456,6 +480,17 @@ static void s_eo_agent_rop_exec(EOrop *rop_in, EOrop *rop_o)
             // then, the processing of such data is done in the appropriate update() function 
     
 
+            // as for the set, if the rop is badly formed we dont write. its data may be inside the received packet, 
+            // so a smaller dsiz would make us read beyond the rop.
+            if(rop_in->stream.head.dsiz != eo_nv_Size(thenv))
+            {
+                if((1 == rop_in->stream.head.ctrl.rqstconf) && (NULL != rop_o) && (eo_ropcode_sig == rop_in->stream.head.ropc))
+                {
+                    rop_o->stream.head.ctrl.confinfo = eo_ropconf_nak;
+                }
+                break;
+            }
+
             // force write also if an input, force update.
             source = rop_in->stream.data;
             eo_nv_hid_remoteSetROP(thenv, source, eo_nv_upd_always, theropdes);
@@ -594,6 +629,102 @@ static eObool_t s_eo_agent_rop_cannot_manage(EOrop *ropin)
 }
 
 
+static eOresult_t s_eo_agent_rop_unzip(EOagent *p, EOrop *rop, eOipv4addr_t fromipaddr)
+{
+    eOropzip_head_t head;
+    eo_agent_zipvar_t *var = NULL;
+    uint16_t size = eo_nv_Size(&rop->netvar);
+    uint16_t zipsize = rop->stream.head.dsiz;
+    uint16_t tmp = 0;
+    
+    if((zipsize < sizeof(eOropzip_head_t)) || (zipsize > p->zipscratchsize) || (size > rop->stream.capacity) || (NULL == rop->stream.buffer))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(&head, rop->stream.data, sizeof(eOropzip_head_t));
+    
+    if(0 != head.version)
+    {   // a delta is good only on top of the previous version
+        var = s_eo_agent_zipvar_get(p, fromipaddr, rop->stream.head.id32);
+        if((eo_ropzip_xordelta == head.encoding) && ((NULL == var) || (0 == var->version) || (head.version != ((255 == var->version) ? (1) : (var->version+1)))))
+        {
+            return(eores_NOK_generic);
+        }
+    }
+    
+    // the data field moves into the scratch so that the value can be expanded in its place
+    memcpy(p->zipscratch, rop->stream.data, zipsize);
+    // the data field may be borrowed from the received ropframe: the value is expanded in the memory of the rop
+    rop->stream.data = rop->stream.buffer;
+    
+    if(eo_ropzip_xordelta == head.encoding)
+    {
+        eo_nv_Get(&rop->netvar, eo_nv_strg_volatile, rop->stream.data, &tmp);
+    }
+    
+    if(eores_OK != eo_rop_zip_Decode(p->zipscratch, zipsize, rop->stream.data, size))
+    {
+        if(NULL != var)
+        {   // we dont know anymore what the sender thinks we have
+            var->version = 0;
+        }
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL != var)
+    {
+        var->version = head.version;
+    }
+    
+    rop->stream.head.ropc = eo_ropcode_sig;
+    rop->stream.head.dsiz = size;
+    rop->ropdes.ropcode = eo_ropcode_sig;
+    rop->ropdes.size = size;
+    rop->ropdes.data = rop->stream.data;
+    
+    return(eores_OK);
+}
+
+
+static eo_agent_zipvar_t * s_eo_agent_zipvar_get(EOagent *p, eOipv4addr_t ipaddr, eOnvID32_t id32)
+{   // open addressing. the entries are never freed, so the chains stay valid: when all are used the new variable takes
+    // the entry of its home slot. the variable evicted loses its version and the next delta of it waits for a keyframe
+    uint32_t h = (id32 ^ ipaddr) * 2654435761u;
+    uint16_t home = (uint16_t)((h >> 16) & (EOAGENT_ZIPVARS_CAPACITY-1));
+    uint16_t i = 0;
+    
+    if(NULL == p->zipvars)
+    {
+        p->zipvars = (eo_agent_zipvar_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eo_agent_zipvar_t), EOAGENT_ZIPVARS_CAPACITY);
+        memset(p->zipvars, 0, EOAGENT_ZIPVARS_CAPACITY*sizeof(eo_agent_zipvar_t));
+    }
+    
+    for(i=0; i<EOAGENT_ZIPVARS_CAPACITY; i++)
+    {
+        eo_agent_zipvar_t *var = &p->zipvars[(home + i) & (EOAGENT_ZIPVARS_CAPACITY-1)];
+        if(0 == var->used)
+        {   // free: we take it
+            var->ipaddr = ipaddr;
+            var->id32 = id32;
+            var->version = 0;
+            var->used = 1;
+            return(var);
+        }
+        if((var->ipaddr == ipaddr) && (var->id32 == id32))
+        {
+            return(var);
+        }
+    }
+    
+    p->zipvars[home].ipaddr = ipaddr;
+    p->zipvars[home].id32 = id32;
+    p->zipvars[home].version = 0;
+    
+    return(&p->zipvars[home]);
+}
+
+
 
 
 
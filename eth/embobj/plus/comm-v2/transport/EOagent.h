@@ -67,6 +67,7 @@ typedef struct
     EOnvSet*                nvset;
     EOconfirmationManager*  confman;
     EOproxy*                proxy;
+    uint16_t                capacityofrop;  // of the received rops. it sizes the memory used to expand a sigz<>, which is refused if 0
 } eOagent_cfg_t;
 
     
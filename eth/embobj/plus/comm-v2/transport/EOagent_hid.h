@@ -42,12 +42,23 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
 
+// the variables received with a versioned sigz<> whose version the agent keeps. it must be a power of two
+#define EOAGENT_ZIPVARS_CAPACITY    128
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+typedef struct
+{
+    eOipv4addr_t        ipaddr;
+    eOnvID32_t          id32;
+    uint8_t             version;    // the last one received. 0 if unknown
+    uint8_t             used;
+    uint8_t             filler[2];
+} eo_agent_zipvar_t;
+
+
 /** @struct     EOagent_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -56,7 +67,10 @@ extern "C" {
  
 struct EOagent_hid 
 {
-    eOagent_cfg_t   config;
+    eOagent_cfg_t       config;
+    eo_agent_zipvar_t*  zipvars;        // EOAGENT_ZIPVARS_CAPACITY items, allocated at the first versioned sigz<>
+    uint8_t*            zipscratch;     // for the received data field while it is expanded. config.capacityofrop bytes
+    uint16_t            zipscratchsize;
 }; 
 
 
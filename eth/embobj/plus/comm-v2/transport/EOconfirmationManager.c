@@ -24,6 +24,7 @@
 #include "EoCommon.h"
 #include "string.h"
 #include "EOtheMemoryPool.h"
+#include "EOVtheSystem.h"
 
 
 
@@ -76,6 +77,28 @@
 static void s_eo_confman_default_rop_conf_requested(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
 static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
 
+static eObool_t s_eo_confman_tracking(EOconfirmationManager *p);
+
+static uint16_t s_eo_confman_bucket(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature);
+
+static uint16_t s_eo_confman_find(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature);
+
+static void s_eo_confman_track(EOconfirmationManager *p, uint16_t e, eOipv4addr_t toipaddr, eOabstime_t now);
+
+static void s_eo_confman_remove(EOconfirmationManager *p, uint16_t e);
+
+static void s_eo_confman_free(EOconfirmationManager *p, uint16_t e);
+
+static void s_eo_confman_wheel_insert(EOconfirmationManager *p, uint16_t e);
+
+static void s_eo_confman_wheel_remove(EOconfirmationManager *p, uint16_t e);
+
+static uint16_t s_eo_confman_wheel_due(EOconfirmationManager *p, uint16_t slot, eOabstime_t now);
+
+static eo_confman_board_t * s_eo_confman_board(EOconfirmationManager *p, eOipv4addr_t ipaddr, uint8_t *index);
+
+static uint32_t s_eo_confman_signature(const eOropdescriptor_t *ropdes);
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
@@ -89,7 +112,13 @@ const eOconfman_cfg_t eOconfman_cfg_default =
     EO_INIT(.maxnumberofconfreqrops)        16,
     EO_INIT(.mutex_fn_new)                  NULL,
     EO_INIT(.on_rop_conf_requested)         s_eo_confman_default_rop_conf_requested, 
-    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received
+    EO_INIT(.on_rop_conf_received)          s_eo_confman_default_rop_conf_received,
+    EO_INIT(.maxnumberofoutstanding)        0,
+    EO_INIT(.maxsizeofdata)                 32,
+    EO_INIT(.maxretransmissions)            0,
+    EO_INIT(.maxnumberofboards)             1,
+    EO_INIT(.timeout)                       0,
+    EO_INIT(.on_rop_conf_timeout)           NULL
 };
 
 
@@ -123,6 +152,51 @@ extern EOconfirmationManager* eo_confman_New(const eOconfman_cfg_t *cfg)
 
     retptr->mtx = (NULL == cfg->mutex_fn_new) ? (NULL) : (cfg->mutex_fn_new());
     
+    retptr->freeentry = EOK_uint16dummy;
+    retptr->pending = retptr->pendinglast = EOK_uint16dummy;
+    retptr->retransmits = retptr->retransmitting = EOK_uint16dummy;
+    
+    if((0 != cfg->maxnumberofoutstanding) && (0 != cfg->timeout))
+    {
+        uint16_t i = 0;
+        uint16_t numbuckets = 1;
+        // the number of buckets is a power of two not smaller than the capacity so that the chains are short
+        while((numbuckets < cfg->maxnumberofoutstanding) && (numbuckets < 0x8000))
+        {
+            numbuckets <<= 1;
+        }
+        
+        retptr->entries = (eo_confman_entry_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eo_confman_entry_t), cfg->maxnumberofoutstanding);
+        retptr->buckets = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), numbuckets);
+        retptr->bucketmask = numbuckets - 1;
+        // one more slot of data is used by eo_confman_Timeouts_Process() to keep the rop it retransmits
+        retptr->data = (0 == cfg->maxsizeofdata) ? (NULL) : ((uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->maxsizeofdata, cfg->maxnumberofoutstanding+1));
+        retptr->boards = (0 == cfg->maxnumberofboards) ? (NULL) : ((eo_confman_board_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eo_confman_board_t), cfg->maxnumberofboards));
+        
+        for(i=0; i<numbuckets; i++)
+        {
+            retptr->buckets[i] = EOK_uint16dummy;
+        }
+        
+        for(i=0; i<cfg->maxnumberofoutstanding; i++)
+        {
+            retptr->entries[i].next = ((i+1) == cfg->maxnumberofoutstanding) ? (EOK_uint16dummy) : (i+1);
+        }
+        retptr->freeentry = 0;
+        
+        for(i=0; i<eo_confman_wheelslots; i++)
+        {
+            retptr->wheel[i] = EOK_uint16dummy;
+        }
+        // the timeout spans half the wheel, so an entry is always due within one turn
+        retptr->wheelresolution = cfg->timeout / (eo_confman_wheelslots/2);
+        if(0 == retptr->wheelresolution)
+        {
+            retptr->wheelresolution = 1;
+        }
+        retptr->wheeltick = eov_sys_LifeTimeGet(eov_sys_GetHandle()) / retptr->wheelresolution;
+    }
+    
     return(retptr);
 }
 
@@ -143,6 +217,20 @@ extern void eo_confman_Delete(EOconfirmationManager *p)
     {
         eo_vector_Delete(p->confrequests);
     }
+    
+    if(NULL != p->entries)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->entries);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->buckets);
+        if(NULL != p->data)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), p->data);
+        }
+        if(NULL != p->boards)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), p->boards);
+        }
+    }
    
     memset(p, 0, sizeof(EOconfirmationManager));
     eo_mempool_Delete(eo_mempool_GetHandle(), p);
@@ -171,12 +259,89 @@ extern eOresult_t eo_confman_ConfirmationRequests_Process(EOconfirmationManager
         eo_vector_Clear(p->confrequests);   // remove the conf requests
     }
     
+    if((eobool_true == s_eo_confman_tracking(p)) && (0 != p->pendingoverflow))
+    {   // the rops not tracked since the last packet
+        eo_confman_board_t *board = s_eo_confman_board(p, toipaddr, NULL);
+        if(NULL != board)
+        {
+            board->stats.overflow += p->pendingoverflow;
+        }
+        p->pendingoverflow = 0;
+    }
+    
     eov_mutex_Release(p->mtx);
     
     return(eores_OK);    
 }
 
 
+extern eOresult_t eo_confman_ConfirmationRequest_Transmitted(EOconfirmationManager *p, eOipv4addr_t toipaddr, eOnvID32_t id32, uint32_t signature)
+{
+    eOabstime_t now = 0;
+    uint16_t prev = EOK_uint16dummy;
+    uint16_t e = EOK_uint16dummy;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    if(eobool_false == s_eo_confman_tracking(p))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    // a retransmission: its entry goes back into the wheel
+    for(e = p->retransmits; EOK_uint16dummy != e; e = p->entries[e].wheelnext)
+    {
+        eo_confman_entry_t *entry = &p->entries[e];
+        if((toipaddr == entry->ipaddr) && (id32 == entry->ropdes.id32) && (signature == entry->signature))
+        {
+            s_eo_confman_wheel_remove(p, e);
+            entry->queued = 0;
+            entry->lastsent = now;
+            entry->expiry = now + p->config.timeout;
+            s_eo_confman_wheel_insert(p, e);
+            eov_mutex_Release(p->mtx);
+            return(eores_OK);
+        }
+    }
+    
+    // else the first one of the pending list which matches, as the transmitter keeps the order of load of the rops
+    for(e = p->pending; EOK_uint16dummy != e; e = p->entries[e].next)
+    {
+        eo_confman_entry_t *entry = &p->entries[e];
+        if((id32 == entry->ropdes.id32) && (signature == entry->signature))
+        {
+            if(EOK_uint16dummy == prev)
+            {
+                p->pending = entry->next;
+            }
+            else
+            {
+                p->entries[prev].next = entry->next;
+            }
+            if(e == p->pendinglast)
+            {
+                p->pendinglast = prev;
+            }
+            s_eo_confman_track(p, e, toipaddr, now);
+            eov_mutex_Release(p->mtx);
+            return(eores_OK);
+        }
+        prev = e;
+    }
+    
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_NOK_generic);
+}
+
+
 extern eOresult_t eo_confman_ConfirmationRequest_Insert(EOconfirmationManager *p, eOropdescriptor_t* ropdesc)
 {   
     if((NULL == p) || (NULL == ropdesc))
@@ -201,6 +366,64 @@ extern eOresult_t eo_confman_ConfirmationRequest_Insert(EOconfirmationManager *p
                 return(eores_NOK_generic); 
             }
             
+            if(eobool_true == s_eo_confman_tracking(p))
+            {   // we keep a copy of the rop in the pending list. the ip address is known only at transmission
+                eo_confman_entry_t *retransmitted = (EOK_uint16dummy == p->retransmitting) ? (NULL) : (&p->entries[p->retransmitting]);
+                
+                if((NULL != retransmitted) && (ropdesc->id32 == retransmitted->ropdes.id32) && (s_eo_confman_signature(ropdesc) == retransmitted->signature))
+                {   // a retransmission keeps its entry, which waits out of the wheel until the rop is transmitted
+                    uint16_t e = p->retransmitting;
+                    s_eo_confman_wheel_remove(p, e);
+                    retransmitted->queued = 1;
+                    retransmitted->wheelnext = p->retransmits;
+                    if(EOK_uint16dummy != p->retransmits)
+                    {
+                        p->entries[p->retransmits].wheelprev = e;
+                    }
+                    p->retransmits = e;
+                    p->retransmitting = EOK_uint16dummy;
+                }
+                else if(EOK_uint16dummy == p->freeentry)
+                {
+                    p->pendingoverflow++;
+                }
+                else
+                {
+                    uint16_t e = p->freeentry;
+                    eo_confman_entry_t *entry = &p->entries[e];
+                    p->freeentry = entry->next;
+                    
+                    memcpy(&entry->ropdes, ropdesc, sizeof(eOropdescriptor_t));
+                    entry->signature = s_eo_confman_signature(ropdesc);
+                    entry->canretransmit = 1;
+                    if(NULL != ropdesc->data)
+                    {
+                        if((NULL != p->data) && (ropdesc->size <= p->config.maxsizeofdata))
+                        {
+                            entry->ropdes.data = &p->data[(uint32_t)e * p->config.maxsizeofdata];
+                            memcpy(entry->ropdes.data, ropdesc->data, ropdesc->size);
+                        }
+                        else
+                        {
+                            entry->ropdes.data = NULL;
+                            entry->canretransmit = 0;
+                        }
+                    }
+                    entry->retransmissions = 0;
+                    entry->queued = 0;
+                    entry->next = EOK_uint16dummy;
+                    if(EOK_uint16dummy == p->pending)
+                    {
+                        p->pending = e;
+                    }
+                    else
+                    {
+                        p->entries[p->pendinglast].next = e;
+                    }
+                    p->pendinglast = e;
+                }
+            }
+            
             eov_mutex_Release(p->mtx);
         }        
     }
@@ -243,6 +466,58 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 
     if(eo_ropconf_none != confinfo)
     {
+        if(eobool_true == s_eo_confman_tracking(p))
+        {
+            uint16_t e = EOK_uint16dummy;
+            eo_confman_board_t *board = NULL;
+            
+            eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+            
+            e = s_eo_confman_find(p, fromipaddr, ropdes->id32, s_eo_confman_signature(ropdes));
+            if(EOK_uint16dummy == e)
+            {
+                board = s_eo_confman_board(p, fromipaddr, NULL);
+                if(NULL != board)
+                {
+                    board->stats.unmatched++;
+                }
+            }
+            else
+            {
+                eo_confman_entry_t *entry = &p->entries[e];
+                board = (EOK_uint08dummy == entry->board) ? (NULL) : (&p->boards[entry->board]);
+                if(NULL != board)
+                {
+                    if(eo_ropconf_ack == confinfo)
+                    {
+                        board->stats.acked++;
+                    }
+                    else
+                    {
+                        board->stats.nacked++;
+                    }
+                    // as in the algorithm of karn: a rop which was sent more than once does not give a valid rtt
+                    if(0 == entry->retransmissions)
+                    {
+                        uint32_t rtt = (uint32_t)(eov_sys_LifeTimeGet(eov_sys_GetHandle()) - entry->lastsent);
+                        if((0 == board->stats.rttcount) || (rtt < board->stats.rttmin))
+                        {
+                            board->stats.rttmin = rtt;
+                        }
+                        if(rtt > board->stats.rttmax)
+                        {
+                            board->stats.rttmax = rtt;
+                        }
+                        board->stats.rttcount++;
+                        board->stats.rttsum += rtt;
+                    }
+                }
+                s_eo_confman_remove(p, e);
+            }
+            
+            eov_mutex_Release(p->mtx);
+        }
+        
         // received a confirmation ack/nak: execute the callback
         if(NULL != p->config.on_rop_conf_received)
         {
@@ -257,6 +532,145 @@ extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOi
 
 
 
+extern eOresult_t eo_confman_Timeouts_Process(EOconfirmationManager *p, eOconfman_fn_retransmit_t fn, void *arg)
+{
+    eOabstime_t now = 0;
+    eOabstime_t target = 0;
+    eOabstime_t tick = 0;
+    uint16_t slot = 0;
+    uint16_t e = EOK_uint16dummy;
+    eOropdescriptor_t ropdes;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);  
+    }
+    
+    if(eobool_false == s_eo_confman_tracking(p))
+    {
+        return(eores_OK);
+    }
+    
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    target = now / p->wheelresolution;
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    
+    // we visit the slots from the last one visited up to the one of now. the slot of now is kept as next start
+    // because some of its entries may expire later inside the same tick. more than one turn visits each slot once.
+    tick = p->wheeltick;
+    if((target - tick) >= eo_confman_wheelslots)
+    {
+        tick = target - eo_confman_wheelslots + 1;
+    }
+    
+    for(; tick <= target; tick++)
+    {
+        slot = tick % eo_confman_wheelslots;
+        
+        while(EOK_uint16dummy != (e = s_eo_confman_wheel_due(p, slot, now)))
+        {
+            eo_confman_entry_t *entry = &p->entries[e];
+            eo_confman_board_t *board = (EOK_uint08dummy == entry->board) ? (NULL) : (&p->boards[entry->board]);
+            
+            if((NULL != fn) && (1 == entry->canretransmit) && (entry->retransmissions < p->config.maxretransmissions))
+            {   // we move the entry forward and we retransmit a copy of its rop, because the entry may be removed 
+                // by a confirmation as soon as we release the mutex. if the rop is loaded the entry waits for it
+                // out of the wheel, else it expires again after another timeout.
+                s_eo_confman_wheel_remove(p, e);
+                entry->retransmissions++;
+                entry->expiry = now + p->config.timeout;
+                s_eo_confman_wheel_insert(p, e);
+                if(NULL != board)
+                {
+                    board->stats.retransmitted++;
+                }
+                
+                memcpy(&ropdes, &entry->ropdes, sizeof(eOropdescriptor_t));
+                if(NULL != entry->ropdes.data)
+                {
+                    ropdes.data = &p->data[(uint32_t)p->config.maxnumberofoutstanding * p->config.maxsizeofdata];
+                    memcpy(ropdes.data, entry->ropdes.data, entry->ropdes.size);
+                }
+                
+                // the transmitter loads the rop and calls eo_confman_ConfirmationRequest_Insert() which takes the mutex
+                p->retransmitting = e;
+                eov_mutex_Release(p->mtx);
+                fn(arg, &ropdes);
+                eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+                p->retransmitting = EOK_uint16dummy;
+            }
+            else
+            {
+                if(NULL != board)
+                {
+                    board->stats.timedout++;
+                }
+                if(NULL != p->config.on_rop_conf_timeout)
+                {
+                    p->config.on_rop_conf_timeout(entry->ipaddr, &entry->ropdes);
+                }
+                s_eo_confman_remove(p, e);
+            }
+        }
+    }
+    
+    p->wheeltick = target;
+    
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_OK);
+}
+
+
+extern uint16_t eo_confman_Outstanding_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr)
+{
+    uint16_t outstanding = 0;
+    eo_confman_board_t *board = NULL;
+    
+    if((NULL == p) || (eobool_false == s_eo_confman_tracking(p)))
+    {
+        return(0);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    board = s_eo_confman_board(p, ipaddr, NULL);
+    if(NULL != board)
+    {
+        outstanding = board->stats.outstanding;
+    }
+    eov_mutex_Release(p->mtx);
+    
+    return(outstanding);
+}
+
+
+extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOconfman_stats_t *stats)
+{
+    eo_confman_board_t *board = NULL;
+    
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(eobool_false == s_eo_confman_tracking(p))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    board = s_eo_confman_board(p, ipaddr, NULL);
+    if(NULL != board)
+    {
+        memcpy(stats, &board->stats, sizeof(eOconfman_stats_t));
+    }
+    eov_mutex_Release(p->mtx);
+    
+    return((NULL == board) ? (eores_NOK_generic) : (eores_OK));
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -280,6 +694,235 @@ static void s_eo_confman_default_rop_conf_received(eOipv4addr_t fromipaddr, eOro
 }
 
 
+static eObool_t s_eo_confman_tracking(EOconfirmationManager *p)
+{
+    return((NULL != p->entries) ? (eobool_true) : (eobool_false));
+}
+
+
+static uint16_t s_eo_confman_bucket(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature)
+{   // fibonacci hashing on the mix of the three fields
+    uint32_t h = (ipaddr * 0x9E3779B1) ^ (id32 * 0x85EBCA6B) ^ (signature * 0xC2B2AE35);
+    h ^= (h >> 16);
+    return((uint16_t)(h & p->bucketmask));
+}
+
+
+static uint16_t s_eo_confman_find(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOnvID32_t id32, uint32_t signature)
+{
+    uint16_t e = p->buckets[s_eo_confman_bucket(p, ipaddr, id32, signature)];
+    
+    while(EOK_uint16dummy != e)
+    {
+        eo_confman_entry_t *entry = &p->entries[e];
+        if((ipaddr == entry->ipaddr) && (id32 == entry->ropdes.id32) && (signature == entry->signature))
+        {
+            return(e);
+        }
+        e = entry->next;
+    }
+    
+    return(EOK_uint16dummy);
+}
+
+
+static void s_eo_confman_track(EOconfirmationManager *p, uint16_t e, eOipv4addr_t toipaddr, eOabstime_t now)
+{   // e is out of the pending list
+    uint8_t index = EOK_uint08dummy;
+    eo_confman_board_t *board = s_eo_confman_board(p, toipaddr, &index);
+    eo_confman_entry_t *entry = &p->entries[e];
+    uint16_t old = s_eo_confman_find(p, toipaddr, entry->ropdes.id32, entry->signature);
+    
+    if(EOK_uint16dummy != old)
+    {   // the same rop sent again by the user before its confirmation: we refresh the tracked one
+        eo_confman_entry_t *tracked = &p->entries[old];
+        if((NULL != entry->ropdes.data) && (NULL != tracked->ropdes.data))
+        {
+            memcpy(tracked->ropdes.data, entry->ropdes.data, entry->ropdes.size);
+        }
+        if(tracked->retransmissions == 0)
+        {   // its rtt would be ambiguous
+            tracked->retransmissions = 1;
+            if(NULL != board)
+            {
+                board->stats.requested++;
+            }
+        }
+        tracked->lastsent = now;
+        s_eo_confman_wheel_remove(p, old);
+        tracked->queued = 0;
+        tracked->expiry = now + p->config.timeout;
+        s_eo_confman_wheel_insert(p, old);
+        s_eo_confman_free(p, e);
+    }
+    else
+    {
+        uint16_t b = s_eo_confman_bucket(p, toipaddr, entry->ropdes.id32, entry->signature);
+        entry->ipaddr = toipaddr;
+        entry->board = index;
+        entry->firstsent = entry->lastsent = now;
+        entry->expiry = now + p->config.timeout;
+        entry->next = p->buckets[b];
+        p->buckets[b] = e;
+        s_eo_confman_wheel_insert(p, e);
+        if(NULL != board)
+        {
+            board->stats.requested++;
+            board->stats.outstanding++;
+            if(board->stats.outstanding > board->stats.maxoutstanding)
+            {
+                board->stats.maxoutstanding = board->stats.outstanding;
+            }
+        }
+    }
+}
+
+
+static void s_eo_confman_remove(EOconfirmationManager *p, uint16_t e)
+{
+    eo_confman_entry_t *entry = &p->entries[e];
+    uint16_t b = s_eo_confman_bucket(p, entry->ipaddr, entry->ropdes.id32, entry->signature);
+    uint16_t *link = &p->buckets[b];
+    
+    while(EOK_uint16dummy != *link)
+    {
+        if(e == *link)
+        {
+            *link = entry->next;
+            break;
+        }
+        link = &p->entries[*link].next;
+    }
+    
+    s_eo_confman_wheel_remove(p, e);
+    
+    if(e == p->retransmitting)
+    {
+        p->retransmitting = EOK_uint16dummy;
+    }
+    
+    if((EOK_uint08dummy != entry->board) && (p->boards[entry->board].stats.outstanding > 0))
+    {
+        p->boards[entry->board].stats.outstanding--;
+    }
+    
+    s_eo_confman_free(p, e);
+}
+
+
+static void s_eo_confman_free(EOconfirmationManager *p, uint16_t e)
+{
+    p->entries[e].next = p->freeentry;
+    p->freeentry = e;
+}
+
+
+static void s_eo_confman_wheel_insert(EOconfirmationManager *p, uint16_t e)
+{
+    eo_confman_entry_t *entry = &p->entries[e];
+    uint16_t slot = (entry->expiry / p->wheelresolution) % eo_confman_wheelslots;
+    
+    entry->wheelprev = EOK_uint16dummy;
+    entry->wheelnext = p->wheel[slot];
+    if(EOK_uint16dummy != entry->wheelnext)
+    {
+        p->entries[entry->wheelnext].wheelprev = e;
+    }
+    p->wheel[slot] = e;
+}
+
+
+static void s_eo_confman_wheel_remove(EOconfirmationManager *p, uint16_t e)
+{   // it also removes a queued entry from the retransmits, which use the same links
+    eo_confman_entry_t *entry = &p->entries[e];
+    
+    if(EOK_uint16dummy != entry->wheelprev)
+    {
+        p->entries[entry->wheelprev].wheelnext = entry->wheelnext;
+    }
+    else if(1 == entry->queued)
+    {
+        p->retransmits = entry->wheelnext;
+    }
+    else
+    {
+        p->wheel[(entry->expiry / p->wheelresolution) % eo_confman_wheelslots] = entry->wheelnext;
+    }
+    
+    if(EOK_uint16dummy != entry->wheelnext)
+    {
+        p->entries[entry->wheelnext].wheelprev = entry->wheelprev;
+    }
+    
+    entry->wheelprev = entry->wheelnext = EOK_uint16dummy;
+}
+
+
+static uint16_t s_eo_confman_wheel_due(EOconfirmationManager *p, uint16_t slot, eOabstime_t now)
+{
+    uint16_t e = p->wheel[slot];
+    
+    while(EOK_uint16dummy != e)
+    {
+        if(p->entries[e].expiry <= now)
+        {
+            return(e);
+        }
+        e = p->entries[e].wheelnext;
+    }
+    
+    return(EOK_uint16dummy);
+}
+
+
+static eo_confman_board_t * s_eo_confman_board(EOconfirmationManager *p, eOipv4addr_t ipaddr, uint8_t *index)
+{
+    uint8_t i = 0;
+    
+    if(NULL != index)
+    {
+        *index = EOK_uint08dummy;
+    }
+    
+    if(NULL == p->boards)
+    {
+        return(NULL);
+    }
+    
+    for(i=0; i<p->numberofboards; i++)
+    {
+        if(ipaddr == p->boards[i].ipaddr)
+        {
+            break;
+        }
+    }
+    
+    if(i == p->numberofboards)
+    {   // a new one, if there is room
+        if((p->numberofboards >= p->config.maxnumberofboards) || (EOK_uint08dummy == i))
+        {
+            return(NULL);
+        }
+        memset(&p->boards[i], 0, sizeof(eo_confman_board_t));
+        p->boards[i].ipaddr = ipaddr;
+        p->numberofboards++;
+    }
+    
+    if(NULL != index)
+    {
+        *index = i;
+    }
+    
+    return(&p->boards[i]);
+}
+
+
+static uint32_t s_eo_confman_signature(const eOropdescriptor_t *ropdes)
+{
+    return((1 == ropdes->control.plussign) ? (ropdes->signature) : (EOK_uint32dummy));
+}
+
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
@@ -31,7 +31,15 @@ extern "C" {
 **/
 
 /** @defgroup eo_confman Object EOconfirmationManager
-    The EOconfirmationManager object is used as ...
+    The EOconfirmationManager object is used by the transceiver to manage the ROPs which request a confirmation.
+    The requests are queued when the ROP is loaded and are notified by on_rop_conf_requested() when the packet which
+    contains them is transmitted. The confirmations are notified by on_rop_conf_received().
+    If maxnumberofoutstanding and timeout are not zero the object also keeps track of every request until its confirmation: the
+    requests are indexed by (IP, ID32, signature) so that a received ack/nak is matched in constant time, and their
+    expiry is kept in a timer wheel. At expiry a request is retransmitted up to maxretransmissions times (only if its
+    data is not bigger than maxsizeofdata) and then it is dropped and notified by on_rop_conf_timeout(). The object
+    also keeps per board statistics of the outstanding requests and of the round trip time. The tracking is off in
+    eOconfman_cfg_default.
          
     @{        
  **/
@@ -74,7 +82,37 @@ typedef struct
     eov_mutex_fn_mutexderived_new       mutex_fn_new;
     void (*on_rop_conf_requested)(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
     void (*on_rop_conf_received)(eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
+    uint16_t                            maxnumberofoutstanding;     // if 0 the requests are not tracked
+    uint16_t                            maxsizeofdata;              // the bytes of data kept for retransmission
+    uint8_t                             maxretransmissions;
+    uint8_t                             maxnumberofboards;          // of the statistics
+    uint32_t                            timeout;                    // in usec
+    void (*on_rop_conf_timeout)(eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
 } eOconfman_cfg_t;
+
+
+/** @typedef    typedef eOresult_t (*eOconfman_fn_retransmit_t)(void *arg, eOropdescriptor_t *ropdes)
+    @brief      it is used by eo_confman_Timeouts_Process() to load again a ROP into the transmitter.
+ **/
+typedef eOresult_t (*eOconfman_fn_retransmit_t)(void *arg, eOropdescriptor_t *ropdes);
+
+
+typedef struct
+{
+    uint16_t    outstanding;            // requests waiting for their confirmation
+    uint16_t    maxoutstanding;         // the maximum value reached by outstanding
+    uint32_t    requested;              // requests transmitted, retransmissions excluded
+    uint32_t    acked;
+    uint32_t    nacked;
+    uint32_t    timedout;               // requests dropped after the last retransmission
+    uint32_t    retransmitted;
+    uint32_t    unmatched;              // confirmations without any outstanding request
+    uint32_t    overflow;               // requests not tracked because there was no room
+    uint32_t    rttmin;                 // in usec, of the requests confirmed without retransmissions
+    uint32_t    rttmax;
+    uint32_t    rttcount;
+    uint64_t    rttsum;
+} eOconfman_stats_t;
  
 
     
@@ -98,12 +136,44 @@ extern void eo_confman_Delete(EOconfirmationManager *p);
 
 extern eOresult_t eo_confman_ConfirmationRequest_Insert(EOconfirmationManager *p, eOropdescriptor_t* ropdesc);
 
+/** @fn         extern eOresult_t eo_confman_ConfirmationRequest_Transmitted(EOconfirmationManager *p, eOipv4addr_t toipaddr, eOnvID32_t id32, uint32_t signature)
+    @brief      it tells that a rop with a request of confirmation has left the transmitter towards toipaddr, placed 
+                inside a packet or dropped: its timeout starts now. a retransmission loaded by eo_confman_Timeouts_Process()
+                keeps its entry, which is armed again here.
+    @param      signature   the signature of the rop or EOK_uint32dummy if the rop does not have it.
+    @return     eores_OK if the rop is tracked, eores_NOK_generic if it is not.
+ **/
+extern eOresult_t eo_confman_ConfirmationRequest_Transmitted(EOconfirmationManager *p, eOipv4addr_t toipaddr, eOnvID32_t id32, uint32_t signature);
+
 extern eOresult_t eo_confman_ConfirmationRequests_Process(EOconfirmationManager *p, eOipv4addr_t toipaddr);
     
 extern eOresult_t eo_confman_Confirmation_Requested(EOconfirmationManager *p, eOipv4addr_t toipaddr, eOropdescriptor_t* ropdes);
 
 extern eOresult_t eo_confman_Confirmation_Received(EOconfirmationManager *p, eOipv4addr_t fromipaddr, eOropdescriptor_t* ropdes);
 
+/** @fn         extern eOresult_t eo_confman_Timeouts_Process(EOconfirmationManager *p, eOconfman_fn_retransmit_t fn, void *arg)
+    @brief      it expires the outstanding requests whose timeout is over. each of them is either loaded again with 
+                fn(arg, ropdes) or dropped and notified with on_rop_conf_timeout(). it is called by the transmitter 
+                before it prepares a packet, and fn must not be called with the mutex of the object taken. the rop which 
+                fn loads keeps the entry of the request and its timeout starts again when it is transmitted.
+    @param      p           the object.
+    @param      fn          the function which loads a ROP. if NULL there is no retransmission.
+    @param      arg         the argument of fn.
+    @return     eores_NOK_nullpointer if p is NULL or eores_OK on success.    
+ **/
+extern eOresult_t eo_confman_Timeouts_Process(EOconfirmationManager *p, eOconfman_fn_retransmit_t fn, void *arg);
+
+/** @fn         extern uint16_t eo_confman_Outstanding_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr)
+    @brief      it gives the number of requests to a board which wait for their confirmation.
+ **/
+extern uint16_t eo_confman_Outstanding_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr);
+
+/** @fn         extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOconfman_stats_t *stats)
+    @brief      it retrieves the statistics of the requests to a board.
+    @return     eores_NOK_nullpointer, eores_NOK_generic if there are no statistics of the board, or eores_OK.    
+ **/
+extern eOresult_t eo_confman_Stats_Get(EOconfirmationManager *p, eOipv4addr_t ipaddr, eOconfman_stats_t *stats);
+
 
 
 
@@ -47,6 +47,31 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+enum { eo_confman_wheelslots = 64 };
+
+typedef struct
+{
+    eOropdescriptor_t       ropdes;         // ropdes.data points inside the data kept by the object, or it is NULL
+    eOipv4addr_t            ipaddr;
+    uint32_t                signature;      // ropdes.signature or EOK_uint32dummy if the rop does not have it
+    eOabstime_t             firstsent;
+    eOabstime_t             lastsent;
+    eOabstime_t             expiry;
+    uint8_t                 retransmissions;
+    uint8_t                 canretransmit;
+    uint8_t                 board;          // index of the statistics
+    uint8_t                 queued;         // 1 if its retransmission waits inside the transmitter: it is in the retransmits and not in the wheel
+    uint16_t                next;           // next entry in the same bucket, in the pending list or in the free list
+    uint16_t                wheelprev;      // double link inside the slot of the wheel or inside the retransmits
+    uint16_t                wheelnext;
+} eo_confman_entry_t;
+
+
+typedef struct
+{
+    eOipv4addr_t            ipaddr;
+    eOconfman_stats_t       stats;
+} eo_confman_board_t;
 
 
 /** @struct     EOconfirmationManager_hid
@@ -60,6 +85,22 @@ struct EOconfirmationManager_hid
     eOconfman_cfg_t     config;
     EOvector*           confrequests;
     EOVmutexDerived*    mtx;
+    // the tracking of the outstanding requests
+    eo_confman_entry_t* entries;        // maxnumberofoutstanding
+    uint8_t*            data;           // maxsizeofdata for every entry
+    uint16_t*           buckets;        // index on (ip, id32, signature): first entry of every bucket or EOK_uint16dummy
+    uint16_t            bucketmask;
+    uint16_t            freeentry;
+    uint16_t            pending;        // entries loaded but not yet transmitted, in order of load
+    uint16_t            pendinglast;
+    uint16_t            pendingoverflow;    // rops not tracked since the last transmission
+    uint16_t            retransmits;    // tracked entries loaded again but not yet transmitted
+    uint16_t            retransmitting; // the entry whose rop eo_confman_Timeouts_Process() is loading again
+    uint16_t            wheel[eo_confman_wheelslots];
+    eOabstime_t         wheelresolution;
+    eOabstime_t         wheeltick;
+    eo_confman_board_t* boards;         // maxnumberofboards
+    uint8_t             numberofboards;
 }; 
 
 
@@ -103,7 +103,9 @@ const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)      NULL,
         EO_INIT(.onerrorinvalidframe)   NULL
-    }    
+    },
+    EO_INIT(.nvsetlazyinit)             eobool_false,
+    EO_INIT(.nvsetsharedname)           NULL
 };
 
 
@@ -162,6 +164,33 @@ extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t
 }    
 
 
+extern eOresult_t eo_hosttransceiver_PrepareConcurrentNew(const eOhosttransceiver_cfg_t *cfgs, uint16_t number)
+{
+    eOnvBRD_t maxboard = 0;
+    uint16_t i = 0;
+    
+    if((NULL == cfgs) || (0 == number))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    for(i=0; i<number; i++)
+    {
+        if(NULL == cfgs[i].nvsetbrdcfg)
+        {
+            return(eores_NOK_nullpointer);
+        }
+        if(cfgs[i].nvsetbrdcfg->boardnum > maxboard)
+        {
+            maxboard = cfgs[i].nvsetbrdcfg->boardnum;
+        }
+    }
+    
+    // the library keeps the boards in an array: reserving the biggest number reserves also all the others
+    return(eoprot_config_board_reserve(maxboard));
+}
+
+
 extern void eo_hosttransceiver_Delete(EOhostTransceiver *p) 
 {    
     if(NULL == p)
@@ -241,6 +270,8 @@ extern eOipv4addr_t eo_hosttransceiver_GetRemoteIP(EOhostTransceiver* p)
 static EOnvSet* s_eo_hosttransceiver_nvset_get(const eOhosttransceiver_cfg_t *cfg)
 {
     EOnvSet* nvset = eo_nvset_New(cfg->nvsetprotection, cfg->mutex_fn_new);    
+    eo_nvset_NVSlazyinitialise(nvset, cfg->nvsetlazyinit);
+    eo_nvset_SharedMemoryExport(nvset, cfg->nvsetsharedname);
     eo_nvset_InitBRD_LoadEPs(nvset, eo_nvset_ownership_remote, cfg->remoteboardipv4addr, (eOnvset_BRDcfg_t*)cfg->nvsetbrdcfg, eobool_true);   
     return(nvset);
 }
@@ -76,6 +76,8 @@ typedef struct
     eOnvset_protection_t            nvsetprotection; 
     eOconfman_cfg_t*                confmancfg;
     eOtransceiver_extfn_t           extfn;
+    eObool_t                        nvsetlazyinit;      /**< if true the NVs get their default value at their first access */
+    const char*                     nvsetsharedname;    /**< if not NULL the NVs are exported in shared memory with this name. see eo_nvset_SharedMemoryExport() */
 } eOhosttransceiver_cfg_t;
 
 
@@ -106,6 +108,19 @@ extern EMBOBJ_API const eOhosttransceiver_cfg_t eo_hosttransceiver_cfg_default;
  **/
 extern EOhostTransceiver * eo_hosttransceiver_New(const eOhosttransceiver_cfg_t *cfg);
 
+
+/** @fn         extern eOresult_t eo_hosttransceiver_PrepareConcurrentNew(const eOhosttransceiver_cfg_t *cfgs, uint16_t number)
+    @brief      Prepares the creation of many EOhostTransceiver at the same time. The only state that eo_hosttransceiver_New() 
+                shares with the other transceivers is the board number it reserves in the EoProtocol library, which may move 
+                the data of the boards already reserved. This function reserves at once the boards of all the cfgs, so that 
+                afterwards eo_hosttransceiver_New() can be called for them from more threads concurrently. The EOtheMemoryPool 
+                must be in eo_mempool_alloc_dynamic mode and the mutex_fn_new of the cfgs, if any, must be thread safe.
+    @param      cfgs        The configurations of the transceivers which will be created. 
+    @param      number      Their number.
+    @return     eores_OK, eores_NOK_nullpointer, or eores_NOK_generic if a board cannot be reserved.
+ **/
+extern eOresult_t eo_hosttransceiver_PrepareConcurrentNew(const eOhosttransceiver_cfg_t *cfgs, uint16_t number);
+
 extern void eo_hosttransceiver_Delete(EOhostTransceiver *p);
 
 
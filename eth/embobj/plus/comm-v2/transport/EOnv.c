@@ -85,6 +85,8 @@
 static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
 static eOresult_t s_eo_nv_Set(const EOnv *nv, const void *dat, void *dst, eOnvUpdate_t upd);
 static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescriptor_t *ropdes);
+static void s_eo_nv_CopyToRAM(const EOnv *nv, const void *src, void *dst, uint16_t size);
+static void s_eo_nv_CopyFromRAM(const EOnv *nv, void *dst, uint16_t size);
 
 
 EO_static_inline uint16_t s_eo_nv_get_size2(const EOnv *nv)
@@ -147,6 +149,7 @@ extern eOresult_t eo_nv_Clear(EOnv *nv)
     nv->rom         = NULL;       
     nv->ram         = NULL;  
     nv->mtx         = NULL;
+    nv->seqlock     = NULL;
       
     return(eores_OK);
 }
@@ -227,11 +230,8 @@ extern eOresult_t eo_nv_Get(const EOnv *nv, eOnvStorage_t strg, void *data, uint
     {
         case eo_nv_strg_volatile:
         {   // better to protect so that the copy is atomic and not interrupted by other tasks which write 
-            source = nv->ram;       
             *size = s_eo_nv_get_size2(nv);  
-            eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-            memcpy(data, source, *size); 
-            eov_mutex_Release(nv->mtx);
+            s_eo_nv_CopyFromRAM(nv, data, *size);
             res = eores_OK;
         } break;
 
@@ -343,7 +343,7 @@ extern eOnvOwnership_t eo_nv_GetOwnership(const EOnv *nv)
 // --------------------------------------------------------------------------------------------------------------------
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx)
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, eOseqlock_t* seqlock)
 {
     nv->ip          = ip;
     nv->brd         = brd;
@@ -353,15 +353,14 @@ extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eOboo
     nv->rom         = rom;
     nv->ram         = ram; 
     nv->mtx         = mtx;
+    nv->seqlock     = seqlock;
            
     return(eores_OK);
 }
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest)
 {
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-    memcpy(dest, nv->ram, nv->rom->capacity);
-    eov_mutex_Release(nv->mtx);    
+    s_eo_nv_CopyFromRAM(nv, dest, nv->rom->capacity);
 }
 
 
@@ -488,9 +487,7 @@ static eOresult_t s_eo_nv_SetROP(const EOnv *nv, const void *dat, void *dst, eOn
     uint16_t size = s_eo_nv_get_size2(nv);
 
     // copy data
-    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
-    memcpy(dst, dat, size);
-    eov_mutex_Release(nv->mtx);
+    s_eo_nv_CopyToRAM(nv, dat, dst, size);
 
     // call the update function if necessary
     s_eo_nv_UpdateROP(nv, upd, ropdes);
@@ -516,6 +513,42 @@ static void s_eo_nv_UpdateROP(const EOnv *nv, eOnvUpdate_t upd, const eOropdescr
 
 }
 
+// with the seqlock only the copies are protected: init(), update() and onsay() are called with a NULL mtx and 
+// run outside of it, so that they can read the nv without spinning against themselves
+static void s_eo_nv_CopyToRAM(const EOnv *nv, const void *src, void *dst, uint16_t size)
+{
+    if(NULL != nv->seqlock)
+    {
+        eo_seqlock_WriteBegin(nv->seqlock);
+        memcpy(dst, src, size);
+        eo_seqlock_WriteEnd(nv->seqlock);
+        return;
+    }
+    
+    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    memcpy(dst, src, size);
+    eov_mutex_Release(nv->mtx);
+}
+
+static void s_eo_nv_CopyFromRAM(const EOnv *nv, void *dst, uint16_t size)
+{
+    uint32_t s = 0;
+    
+    if(NULL != nv->seqlock)
+    {
+        do
+        {
+            s = eo_seqlock_ReadBegin(nv->seqlock);
+            memcpy(dst, nv->ram, size);
+        } while(eobool_true == eo_seqlock_ReadRetry(nv->seqlock, s));
+        return;
+    }
+    
+    eov_mutex_Take(nv->mtx, eok_reltimeINFINITE);
+    memcpy(dst, nv->ram, size);
+    eov_mutex_Release(nv->mtx);
+}
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
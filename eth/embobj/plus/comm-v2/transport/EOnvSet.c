@@ -25,6 +25,7 @@
 #include "string.h"
 #include "EOtheMemoryPool.h"
 #include "EOtheErrorManager.h"
+#include "EoAtomic.h"
 
 #include "EOnv_hid.h" 
 
@@ -33,6 +34,12 @@
 
 #include "EOconstvector_hid.h"
 
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - declaration of extern public interface
@@ -114,6 +121,20 @@ const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
+typedef enum
+{
+    eo_nvset_lazystate_pending  = 0,    // the NVs of the entity wait for their init
+    eo_nvset_lazystate_busy     = 1,    // a thread is initialising them
+    eo_nvset_lazystate_done     = 2
+} eOnvset_lazystate_t;
+
+
+// the host keeps per thread the number of lazy inits which the thread is doing, so that it detects a wait inside one
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+#define EO_NVSET_THREADLOCAL    __thread
+#elif defined(EO_TAILOR_CODE_FOR_WINDOWS)
+#define EO_NVSET_THREADLOCAL    __declspec(thread)
+#endif
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -123,11 +144,20 @@ const eOnvset_BRDcfg_t eonvset_BRDcfgStd =
 static eOresult_t s_eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum);
 
 static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoint, eOnvEP8_t ep08);
+static void s_eo_nvset_NVs_Initialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t from, uint16_t to, const eOseqlock_t* writing);
+static void s_eo_nvset_NVsOfEntity_LazyInitialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, eOprotIndex_t index);
+static void s_eo_nvset_NVsOfEP_LazyInitialise(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static eObool_t s_eo_nvset_lazy_claim(volatile uint8_t* state);
+static void s_eo_nvset_lazy_done(volatile uint8_t* state);
+static eOresult_t s_eo_nvset_shm_create(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t numberofentities, uint16_t sizeofram);
+static void s_eo_nvset_shm_publish(EOnvSet* p, eOnvset_ep_t* theEndpoint);
+static void s_eo_nvset_shm_destroy(EOnvSet* p, eOnvset_ep_t* theEndpoint);
 
 static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p);
 static eOresult_t s_eo_nvset_DeinitDEV(EOnvSet* p);
 
 static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32);
+static eOseqlock_t* s_eo_nvset_get_seqlock(eOnvset_ep_t* theEndpoint, eOnvENT_t ent, eOprotIndex_t index);
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8);
 uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
@@ -138,6 +168,10 @@ uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08);
 
 //static const char s_eobj_ownname[] = "EOnvSet";
 
+#if defined(EO_NVSET_THREADLOCAL)
+static EO_NVSET_THREADLOCAL uint8_t s_eo_nvset_lazy_claimed = 0;
+#endif
+
 
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
@@ -154,12 +188,92 @@ extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderive
     // i dont initialise yet the device. i simply rely on the fact that it contains all zero data.
     p->theboard.ipaddress       = 0;    
     p->mtxderived_new           = mtxnew; 
-    p->protection               = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    if(eo_nvset_protection_seqlock_per_entity == prot)
+    {
+        p->protection           = prot;
+    }
+    else
+    {
+        p->protection           = (NULL == mtxnew) ? (eo_nvset_protection_none) : (prot); 
+    }
+    p->lazyinit                 = eobool_false;
 
     return(p);
 }
 
 
+extern eOresult_t eo_nvset_NVSlazyinitialise(EOnvSet* p, eObool_t enable)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((NULL != p->theboard.theendpoints) && (0 != eo_vector_Size(p->theboard.theendpoints)))
+    {   // the endpoints already loaded would keep the other mode
+        return(eores_NOK_generic);
+    }
+    
+    p->lazyinit = enable;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_nvset_SharedMemoryExport(EOnvSet* p, const char *name)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((NULL != p->theboard.theendpoints) && (0 != eo_vector_Size(p->theboard.theendpoints)))
+    {   // the endpoints already loaded would stay in private memory
+        return(eores_NOK_generic);
+    }
+    
+    if(NULL == name)
+    {
+        p->sharedname[0] = '\0';
+        return(eores_OK);
+    }
+    
+#if defined(EO_TAILOR_CODE_FOR_LINUX)    
+    if(eo_nvset_protection_seqlock_per_entity != p->protection)
+    {   // the readers of the other processes could not tell a torn copy
+        return(eores_NOK_unsupported);
+    }
+    
+    // the segment is /name-epN, thus name cannot have slashes
+    if(('\0' == name[0]) || (strlen(name) >= sizeof(p->sharedname)) || (NULL != strchr(name, '/')))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    snprintf(p->sharedname, sizeof(p->sharedname), "%s", name);
+    
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+extern eOresult_t eo_nvset_SharedMemoryName(const char *name, eOnvEP8_t ep8, char *segment, uint16_t size)
+{
+    int n = 0;
+    
+    if((NULL == name) || (NULL == segment))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    n = snprintf(segment, size, "/%s-ep%d", name, ep8);
+    
+    return(((n < 0) || (n >= size)) ? eores_NOK_generic : eores_OK);
+}
+
+
 extern void eo_nvset_Delete(EOnvSet* p)
 {   
     if(NULL == p)
@@ -345,18 +459,36 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
 
 #define EO_NVSET_INIT_EVERY_NV
 #if defined(EO_NVSET_INIT_EVERY_NV)
+    if(NULL == theEndpoint->lazystates)
+    {   // else the NVs of each entity are initialised at its first access
+        s_eo_nvset_NVs_Initialise(p, theEndpoint, 0, theEndpoint->epnvsnumberof, NULL);
+    }
+#endif //EO_NVSET_INIT_EVERY_NV                   
+
+    
+    return(eores_OK);    
+}
+
+
+// if writing is not NULL the caller is inside its write: the NVs which use it are given to init() without it, so that
+// init() does not spin against the caller
+static void s_eo_nvset_NVs_Initialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t from, uint16_t to, const eOseqlock_t* writing)
+{
+    eOnvset_brd_t* theBoard = &p->theboard;
+    eOnvEP8_t ep08 = theEndpoint->epcfg.endpoint;
+
     {   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
         EOnv thenv = {0};
         uint16_t k = 0;
         EOnv_rom_t* rom = NULL;
         uint8_t* ram = NULL;
-        uint16_t nvars = theEndpoint->epnvsnumberof;
         eOipv4addr_t ip = theBoard->ipaddress;
         uint8_t brd =  theBoard->boardnum; // local or 0, 1, 2, 3
         eOnvID32_t id32 = EOK_uint32dummy;     
         uint32_t prog = 0;
         eObool_t proxied = eobool_false;
         eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
+        eOseqlock_t* seqlock = NULL;
         
         EOVmutexDerived* mtx2use = NULL;
 
@@ -370,7 +502,7 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
         }
         // else if eo_nvset_protection_one_per_netvar ... eval foreach k
 
-        for(k=0; k<nvars; k++)
+        for(k=from; k<to; k++)
         {
             if(eo_nvset_protection_one_per_netvar == p->protection)
             {
@@ -397,6 +529,12 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
             ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
             // - 3. the mtx
             mtx2use = mtx2use;
+            // - 4. the seqlock
+            seqlock = s_eo_nvset_get_seqlock(theEndpoint, eoprot_ID2entity(id32), eoprot_ID2index(id32));
+            if(writing == seqlock)
+            {
+                seqlock = NULL;
+            }
             // - load everything into the nv
             eo_nv_hid_Load(     &thenv,
                                 ip, 
@@ -406,17 +544,14 @@ static eOresult_t s_eo_nvset_NVsOfEP_Initialise(EOnvSet* p, eOnvset_ep_t* endpoi
                                 onsay,
                                 rom,
                                 ram,
-                                mtx2use
+                                mtx2use,
+                                seqlock
                           );                    
             
          
             eo_nv_Init(&thenv);                             
         }
     }   // put parenthesis to create a new scope and avoid errors in non c99 environments as windows
-#endif //EO_NVSET_INIT_EVERY_NV                   
-
-    
-    return(eores_OK);    
 }
   
 
@@ -438,6 +573,7 @@ extern eOresult_t eo_nvset_NVSinitialise(EOnvSet* p)
     {
         eOnvset_ep_t** theEndpoint = (eOnvset_ep_t**) eo_vector_At(theBoard->theendpoints, j);                        
         s_eo_nvset_NVsOfEP_Initialise(p, (*theEndpoint), (*theEndpoint)->epcfg.endpoint);
+        s_eo_nvset_NVsOfEP_LazyInitialise(p, (*theEndpoint));
     }       
 
     return(eores_OK);
@@ -459,6 +595,11 @@ extern void* eo_nvset_RAMofEndpoint_Get(EOnvSet* p, eOnvEP8_t ep8)
         return(NULL); 
     }
     
+    if(eobool_true == p->lazyinit)
+    {
+        s_eo_nvset_NVsOfEP_LazyInitialise(p, s_eo_nvset_get_endpoint(p, ep8));
+    }
+    
     // get directly the ram using the eoprot function.     
     return(eoprot_endpoint_ramof_get(p->theboard.boardnum, ep8));   
 }
@@ -471,17 +612,86 @@ extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent,
         return(NULL); 
     }
     
+    if(eobool_true == p->lazyinit)
+    {
+        s_eo_nvset_NVsOfEntity_LazyInitialise(p, s_eo_nvset_get_endpoint(p, ep8), ent, index);
+    }
+    
     // get directly the ram using the eoprot function.     
     return(eoprot_entity_ramof_get(p->theboard.boardnum, ep8, ent, index));
 }
 
 
+extern eOresult_t eo_nvset_RAMofEntity_Snapshot(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size)
+{
+    eOnvset_ep_t* theEndpoint = NULL;
+    EOVmutexDerived* mtx2use = NULL;
+    eOseqlock_t* seqlock = NULL;
+    void* ram = NULL;
+    uint16_t sizeofentity = 0;
+    uint32_t s = 0;
+    
+    if((NULL == p) || (NULL == data) || (NULL == size)) 
+    {
+        return(eores_NOK_nullpointer); 
+    }
+    
+    theEndpoint = s_eo_nvset_get_endpoint(p, ep8);
+    ram = eoprot_entity_ramof_get(p->theboard.boardnum, ep8, ent, index);
+    sizeofentity = eoprot_entity_sizeof_get(p->theboard.boardnum, ep8, ent);
+    if((NULL == theEndpoint) || (NULL == ram) || (0 == sizeofentity))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    if(eobool_true == p->lazyinit)
+    {
+        s_eo_nvset_NVsOfEntity_LazyInitialise(p, theEndpoint, ent, index);
+    }
+    
+    switch(p->protection)
+    {
+        case eo_nvset_protection_seqlock_per_entity:
+        {
+            seqlock = s_eo_nvset_get_seqlock(theEndpoint, ent, index);
+            do
+            {
+                s = eo_seqlock_ReadBegin(seqlock);
+                memcpy(data, ram, sizeofentity);
+            } while(eobool_true == eo_seqlock_ReadRetry(seqlock, s));
+        } break;
+        
+        case eo_nvset_protection_one_per_netvar:
+        {   // every nv of the entity has its own mutex: we cannot hold them all together
+            return(eores_NOK_unsupported);
+        } 
+        
+        default:
+        {
+            mtx2use = (eo_nvset_protection_one_per_board == p->protection) ? p->theboard.mtx_board : theEndpoint->mtx_endpoint;
+            eov_mutex_Take(mtx2use, eok_reltimeINFINITE);
+            memcpy(data, ram, sizeofentity);
+            eov_mutex_Release(mtx2use);
+        } break;
+    }
+    
+    *size = sizeofentity;
+    
+    return(eores_OK);
+}
+
+
 extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32)
 { 
     if((NULL == p)) 
     {
         return(NULL); 
     }
+    
+    if(eobool_true == p->lazyinit)
+    {
+        s_eo_nvset_NVsOfEntity_LazyInitialise(p, s_eo_nvset_get_endpoint(p, eoprot_ID2endpoint(id32)), eoprot_ID2entity(id32), eoprot_ID2index(id32));
+    }
 
     return(eoprot_variable_ramof_get(p->theboard.boardnum, id32));
 }
@@ -508,6 +718,7 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     EOnv_rom_t* rom = NULL;
     uint8_t* ram = NULL;
     EOVmutexDerived* mtx2use = NULL;
+    eOseqlock_t* seqlock = NULL;
     eOvoid_fp_cnvp_cropdesp_t onsay = NULL;
  
     if((NULL == p) || (NULL == thenv)) 
@@ -523,6 +734,12 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
         return(eores_NOK_generic);       
     }
     
+    // - the nv must have been initialised before it is used
+    if(eobool_true == p->lazyinit)
+    {
+        s_eo_nvset_NVsOfEntity_LazyInitialise(p, s_eo_nvset_get_endpoint(p, ep8), eoprot_ID2entity(id32), eoprot_ID2index(id32));
+    }
+    
     // - retrieve from the device and endpoint what is required to form the netvar: con, ram, mtx, etc.   
     // - 0+. proxied? 
     proxied = eoprot_variable_is_proxied(brd, id32);
@@ -534,6 +751,11 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
     ram = (uint8_t*) eoprot_variable_ramof_get(brd, id32);
     // - 3. the mtx
     mtx2use = s_eo_nvset_get_nvmutex(p, id32);
+    // - 4. the seqlock
+    if(eo_nvset_protection_seqlock_per_entity == p->protection)
+    {
+        seqlock = s_eo_nvset_get_seqlock(s_eo_nvset_get_endpoint(p, ep8), eoprot_ID2entity(id32), eoprot_ID2index(id32));
+    }
         
     // - final control about the validity of id32. it may be redundant but it is safer. for instance if the fptr_isepidsupported()
     //   does not take into account a removed tag and just checks that the tag-number is lower than the max allowed.
@@ -553,7 +775,8 @@ extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv)
                         onsay,
                         rom,
                         ram,
-                        mtx2use
+                        mtx2use,
+                        seqlock
                   );    
 
     return(eores_OK);
@@ -635,6 +858,7 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     eOnvset_ep_t *theEndpoint = NULL;
     uint16_t epnvsnumberof = 0;  
     uint16_t sizeofram =0;
+    uint16_t numberofentities = 0;
  
     if((NULL == p) || (NULL == cfgofep)) 
     {
@@ -671,12 +895,63 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     
     theEndpoint->epnvsnumberof      = epnvsnumberof;
     theEndpoint->initted            = eobool_false;    
-    theEndpoint->epram              = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
     theEndpoint->mtx_endpoint       = (eo_nvset_protection_one_per_endpoint == p->protection) ? p->mtxderived_new() : NULL;
+    
+    // the seqlocks and the lazy states are one for each entity of every type: those of type i start at entityoffset[i]
+    {
+        uint16_t i;
+        numberofentities = 0;
+        for(i=0; i<eoprot_entities_maxnumberofsupported; i++)
+        {
+            theEndpoint->entityoffset[i] = numberofentities;
+            numberofentities += theEndpoint->epcfg.numberofentities[i];
+        }
+    }
+    
+    // now the ram and the seqlocks if needed: in shared memory if the endpoint is exported, else from the mempool
+    theEndpoint->seqlocks = NULL;
+    theEndpoint->shm = NULL;
+    theEndpoint->shmsize = 0;
+    if(('\0' != p->sharedname[0]) && (eores_OK != s_eo_nvset_shm_create(p, theEndpoint, numberofentities, sizeofram)))
+    {
+        char str[64] = {0};
+        snprintf(str, sizeof(str), "EOnvSet: ep %d not exported in shared memory", cfgofep->endpoint);  
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_warning, str, NULL, &eo_errman_DescrRuntimeErrorLocal);         
+    }
+    
+    if(NULL == theEndpoint->shm)
+    {
+        theEndpoint->epram = (void*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_auto, sizeofram, 1);
+        if(eo_nvset_protection_seqlock_per_entity == p->protection)
+        {
+            theEndpoint->seqlocks = (eOseqlock_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOseqlock_t), numberofentities);
+        }
+    }
+    
+    if(NULL != theEndpoint->seqlocks)
+    {
+        uint16_t i;
+        for(i=0; i<numberofentities; i++)
+        {
+            eo_seqlock_Init(&theEndpoint->seqlocks[i]);
+        }
+    }
         
     // now we must load the ram in the endpoint
     eoprot_config_endpoint_ram(brd, theEndpoint->epcfg.endpoint, theEndpoint->epram, sizeofram);
     
+    // and the states of the lazy init if needed
+    theEndpoint->lazystates = NULL;
+    if((eobool_true == p->lazyinit) && (eobool_true == initNVs))
+    {
+        uint16_t i;
+        theEndpoint->lazystates = (volatile uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), numberofentities);
+        for(i=0; i<numberofentities; i++)
+        {
+            theEndpoint->lazystates[i] = eo_nvset_lazystate_pending;
+        }
+    }
+    
     // now add the vector of mtx if needed.
     if(eo_nvset_protection_one_per_netvar == p->protection)
     {
@@ -699,6 +974,12 @@ extern eOresult_t eo_nvset_LoadEP(EOnvSet* p, eOprot_EPcfg_t *cfgofep, eObool_t
     {
         s_eo_nvset_NVsOfEP_Initialise(p, theEndpoint, theEndpoint->epcfg.endpoint); 
     }
+    
+    // only now the other processes can read the endpoint
+    if(NULL != theEndpoint->shm)
+    {
+        s_eo_nvset_shm_publish(p, theEndpoint);
+    }
 
     return(eores_OK);
 }
@@ -723,8 +1004,11 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
         eOnvset_ep_t **ppep = (eOnvset_ep_t **)eo_vector_At(theBoard->theendpoints, i);
         eOnvset_ep_t *theEndpoint = *ppep;
         
-        // now i erase memory associated with this endpoint
-        eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        // now i erase memory associated with this endpoint, unless it is in shared memory
+        if(NULL == theEndpoint->shm)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->epram);
+        }
         // and i dissociates that from from the internals of the eoprot library
         eoprot_config_endpoint_ram(theBoard->boardnum, theEndpoint->epcfg.endpoint, NULL, 0);
         // i also de-init the number of entities for that endpoint
@@ -747,6 +1031,18 @@ static eOresult_t s_eo_nvset_DeinitEPs(EOnvSet* p)
             } 
             eo_vector_Delete(theEndpoint->themtxofthenvs);
         }
+        if((NULL != theEndpoint->seqlocks) && (NULL == theEndpoint->shm))
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint->seqlocks);
+        }
+        if(NULL != theEndpoint->lazystates)
+        {
+            eo_mempool_Delete(eo_mempool_GetHandle(), (void*)theEndpoint->lazystates);
+        }
+        if(NULL != theEndpoint->shm)
+        {
+            s_eo_nvset_shm_destroy(p, theEndpoint);
+        }
    
         // now i erase the memory of the entire eOnvset_ep_t entry        
         eo_mempool_Delete(eo_mempool_GetHandle(), theEndpoint);       
@@ -810,6 +1106,125 @@ static EOVmutexDerived* s_eo_nvset_get_nvmutex(EOnvSet* p, eOnvID32_t id32)
 }
 
 
+static eOresult_t s_eo_nvset_shm_create(EOnvSet* p, eOnvset_ep_t* theEndpoint, uint16_t numberofentities, uint16_t sizeofram)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    char name[eonvset_shm_namesize+8] = {0};
+    eOnvset_shm_header_t *h = NULL;
+    uint32_t offsetofseqlocks = (sizeof(eOnvset_shm_header_t) + 7) & ~7;
+    uint32_t offsetofram = (offsetofseqlocks + numberofentities*sizeof(eOseqlock_t) + 7) & ~7;
+    uint32_t size = offsetofram + sizeofram;
+    void *m = NULL;
+    int fd = -1;
+    uint16_t i = 0;
+    
+    eo_nvset_SharedMemoryName(p->sharedname, theEndpoint->epcfg.endpoint, name, sizeof(name));
+    
+    // a segment left by a previous owner which has crashed is replaced. its readers keep the old one until they close it
+    shm_unlink(name);
+    if((fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644)) < 0)
+    {
+        return(eores_NOK_generic);
+    }
+    if(0 != ftruncate(fd, size))
+    {
+        close(fd);
+        shm_unlink(name);
+        return(eores_NOK_generic);
+    }
+    m = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(MAP_FAILED == m)
+    {
+        shm_unlink(name);
+        return(eores_NOK_generic);
+    }
+    
+    // the new segment is all zero and the generation is odd until s_eo_nvset_shm_publish()
+    h = (eOnvset_shm_header_t*) m;
+    h->magic                = eonvset_shm_magic;
+    h->version              = eonvset_shm_version;
+    h->headersize           = sizeof(eOnvset_shm_header_t);
+    h->ipaddress            = p->theboard.ipaddress;
+    h->board                = p->theboard.boardnum;
+    h->endpoint             = theEndpoint->epcfg.endpoint;
+    h->numberofseqlocks     = numberofentities;
+    h->generation           = 1;
+    h->sizeofram            = sizeofram;
+    h->offsetofseqlocks     = offsetofseqlocks;
+    h->offsetofram          = offsetofram;
+    for(i=0; i<eoprot_entities_maxnumberofsupported; i++)
+    {
+        h->numberofentities[i]  = theEndpoint->epcfg.numberofentities[i];
+        h->entityoffset[i]      = theEndpoint->entityoffset[i];
+    }
+    
+    theEndpoint->shm        = h;
+    theEndpoint->shmsize    = size;
+    theEndpoint->epram      = (uint8_t*)m + offsetofram;
+    theEndpoint->seqlocks   = (eOseqlock_t*)((uint8_t*)m + offsetofseqlocks);
+    
+    return(eores_OK);
+#else
+    return(eores_NOK_unsupported);
+#endif
+}
+
+
+static void s_eo_nvset_shm_publish(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    eOnvset_shm_header_t *h = theEndpoint->shm;
+    uint8_t i = 0;
+    
+    for(i=0; i<eoprot_entities_maxnumberofsupported; i++)
+    {
+        if(0 != h->numberofentities[i])
+        {
+            h->sizeofentity[i] = eoprot_entity_sizeof_get(p->theboard.boardnum, h->endpoint, i);
+            h->ramofentity[i] = (uint32_t)((uint8_t*)eoprot_entity_ramof_get(p->theboard.boardnum, h->endpoint, i, 0) - (uint8_t*)theEndpoint->epram);
+        }
+    }
+    
+    eo_atomic_u32_Store(&h->generation, h->generation+1);
+}
+
+
+static void s_eo_nvset_shm_destroy(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    char name[eonvset_shm_namesize+8] = {0};
+    
+    // the readers which still have the segment see an odd generation
+    eo_atomic_u32_Store(&theEndpoint->shm->generation, theEndpoint->shm->generation+1);
+    
+    eo_nvset_SharedMemoryName(p->sharedname, theEndpoint->epcfg.endpoint, name, sizeof(name));
+    munmap(theEndpoint->shm, theEndpoint->shmsize);
+    shm_unlink(name);
+    
+    theEndpoint->shm = NULL;
+    theEndpoint->shmsize = 0;
+    theEndpoint->epram = NULL;
+    theEndpoint->seqlocks = NULL;
+#endif
+}
+
+
+static eOseqlock_t* s_eo_nvset_get_seqlock(eOnvset_ep_t* theEndpoint, eOnvENT_t ent, eOprotIndex_t index)
+{
+    if((NULL == theEndpoint) || (NULL == theEndpoint->seqlocks))
+    {
+        return(NULL);
+    }
+    
+    if((ent >= eoprot_entities_maxnumberofsupported) || (index >= theEndpoint->epcfg.numberofentities[ent]))
+    {
+        return(NULL);
+    }
+    
+    return(&theEndpoint->seqlocks[theEndpoint->entityoffset[ent] + index]);
+}
+
+
 static eOnvset_ep_t* s_eo_nvset_get_endpoint(EOnvSet* p, eOnvEP8_t ep8)
 {
     eOnvset_brd_t* theBoard = &p->theboard;
@@ -843,6 +1258,123 @@ uint16_t s_eonvset_EP2INDEX(EOnvSet* p, uint8_t ep08)
     return(index);
 }        
 
+
+static void s_eo_nvset_NVsOfEntity_LazyInitialise(EOnvSet* p, eOnvset_ep_t* theEndpoint, eOnvENT_t ent, eOprotIndex_t index)
+{
+    volatile uint8_t* state = NULL;
+    eOseqlock_t* seqlock = NULL;
+    eOnvBRD_t brd = p->theboard.boardnum;
+    eOnvEP8_t ep08 = 0;
+    eOnvID32_t id32 = EOK_uint32dummy;
+    uint16_t from = 0;
+    uint16_t to = 0;
+    
+    if((NULL == theEndpoint) || (NULL == theEndpoint->lazystates))
+    {
+        return;
+    }
+    
+    if((ent >= eoprot_entities_maxnumberofsupported) || (index >= theEndpoint->epcfg.numberofentities[ent]))
+    {
+        return;
+    }
+    
+    state = &theEndpoint->lazystates[theEndpoint->entityoffset[ent] + index];
+    if(eobool_false == s_eo_nvset_lazy_claim(state))
+    {   // already initialised
+        return;
+    }
+    
+    // the NVs of an entity have consecutive progressive numbers starting from the one of tag 0
+    ep08 = theEndpoint->epcfg.endpoint;
+    from = eoprot_endpoint_id2prognum(brd, eoprot_ID_get(ep08, ent, index, 0));
+    for(to=from; to<theEndpoint->epnvsnumberof; to++)
+    {
+        id32 = eoprot_endpoint_prognum2id(brd, ep08, to);
+        if((eoprot_ID2entity(id32) != ent) || (eoprot_ID2index(id32) != index))
+        {
+            break;
+        }
+    }
+    
+    // the readers of the shared memory must not see the ram of the entity while init() writes it
+    seqlock = s_eo_nvset_get_seqlock(theEndpoint, ent, index);
+    if(NULL != seqlock)
+    {
+        eo_seqlock_WriteBegin(seqlock);
+    }
+    
+    s_eo_nvset_NVs_Initialise(p, theEndpoint, from, to, seqlock);
+    
+    if(NULL != seqlock)
+    {
+        eo_seqlock_WriteEnd(seqlock);
+    }
+    
+    s_eo_nvset_lazy_done(state);
+}
+
+
+static void s_eo_nvset_NVsOfEP_LazyInitialise(EOnvSet* p, eOnvset_ep_t* theEndpoint)
+{
+    eOnvENT_t ent = 0;
+    eOprotIndex_t index = 0;
+    
+    if((NULL == theEndpoint) || (NULL == theEndpoint->lazystates))
+    {
+        return;
+    }
+    
+    for(ent=0; ent<eoprot_entities_maxnumberofsupported; ent++)
+    {
+        for(index=0; index<theEndpoint->epcfg.numberofentities[ent]; index++)
+        {
+            s_eo_nvset_NVsOfEntity_LazyInitialise(p, theEndpoint, ent, index);
+        }
+    }
+}
+
+
+// it returns eobool_true if the caller must initialise the NVs and then call s_eo_nvset_lazy_done(). if another thread 
+// is already initialising them, it waits until that thread has finished. the init of the NVs must not access the NVs
+// of an EOnvSet with lazy init: a thread which waits while it is inside an init may wait for itself or for a thread
+// which waits for it. the host detects it and reports a fatal error rather than spinning forever.
+static eObool_t s_eo_nvset_lazy_claim(volatile uint8_t* state)
+{
+    if(eo_nvset_lazystate_done == eo_atomic_u08_Load(state))
+    {
+        return(eobool_false);
+    }
+    if(eobool_true == eo_atomic_u08_CompareExchange(state, eo_nvset_lazystate_pending, eo_nvset_lazystate_busy))
+    {
+#if defined(EO_NVSET_THREADLOCAL)
+        s_eo_nvset_lazy_claimed++;
+#endif
+        return(eobool_true);
+    }
+#if defined(EO_NVSET_THREADLOCAL)
+    if(0 != s_eo_nvset_lazy_claimed)
+    {
+        eo_errman_Error(eo_errman_GetHandle(), eo_errortype_fatal, "EOnvSet: the lazy init of the NVs accesses the NVs", NULL, &eo_errman_DescrRuntimeErrorLocal);
+        return(eobool_false);
+    }
+#endif
+    while(eo_nvset_lazystate_done != eo_atomic_u08_Load(state))
+    {
+        ;
+    }
+    return(eobool_false);
+}
+
+
+static void s_eo_nvset_lazy_done(volatile uint8_t* state)
+{
+#if defined(EO_NVSET_THREADLOCAL)
+    s_eo_nvset_lazy_claimed--;
+#endif
+    eo_atomic_u08_Store(state, eo_nvset_lazystate_done);
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
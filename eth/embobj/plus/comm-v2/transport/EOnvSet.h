@@ -45,6 +45,7 @@ extern "C" {
 #include "EOconstvector.h"
 #include "EOVmutex.h"
 #include "EoProtocol.h"
+#include "EoSeqlock.h"
 
 // - public #define  --------------------------------------------------------------------------------------------------
 // empty-section
@@ -100,9 +101,41 @@ typedef enum
     eo_nvset_protection_none               = 0,    /**< we dont protect vs concurrent access at all */
     eo_nvset_protection_one_per_board      = 2,    /**< all the NVs in a booard share the same mutex */
     eo_nvset_protection_one_per_endpoint   = 3,    /**< all the NVs in an endpoint inside each board share the same mutex */
-    eo_nvset_protection_one_per_netvar     = 4     /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_one_per_netvar     = 4,    /**< every NV has its own mutex: heavy use of memory but maximum concurrency */
+    eo_nvset_protection_seqlock_per_entity = 5     /**< every entity has a sequence lock: the readers never block and retry the copy 
+                                                        if a writer changed the entity meanwhile. it does not need any mutex, but as the
+                                                        readers spin it is meant for multi-core hosts and not for single-core boards */
 } eOnvset_protection_t;
 
+
+enum { eonvset_shm_magic = 0x4E565348, eonvset_shm_version = 1, eonvset_shm_namesize = 48 };
+
+/** @typedef    typedef struct eOnvset_shm_header_t
+    @brief      It is the start of the shared memory segment of an endpoint exported by eo_nvset_SharedMemoryExport().
+                The segment holds then numberofseqlocks eOseqlock_t at offsetofseqlocks, one per entity, and the ram of 
+                the endpoint at offsetofram. The entity of type t and index i has seqlock entityoffset[t] + i and its ram 
+                at ramofentity[t] + i * sizeofentity[t] from the start of the ram. The readers copy an entity between 
+                eo_seqlock_ReadBegin() and eo_seqlock_ReadRetry() on its seqlock.
+ **/
+typedef struct
+{
+    uint32_t            magic;                                                  /**< eonvset_shm_magic */
+    uint16_t            version;                                                /**< eonvset_shm_version */
+    uint16_t            headersize;
+    eOipv4addr_t        ipaddress;
+    eOnvBRD_t           board;
+    eOnvEP8_t           endpoint;
+    uint16_t            numberofseqlocks;
+    volatile uint32_t   generation;                                             /**< odd while the owner prepares or removes the endpoint */
+    uint32_t            sizeofram;
+    uint32_t            offsetofseqlocks;
+    uint32_t            offsetofram;
+    uint8_t             numberofentities[eoprot_entities_maxnumberofsupported];
+    uint16_t            entityoffset[eoprot_entities_maxnumberofsupported];
+    uint16_t            sizeofentity[eoprot_entities_maxnumberofsupported];
+    uint32_t            ramofentity[eoprot_entities_maxnumberofsupported];
+} eOnvset_shm_header_t;
+
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -114,12 +147,49 @@ extern EMBOBJ_API const eOnvset_BRDcfg_t eonvset_BRDcfgMax;   // it contains num
 
 // - declaration of extern public functions ---------------------------------------------------------------------------
 
+/** @fn         extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderived_new mtxnew)
+    @brief      creates the object. if mtxnew is NULL every protection based on a mutex becomes eo_nvset_protection_none,
+                whereas eo_nvset_protection_seqlock_per_entity does not use mtxnew at all.
+ **/
 extern EOnvSet* eo_nvset_New(eOnvset_protection_t prot, eov_mutex_fn_mutexderived_new mtxnew);
 
 
 extern void eo_nvset_Delete(EOnvSet* p);
 
 
+/** @fn         extern eOresult_t eo_nvset_NVSlazyinitialise(EOnvSet* p, eObool_t enable)
+    @brief      when enabled, eo_nvset_LoadEP() with initNVs true calls only the initialiser of the endpoint and leaves 
+                the init of the NVs to the first access of their entity through eo_nvset_NV_Get() or the eo_nvset_RAMof*()
+                functions. the NVs of an entity are initialised all together exactly once also if more threads access
+                them at the same time. the init functions of the NVs run inside the lazy init, so they must not access
+                the NVs of an EOnvSet with lazy init: the host reports it as a fatal error. it must be called before 
+                loading the endpoints.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if some endpoint is already loaded.
+ **/
+extern eOresult_t eo_nvset_NVSlazyinitialise(EOnvSet* p, eObool_t enable);
+
+
+/** @fn         extern eOresult_t eo_nvset_SharedMemoryExport(EOnvSet* p, const char *name)
+    @brief      when name is not NULL, eo_nvset_LoadEP() places the ram of the endpoint and the seqlocks of its entities
+                in a posix shared memory segment, named as eo_nvset_SharedMemoryName() tells, so that the other processes 
+                of the host can read the NVs with no copy through the owner. the segment starts with eOnvset_shm_header_t
+                and it is removed when the endpoint is unloaded. the writers mark the seqlocks only with the protection
+                eo_nvset_protection_seqlock_per_entity, thus the export needs it. with the lazy init, the entities which 
+                the owner has not accessed yet are all zero. it must be called before loading the endpoints. 
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_generic if some endpoint is already loaded or the name is too 
+                long, eores_NOK_unsupported if the protection is not eo_nvset_protection_seqlock_per_entity or the 
+                system is not linux.
+ **/
+extern eOresult_t eo_nvset_SharedMemoryExport(EOnvSet* p, const char *name);
+
+
+/** @fn         extern eOresult_t eo_nvset_SharedMemoryName(const char *name, eOnvEP8_t ep8, char *segment, uint16_t size)
+    @brief      it gives in segment the name of the shared memory segment of endpoint ep8 exported as name: /name-epN
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if size is not enough.
+ **/
+extern eOresult_t eo_nvset_SharedMemoryName(const char *name, eOnvEP8_t ep8, char *segment, uint16_t size);
+
+
 extern eOresult_t eo_nvset_InitBRD(EOnvSet* p, eOnvsetOwnership_t ownership, eOipv4addr_t ipaddress, eOnvBRD_t brdnum);
 
 
@@ -138,10 +208,22 @@ extern eOresult_t eo_nvset_BRD_Get(EOnvSet* p, eOnvBRD_t* brd);
 
 extern eOresult_t eo_nvset_NV_Get(EOnvSet* p, eOnvID32_t id32, EOnv* thenv);
 
+// it also initialises the NVs which are still waiting for a lazy init
+extern eOresult_t eo_nvset_NVSinitialise(EOnvSet* p);
+
 extern void* eo_nvset_RAMofEndpoint_Get(EOnvSet* p, eOnvEP8_t ep8);
 
 extern void* eo_nvset_RAMofEntity_Get(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index);
 
+/** @fn         extern eOresult_t eo_nvset_RAMofEntity_Snapshot(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size)
+    @brief      copies the whole ram of an entity so that no NV of the entity is changed during the copy. 
+    @param      data        it must have room for the entity
+    @param      size        it gets the bytes copied
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_generic if the entity does not exist or eores_NOK_unsupported 
+                if the protection is eo_nvset_protection_one_per_netvar, which cannot guarantee a consistent copy. 
+ **/
+extern eOresult_t eo_nvset_RAMofEntity_Snapshot(EOnvSet* p, eOnvEP8_t ep8, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size);
+
 extern void* eo_nvset_RAMofVariable_Get(EOnvSet* p, eOnvID32_t id32);
 
 
@@ -38,6 +38,7 @@ extern "C" {
 #include "EOvector.h"
 #include "EOconstvector.h"
 #include "EOVmutex.h"
+#include "EoSeqlock.h"
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
  
@@ -58,6 +59,11 @@ typedef struct
     void*                               epram;    
     EOVmutexDerived*                    mtx_endpoint;    
     EOvector*                           themtxofthenvs;    
+    eOseqlock_t*                        seqlocks;           // one per entity: those of entity e start at entityoffset[e]
+    volatile uint8_t*                   lazystates;         // one per entity if the init of its NVs is lazy, else NULL
+    eOnvset_shm_header_t*               shm;                // the segment which holds epram and seqlocks if exported, else NULL
+    uint32_t                            shmsize;
+    uint16_t                            entityoffset[eoprot_entities_maxnumberofsupported];
 } eOnvset_ep_t;
 
 
@@ -84,6 +90,8 @@ struct EOnvSet_hid
     eOnvset_brd_t                   theboard;
     eOnvset_protection_t            protection;
     eov_mutex_fn_mutexderived_new   mtxderived_new;
+    eObool_t                        lazyinit;
+    char                            sharedname[eonvset_shm_namesize];  // empty if the endpoints are not exported
 };   
  
 
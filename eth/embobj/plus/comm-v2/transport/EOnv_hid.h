@@ -36,6 +36,7 @@ extern "C" {
 #include "EoCommon.h"
 #include "EOrop.h"
 #include "EOVmutex.h"
+#include "EoSeqlock.h"
 
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
@@ -62,7 +63,7 @@ typedef struct EOnv_rom_T           // 16 bytes on arm
 
 
 
-struct EOnv_hid                    // 28 bytes ... 
+struct EOnv_hid                    // 32 bytes on arm ... 
 {
     eOipv4addr_t                    ip;         // ip address of the device owning the nv. if equal to eok_ipv4addr_localhost, then the nv is owned by the device.
     eOnvBRD_t                       brd;        // brd number. it is a short of the ip address.
@@ -73,7 +74,8 @@ struct EOnv_hid                    // 28 bytes ...
     EOnv_rom_t*                     rom;        // pointer to the constant part common to every device which uses this nv
     void*                           ram;        // the ram which keeps the LOCAL value of nv 
     EOVmutexDerived*                mtx;        // the mutex which protects concurrent access to the ram of this nv 
-};  //EO_VERIFYsizeof(EOnv, 28)   
+    eOseqlock_t*                    seqlock;    // if non NULL it is used instead of mtx to protect the copies to and from the ram
+};  //EO_VERIFYsizeof(EOnv, 32)   
 
 
 
@@ -87,7 +89,7 @@ struct EOnv_hid                    // 28 bytes ...
 //extern EOnv * eo_nv_hid_New(uint8_t fun, uint8_t typ, uint32_t otherthingsmaybe);
 
 
-extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx);
+extern eOresult_t eo_nv_hid_Load(EOnv *nv, eOipv4addr_t ip, eOnvBRD_t brd, eObool_t proxied, eOnvID32_t id32, eOvoid_fp_cnvp_cropdesp_t onsay, EOnv_rom_t* rom, void* ram, EOVmutexDerived* mtx, eOseqlock_t* seqlock);
 
 extern void eo_nv_hid_Fast_LocalMemoryGet(EOnv *nv, void* dest);
 
@@ -30,7 +30,6 @@
 #include "EOnv_hid.h"
 #include "EOrop_hid.h"
 #include "EOVtheSystem.h"
-#include "EOlist.h"
 
 
 
@@ -75,13 +74,6 @@
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
 
-typedef struct              // 24+24=48
-{
-    eOropdescriptor_t       ropdes; // ropdes.time contains the expiry time ...
-    EOnv                    nv;
-    eOproxy_params_t        params;
-} eo_proxy_ropdes_plus_t;   //EO_VERIFYsizeof(eo_proxy_ropdes_plus_t, 56) 
-
 typedef struct
 {
     uint32_t    id32;
@@ -101,6 +93,22 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout);
 
 static eOresult_t s_matching_rule_id32(void *item, void *param);
 
+static uint16_t s_eo_proxy_bucket(EOproxy *p, eOnvID32_t id32);
+
+static uint16_t s_eo_proxy_find(EOproxy *p, eo_proxy_search_key_t *skey);
+
+static void s_eo_proxy_insert(EOproxy *p, const eo_proxy_ropdes_plus_t *ropdesplus);
+
+static void s_eo_proxy_erase(EOproxy *p, uint16_t e);
+
+static eObool_t s_eo_proxy_heap_less(EOproxy *p, uint16_t a, uint16_t b);
+
+static void s_eo_proxy_heap_up(EOproxy *p, uint16_t pos);
+
+static void s_eo_proxy_heap_down(EOproxy *p, uint16_t pos);
+
+static void s_eo_proxy_heap_place(EOproxy *p, uint16_t pos, uint16_t e);
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition (and initialisation) of static variables
 // --------------------------------------------------------------------------------------------------------------------
@@ -144,11 +152,40 @@ extern EOproxy* eo_proxy_New(const eOproxy_cfg_t *cfg)
     
     memcpy(&retptr->config, cfg, sizeof(eOproxy_cfg_t));
     
-    // i get the list ...
+    // i get the entries, the index on id32 and the heap on expiry time ...
     
     retptr->transceiver = (EOtransceiver*) cfg->transceiver;
     
-    retptr->listofropdes    = (0 == cfg->capacityoflistofropdes) ? (NULL) : (eo_list_New(sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes, NULL, 0, NULL, NULL));
+    if(0 != cfg->capacityoflistofropdes)
+    {
+        uint16_t i = 0;
+        uint16_t numbuckets = 1;
+        // the number of buckets is a power of two not smaller than the capacity so that the chains are short
+        while((numbuckets < cfg->capacityoflistofropdes) && (numbuckets < 0x8000))
+        {
+            numbuckets <<= 1;
+        }
+        
+        retptr->entries = (eo_proxy_ropdes_plus_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eo_proxy_ropdes_plus_t), cfg->capacityoflistofropdes);
+        retptr->heap = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), cfg->capacityoflistofropdes);
+        retptr->buckets = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), numbuckets);
+        retptr->bucketmask = numbuckets - 1;
+        
+        for(i=0; i<numbuckets; i++)
+        {
+            retptr->buckets[i] = EOK_uint16dummy;
+        }
+        
+        for(i=0; i<cfg->capacityoflistofropdes; i++)
+        {
+            retptr->entries[i].next = ((i+1) == cfg->capacityoflistofropdes) ? (EOK_uint16dummy) : (i+1);
+        }
+        retptr->freeentry = 0;
+    }
+    else
+    {
+        retptr->freeentry = EOK_uint16dummy;
+    }
     
     if(NULL != cfg->mutex_fn_new)
     {
@@ -171,9 +208,11 @@ extern void eo_proxy_Delete(EOproxy *p)
         eov_mutex_Delete(p->mtx);
     }
     
-    if(NULL != p->listofropdes)
+    if(NULL != p->entries)
     {
-        eo_list_Delete(p->listofropdes);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->entries);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->heap);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->buckets);
     }
    
     memset(p, 0, sizeof(EOproxy));
@@ -204,7 +243,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eobool_false == eo_nv_IsProxied(nv))
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         return(eores_NOK_generic);
@@ -236,7 +275,7 @@ extern eOresult_t eo_proxy_ROP_Forward(EOproxy *p, EOrop* rop, EOrop* ropout)
     
     if(eores_OK != res)
     {
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         errdes.par64 = ((uint64_t)rop->ropdes.signature << 32) | (rop->ropdes.id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);       
     }
@@ -248,7 +287,7 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
 {
     eOproxy_params_t *par = NULL;
     
-    EOlistIter* li = NULL;
+    uint16_t e = EOK_uint16dummy;
     eo_proxy_search_key_t skey = {0};
     eo_proxy_ropdes_plus_t *item = NULL;
     
@@ -270,20 +309,21 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, (void*)&skey);
+    e = s_eo_proxy_find(p, &skey);
 
-    if(NULL == li)
+    if(EOK_uint16dummy == e)
     {   // there is no entry with id32 in the list ... i cannot give teh param back
+        p->stats.notfound++;
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         errdes.par64 = (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
         
         return(par);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);       
+    item = &p->entries[e];       
     eov_mutex_Release(p->mtx);   
 
     return(&item->params);   
@@ -293,7 +333,9 @@ extern eOproxy_params_t * eo_proxy_Params_Get(EOproxy *p, eOnvID32_t id32)
 extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data)
 {
     eOresult_t res = eores_NOK_generic;
-    EOlistIter* li = NULL;
+    uint16_t e = EOK_uint16dummy;
+    eOabstime_t delta = 0;
+    uint8_t bin = 0;
     eo_proxy_search_key_t skey = {0};
     eo_proxy_ropdes_plus_t *item = NULL;
     eOerrmanDescriptor_t errdes = {0};
@@ -314,13 +356,14 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    li = eo_list_Find(p->listofropdes, s_matching_rule_id32, (void*)&skey);
+    e = s_eo_proxy_find(p, &skey);
 
-    if(NULL == li)
+    if(EOK_uint16dummy == e)
     {   // there is no entry with id32 in the list ... i dont load any reply rop
+        p->stats.notfound++;
         eov_mutex_Release(p->mtx);
         
-        errdes.par16 = (eo_list_Capacity(p->listofropdes) << 8) | (eo_list_Size(p->listofropdes));
+        errdes.par16 = (p->config.capacityoflistofropdes << 8) | (p->size);
         //errdes.par64 = ((uint64_t)signature << 32) | (id32);
         errdes.par64 = (id32);
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
@@ -328,7 +371,7 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         return(eores_NOK_generic);
     }
     
-    item = (eo_proxy_ropdes_plus_t*) eo_list_At(p->listofropdes, li);
+    item = &p->entries[e];
     
     if(NULL != data)
     {
@@ -346,7 +389,17 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
         eo_errman_Error(eo_errman_GetHandle(), eo_errortype_error, NULL, NULL, &errdes);
     }
     
-    eo_list_Erase(p->listofropdes, li);
+    // the histogram counts in which power of two of msec the reply has arrived
+    delta = (eov_sys_LifeTimeGet(eov_sys_GetHandle()) - item->forwardtime) / 1000;
+    while((delta > 0) && (bin < (eoproxy_replyhistogram_bins-1)))
+    {
+        delta >>= 1;
+        bin++;
+    }
+    p->stats.replyhistogram[bin]++;
+    p->stats.replied++;
+    
+    s_eo_proxy_erase(p, e);
     
     eov_mutex_Release(p->mtx);
     
@@ -356,7 +409,6 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
     
 extern eOresult_t eo_proxy_Tick(EOproxy *p)
 {   
-    eo_proxy_ropdes_plus_t* item = NULL;
     eOabstime_t timenow = 0;
 
     if(NULL == p)
@@ -368,12 +420,11 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
     
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    // i assume that the items are in expiry order, thus i get the front and i keep on removing until timenow is higher than item->ropdes.time          
-    item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);   
-    while((NULL != item) && (timenow > item->ropdes.time))
+    // the top of the heap is the entry which expires first, thus i keep on removing it until timenow is higher than its ropdes.time          
+    while((0 != p->size) && (timenow > p->entries[p->heap[0]].ropdes.time))
     {
-        eo_list_PopFront(p->listofropdes);
-        item = (eo_proxy_ropdes_plus_t*) eo_list_Front(p->listofropdes);
+        s_eo_proxy_erase(p, p->heap[0]);
+        p->stats.expired++;
     }
     
     eov_mutex_Release(p->mtx);
@@ -382,6 +433,22 @@ extern eOresult_t eo_proxy_Tick(EOproxy *p)
 }    
 
 
+extern eOresult_t eo_proxy_GetStats(EOproxy *p, eOproxy_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
+    p->stats.pending = p->size;
+    memcpy(stats, &p->stats, sizeof(eOproxy_stats_t));
+    eov_mutex_Release(p->mtx);
+    
+    return(eores_OK);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -443,12 +510,13 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
      
     eov_mutex_Take(p->mtx, eok_reltimeINFINITE);
     
-    if(eobool_true != eo_list_Full(p->listofropdes))
+    if(EOK_uint16dummy != p->freeentry)
     {   // we can process the ask        
         res = eores_OK;       
     }
     else
     {
+        p->stats.rejected++;
         res = eores_NOK_generic;    
     }
     
@@ -502,9 +570,10 @@ static eOresult_t s_eo_proxy_forward_ask(EOproxy *p, EOrop *rop, EOrop *ropout)
     // clear the param
     memset(&ropdesplus.params, 0, sizeof(ropdesplus.params));
        
-    // now we insert the item in the list according to expiry time. 
-    // since the timeouts  are all equal, i just append the item at the end of the list
-    eo_list_PushBack(p->listofropdes, &ropdesplus);
+    ropdesplus.forwardtime = timenow;
+    
+    // now we insert the item in the index on id32 and in the heap ordered by expiry time. 
+    s_eo_proxy_insert(p, &ropdesplus);
      
     eov_mutex_Release(p->mtx); 
 
@@ -532,6 +601,157 @@ static eOresult_t s_matching_rule_id32(void *item, void *param)
 }
 
 
+static uint16_t s_eo_proxy_bucket(EOproxy *p, eOnvID32_t id32)
+{
+    uint32_t h = id32 * 2654435761U;
+    return((uint16_t)((h ^ (h >> 16)) & p->bucketmask));
+}
+
+
+static uint16_t s_eo_proxy_find(EOproxy *p, eo_proxy_search_key_t *skey)
+{
+    // the chain has the most recent entry first, but i must return the oldest matching one as the list did
+    uint16_t found = EOK_uint16dummy;
+    uint16_t e = EOK_uint16dummy;
+    
+    if(0 == p->size)
+    {
+        return(EOK_uint16dummy);
+    }
+    
+    for(e = p->buckets[s_eo_proxy_bucket(p, skey->id32)]; EOK_uint16dummy != e; e = p->entries[e].next)
+    {
+        if(eores_OK == s_matching_rule_id32(&p->entries[e], skey))
+        {
+            if((EOK_uint16dummy == found) || ((int32_t)(p->entries[e].sequence - p->entries[found].sequence) < 0))
+            {
+                found = e;
+            }
+        }
+    }
+    
+    return(found);
+}
+
+
+static void s_eo_proxy_insert(EOproxy *p, const eo_proxy_ropdes_plus_t *ropdesplus)
+{
+    uint16_t e = p->freeentry;
+    uint16_t b = s_eo_proxy_bucket(p, ropdesplus->ropdes.id32);
+    eo_proxy_ropdes_plus_t *entry = &p->entries[e];
+    
+    p->freeentry = entry->next;
+    
+    memcpy(entry, ropdesplus, sizeof(eo_proxy_ropdes_plus_t));
+    entry->sequence = p->sequence++;
+    entry->next = p->buckets[b];
+    p->buckets[b] = e;
+    
+    s_eo_proxy_heap_place(p, p->size, e);
+    p->size++;
+    s_eo_proxy_heap_up(p, entry->heapposition);
+    
+    p->stats.forwarded++;
+    if(p->size > p->stats.maxpending)
+    {
+        p->stats.maxpending = p->size;
+    }
+}
+
+
+static void s_eo_proxy_erase(EOproxy *p, uint16_t e)
+{
+    uint16_t *link = &p->buckets[s_eo_proxy_bucket(p, p->entries[e].ropdes.id32)];
+    uint16_t pos = p->entries[e].heapposition;
+    uint16_t moved = EOK_uint16dummy;
+    
+    // remove it from its chain
+    while(e != *link)
+    {
+        link = &p->entries[*link].next;
+    }
+    *link = p->entries[e].next;
+    
+    // remove it from the heap: the last one takes its place and goes up or down
+    p->size--;
+    if(pos != p->size)
+    {
+        moved = p->heap[p->size];
+        s_eo_proxy_heap_place(p, pos, moved);
+        s_eo_proxy_heap_up(p, pos);
+        s_eo_proxy_heap_down(p, p->entries[moved].heapposition);
+    }
+    
+    // and put it in the free list
+    p->entries[e].next = p->freeentry;
+    p->freeentry = e;
+}
+
+
+static eObool_t s_eo_proxy_heap_less(EOproxy *p, uint16_t a, uint16_t b)
+{
+    eo_proxy_ropdes_plus_t *ea = &p->entries[a];
+    eo_proxy_ropdes_plus_t *eb = &p->entries[b];
+    
+    if(ea->ropdes.time != eb->ropdes.time)
+    {
+        return((ea->ropdes.time < eb->ropdes.time) ? (eobool_true) : (eobool_false));
+    }
+    
+    return(((int32_t)(ea->sequence - eb->sequence) < 0) ? (eobool_true) : (eobool_false));
+}
+
+
+static void s_eo_proxy_heap_place(EOproxy *p, uint16_t pos, uint16_t e)
+{
+    p->heap[pos] = e;
+    p->entries[e].heapposition = pos;
+}
+
+
+static void s_eo_proxy_heap_up(EOproxy *p, uint16_t pos)
+{
+    uint16_t e = p->heap[pos];
+    uint16_t parent = 0;
+    
+    while(pos > 0)
+    {
+        parent = (pos - 1) / 2;
+        if(eobool_false == s_eo_proxy_heap_less(p, e, p->heap[parent]))
+        {
+            break;
+        }
+        s_eo_proxy_heap_place(p, pos, p->heap[parent]);
+        pos = parent;
+    }
+    
+    s_eo_proxy_heap_place(p, pos, e);
+}
+
+
+static void s_eo_proxy_heap_down(EOproxy *p, uint16_t pos)
+{
+    uint16_t e = p->heap[pos];
+    uint16_t child = 0;
+    
+    while((child = 2*pos + 1) < p->size)
+    {
+        if(((child + 1) < p->size) && (eobool_true == s_eo_proxy_heap_less(p, p->heap[child+1], p->heap[child])))
+        {
+            child++;
+        }
+        if(eobool_false == s_eo_proxy_heap_less(p, p->heap[child], e))
+        {
+            break;
+        }
+        s_eo_proxy_heap_place(p, pos, p->heap[child]);
+        pos = child;
+    }
+    
+    s_eo_proxy_heap_place(p, pos, e);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - end-of-file (leave a blank line after)
 // --------------------------------------------------------------------------------------------------------------------
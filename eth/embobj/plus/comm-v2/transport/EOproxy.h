@@ -47,7 +47,8 @@ extern "C" {
 
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+
+#define eoproxy_replyhistogram_bins     8
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -83,6 +84,19 @@ typedef struct
     uint16_t    p16_3;
     uint32_t    p32_4;
 } eOproxy_params_t; //EO_VERIFYsizeof(eOproxy_params_t, 8) 
+
+
+typedef struct
+{
+    uint16_t    pending;                // number of ask<> waiting for their reply
+    uint16_t    maxpending;             // the maximum value reached by pending
+    uint32_t    forwarded;              // number of ask<> stored waiting for their reply
+    uint32_t    rejected;               // number of ask<> not stored because there was no room
+    uint32_t    replied;                // number of replies loaded in the transceiver
+    uint32_t    expired;                // number of ask<> removed by eo_proxy_Tick() because their timeout has elapsed
+    uint32_t    notfound;               // number of calls of eo_proxy_ReplyROP_Load() or eo_proxy_Params_Get() without a pending ask<>
+    uint32_t    replyhistogram[eoproxy_replyhistogram_bins];    // time from forward to reply: bin 0 is < 1 ms, bin k is [2^(k-1), 2^k) ms, the last bin is all the rest
+} eOproxy_stats_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -161,6 +175,15 @@ extern eOresult_t eo_proxy_ReplyROP_Load(EOproxy *p, eOnvID32_t id32, void *data
 extern eOresult_t eo_proxy_Tick(EOproxy *p);
 
 
+/** @fn         extern eOresult_t eo_proxy_GetStats(EOproxy *p, eOproxy_stats_t *stats)
+    @brief      it retrieves the number of pending ask<> and the statistics about their replies and timeouts.
+    @param      p           the object.
+    @param      stats       the statistics.
+    @return     eores_NOK_nullpointer if any argument is NULL or eores_OK on success.    
+ **/
+extern eOresult_t eo_proxy_GetStats(EOproxy *p, eOproxy_stats_t *stats);
+
+
 
 
 
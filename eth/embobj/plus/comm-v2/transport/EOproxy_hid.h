@@ -34,9 +34,9 @@ extern "C" {
 // - external dependencies --------------------------------------------------------------------------------------------
 
 #include "EoCommon.h"
-#include "EOlist.h"
 #include "EOVmutex.h"
 #include "EOtransceiver.h"
+#include "EOnv_hid.h"
 
 
 // - declaration of extern public interface ---------------------------------------------------------------------------
@@ -51,6 +51,18 @@ extern "C" {
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
 
+typedef struct
+{
+    eOropdescriptor_t       ropdes;         // ropdes.time contains the expiry time ...
+    EOnv                    nv;
+    eOproxy_params_t        params;
+    eOabstime_t             forwardtime;
+    uint32_t                sequence;       // order of insertion: it breaks ties of expiry time and finds the oldest ask<> of an id32
+    uint16_t                next;           // next entry in the same bucket of the index or in the free list
+    uint16_t                heapposition;   // position inside the expiry heap
+} eo_proxy_ropdes_plus_t;
+
+
 /** @struct     EOproxy_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -59,10 +71,17 @@ extern "C" {
  
 struct EOproxy_hid 
 {
-    eOproxy_cfg_t       config;
-    EOtransceiver*      transceiver;
-    EOlist*             listofropdes;
-    EOVmutexDerived*    mtx;           
+    eOproxy_cfg_t               config;
+    EOtransceiver*              transceiver;
+    eo_proxy_ropdes_plus_t*     entries;        // capacityoflistofropdes entries
+    uint16_t*                   buckets;        // index on id32: first entry of every bucket or EOK_uint16dummy
+    uint16_t                    bucketmask;
+    uint16_t*                   heap;           // entries in pending ask<> ordered by expiry time
+    uint16_t                    size;
+    uint16_t                    freeentry;      // head of the free list
+    uint32_t                    sequence;
+    eOproxy_stats_t             stats;
+    EOVmutexDerived*            mtx;           
 }; 
 
 
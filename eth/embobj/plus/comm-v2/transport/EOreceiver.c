@@ -26,6 +26,7 @@
 #include "EOtheMemoryPool.h"
 #include "EOtheParser.h"
 #include "EOtheFormer.h"
+#include "EOrop_hid.h"
 
 
 
@@ -91,7 +92,8 @@ const eOreceiver_cfg_t eo_receiver_cfg_default =
     {
         EO_INIT(.onerrorseqnumber)          NULL,
         EO_INIT(.onerrorinvalidframe)       NULL
-    } 
+    },
+    EO_INIT(.zerocopy)                      eobool_false
 };
 
 
@@ -117,6 +119,8 @@ extern EOreceiver* eo_receiver_New(const eOreceiver_cfg_t *cfg)
     retptr->ropframereply       = eo_ropframe_New();
     retptr->ropinput            = eo_rop_New(cfg->sizes.capacityofropinput);
     retptr->ropreply            = eo_rop_New(cfg->sizes.capacityofropreply);
+    // with zerocopy the data of ropinput points inside ropframeinput, whose payload is alive until eo_receiver_Process() returns
+    eo_rop_hid_Borrowing_Set(retptr->ropinput, cfg->zerocopy);
     retptr->agent               = cfg->agent;
     retptr->ipv4addr            = 0;
     retptr->ipv4port            = 0;
@@ -102,13 +102,14 @@ typedef struct
     eOreceiver_sizes_t      sizes;
     EOagent*                agent;
     eOreceiver_extfn_t      extfn;
+    eObool_t                zerocopy;   // if eobool_true the data of the received rops is not copied into ropinput but used in place. eobool_false by default
 } eOreceiver_cfg_t;
 
 
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
-extern const eOreceiver_cfg_t eo_receiver_cfg_default; //= {{256, 128, 128}, NULL, {NULL}};
+extern const eOreceiver_cfg_t eo_receiver_cfg_default; //= {{256, 128, 128}, NULL, {NULL}, eobool_true};
 
 
 // - declaration of extern public functions ---------------------------------------------------------------------------
@@ -27,6 +27,7 @@
 #include "EOnv_hid.h"
 #include "EOtheErrorManager.h"
 #include "EOnv_hid.h" 
+#include "EOarray.h"
 
 
 
@@ -126,7 +127,7 @@ extern EOrop* eo_rop_New(uint16_t capacity)
 
     if(0 != capacity)
     {
-        retptr->stream.data = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), capacity);
+        retptr->stream.buffer = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_08bit, sizeof(uint8_t), capacity);
     }
 
     eo_rop_Reset(retptr);
@@ -144,7 +145,7 @@ extern void eo_rop_Delete(EOrop *p)
 
     if(0 != p->stream.capacity)
     {
-        eo_mempool_Delete(eo_mempool_GetHandle(), p->stream.data);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->stream.buffer);
     }
 
     memset(p, 0, sizeof(EOrop));    
@@ -163,7 +164,11 @@ extern eOresult_t eo_rop_Reset(EOrop *p)
     // - stream ---------------------------------------------------------------------
 		
     *((uint64_t*)(&(p->stream.head))) = 0;
-    memset(p->stream.data, 0, p->stream.capacity);
+    p->stream.data          = p->stream.buffer;
+    if(0 == p->stream.borrowing)
+    {   // a borrowing rop uses its buffer only as scratch, so there is no need to clean it every time
+        memset(p->stream.data, 0, p->stream.capacity);
+    }
     p->stream.sign          = EOK_uint32dummy;
     p->stream.time          = EOK_uint64dummy;		
 		
@@ -340,7 +345,7 @@ extern eObool_t eo_rop_datafield_is_required(const eOrophead_t *head)
     eObool_t ret = eobool_false;
 
     if((eo_ropconf_none == head->ctrl.confinfo) && 
-       ((eo_ropcode_set == head->ropc) || (eo_ropcode_say == head->ropc) || (eo_ropcode_sig == head->ropc))
+       ((eo_ropcode_set == head->ropc) || (eo_ropcode_say == head->ropc) || (eo_ropcode_sig == head->ropc) || (eo_ropcode_sigz == head->ropc))
       )
     {
         ret = eobool_true;
@@ -356,7 +361,7 @@ extern eObool_t eo_rop_ropcode_has_data(eOropcode_t ropc)
 {
     eObool_t ret = eobool_false;
 
-    if((eo_ropcode_set == ropc) || (eo_ropcode_say == ropc) || (eo_ropcode_sig == ropc))
+    if((eo_ropcode_set == ropc) || (eo_ropcode_say == ropc) || (eo_ropcode_sig == ropc) || (eo_ropcode_sigz == ropc))
     {
         ret = eobool_true;
     }
@@ -404,7 +409,7 @@ extern eOnvOwnership_t eo_rop_get_ownership(eOropcode_t ropc, eOropconfinfo_t co
     {
         ownership = eo_nv_ownership_local;
     }
-    else // say, sig, 
+    else // say, sig, sigz
     {
         ownership = eo_nv_ownership_remote;
     }
@@ -424,6 +429,181 @@ extern eOnvOwnership_t eo_rop_get_ownership(eOropcode_t ropc, eOropconfinfo_t co
     return(ownership);
 }
 
+
+// the xordelta is a sequence of tokens over the xor of value and base: a byte 0x80|(n-1) is a run of n zeros, a byte
+// (n-1) is followed by n literal bytes. n is at most 128. the zeros at the end are not written.
+extern uint16_t eo_rop_zip_Encode(eOropzip_t encoding, uint8_t version, const uint8_t *value, const uint8_t *base, uint16_t size, uint16_t arrayoffset, uint8_t *zip, uint16_t capacity)
+{
+    eOropzip_head_t head = {0};
+    uint16_t used = 0;
+    uint16_t i = 0;
+    uint16_t n = 0;
+    uint16_t k = 0;
+    
+    if((NULL == value) || (NULL == zip) || (capacity < sizeof(eOropzip_head_t)))
+    {
+        return(0);
+    }
+    
+    head.encoding = encoding;
+    head.version = version;
+    head.size = size;
+    memcpy(zip, &head, sizeof(eOropzip_head_t));
+    zip += sizeof(eOropzip_head_t);
+    capacity -= sizeof(eOropzip_head_t);
+    
+    switch(encoding)
+    {
+        case eo_ropzip_full:
+        case eo_ropzip_array:
+        {
+            used = size;
+            if(eo_ropzip_array == encoding)
+            {
+                eOarray_head_t arrayhead;
+                if((uint32_t)arrayoffset + sizeof(eOarray_head_t) > size)
+                {
+                    return(0);
+                }
+                memcpy(&arrayhead, value + arrayoffset, sizeof(eOarray_head_t));
+                used = EO_MIN(size, arrayoffset + sizeof(eOarray_head_t) + (uint32_t)arrayhead.size * arrayhead.itemsize);
+            }
+            if(used > capacity)
+            {
+                return(0);
+            }
+            memcpy(zip, value, used);
+        } break;
+        
+        case eo_ropzip_xordelta:
+        {
+            uint16_t last = size;
+            
+            if(NULL == base)
+            {
+                return(0);
+            }
+            
+            while((last > 0) && (value[last-1] == base[last-1]))
+            {
+                last--;
+            }
+            
+            while(i < last)
+            {
+                n = 0;
+                if(value[i] == base[i])
+                {   // a run of zeros
+                    while(((i+n) < last) && (n < 128) && (value[i+n] == base[i+n]))
+                    {
+                        n++;
+                    }
+                    if((used + 1) > capacity)
+                    {
+                        return(0);
+                    }
+                    zip[used++] = 0x80 | (n-1);
+                }
+                else
+                {   // literals up to two zeros. a zero is never the last byte before last
+                    while(((i+n) < last) && (n < 128) && !((value[i+n] == base[i+n]) && (value[i+n+1] == base[i+n+1])))
+                    {
+                        n++;
+                    }
+                    if((used + 1 + n) > capacity)
+                    {
+                        return(0);
+                    }
+                    zip[used++] = n-1;
+                    for(k=0; k<n; k++)
+                    {
+                        zip[used++] = value[i+k] ^ base[i+k];
+                    }
+                }
+                i += n;
+            }
+        } break;
+        
+        default:
+        {
+            return(0);
+        } break;
+    }
+    
+    return(sizeof(eOropzip_head_t) + used);
+}
+
+
+extern eOresult_t eo_rop_zip_Decode(const uint8_t *zip, uint16_t zipsize, uint8_t *value, uint16_t size)
+{
+    eOropzip_head_t head = {0};
+    uint16_t i = 0;
+    uint16_t j = 0;
+    uint16_t n = 0;
+    
+    if((NULL == zip) || (NULL == value) || (zipsize < sizeof(eOropzip_head_t)))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(&head, zip, sizeof(eOropzip_head_t));
+    zip += sizeof(eOropzip_head_t);
+    zipsize -= sizeof(eOropzip_head_t);
+    
+    if(head.size != size)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    switch(head.encoding)
+    {
+        case eo_ropzip_full:
+        case eo_ropzip_array:
+        {
+            if((zipsize > size) || ((eo_ropzip_full == head.encoding) && (zipsize != size)))
+            {
+                return(eores_NOK_generic);
+            }
+            memcpy(value, zip, zipsize);
+            memset(value + zipsize, 0, size - zipsize);
+        } break;
+        
+        case eo_ropzip_xordelta:
+        {   // we first verify the tokens so that a bad rop does not change value
+            for(i=0, j=0; i<zipsize; )
+            {
+                n = (zip[i] & 0x7f) + 1;
+                i += (0x80 & zip[i]) ? (1) : (1 + n);
+                j += n;
+            }
+            if((i != zipsize) || (j > size))
+            {
+                return(eores_NOK_generic);
+            }
+            for(i=0, j=0; i<zipsize; )
+            {
+                n = (zip[i] & 0x7f) + 1;
+                if(0x80 & zip[i++])
+                {
+                    j += n;
+                    continue;
+                }
+                while(n-- > 0)
+                {
+                    value[j++] ^= zip[i++];
+                }
+            }
+        } break;
+        
+        default:
+        {
+            return(eores_NOK_generic);
+        } break;
+    }
+    
+    return(eores_OK);
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -443,6 +623,18 @@ extern void	eo_rop_hid_fill_ropdes(eOropdescriptor_t* ropdes, eOropstream_t* str
 }
 
 
+extern void eo_rop_hid_Borrowing_Set(EOrop *p, eObool_t on)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+    
+    p->stream.borrowing = (eobool_true == on) ? (1) : (0);
+    eo_rop_Reset(p);
+}
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of static functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -77,10 +77,35 @@ typedef enum
     eo_ropcode_say          = 2,
     eo_ropcode_set          = 3,
     eo_ropcode_sig          = 4,
-    eo_ropcode_rst          = 5
+    eo_ropcode_rst          = 5,
+    eo_ropcode_sigz         = 6     /**< a sig<> whose data field is compressed as in eOropzip_head_t. the receiving agent expands it into a sig<> */
 } eOropcodevalues_t;
 
-enum { eo_ropcodevalues_numberof = 6 };
+enum { eo_ropcodevalues_numberof = 7 };
+
+
+/** @typedef    typedef enum eOropzip_t
+    @brief      eOropzip_t contains the encodings of the data field of a sig<> of ropcode eo_ropcode_sigz.
+ **/
+typedef enum
+{
+    eo_ropzip_full          = 0,    /**< the whole value */
+    eo_ropzip_array         = 1,    /**< the value up to the last used item of the EOarray at arrayoffset. the rest is zero */
+    eo_ropzip_xordelta      = 2     /**< the xor with the previous value: literal bytes and runs of zeros. the rest is unchanged */
+} eOropzip_t;
+
+
+/** @typedef    typedef struct eOropzip_head_t
+    @brief      it is the beginning of the data field of a sig<> of ropcode eo_ropcode_sigz. if version is not zero the 
+                receiver keeps the version of the variable: it accepts a eo_ropzip_xordelta only if it has the previous
+                version, so that a lost packet stops the deltas until the next eo_ropzip_full or eo_ropzip_array.
+ **/
+typedef struct
+{
+    uint8_t         encoding;       /**< use eOropzip_t */
+    uint8_t         version;        /**< 0 if the variable is not versioned, else 1, 2, ..., 255, 1, ... */
+    uint16_t        size;           /**< the size of the value once expanded */
+} eOropzip_head_t;  EO_VERIFYsizeof(eOropzip_head_t, 4)
 
 
 /** @typedef    typedef struct eOropctrl_t
@@ -244,6 +269,23 @@ extern eObool_t eo_rop_ropcode_has_data(eOropcode_t ropc);
 extern eOnvOwnership_t eo_rop_get_ownership(eOropcode_t ropc, eOropconfinfo_t confinfo, eOropDirection direction);
 
 
+/** @fn         extern uint16_t eo_rop_zip_Encode(eOropzip_t encoding, uint8_t version, const uint8_t *value, const uint8_t *base, uint16_t size, uint16_t arrayoffset, uint8_t *zip, uint16_t capacity)
+    @brief      writes into zip the data field of a sig<> of ropcode eo_ropcode_sigz: a eOropzip_head_t and the encoded value.
+    @param      base        the value that the receiver already has. used only by eo_ropzip_xordelta
+    @param      arrayoffset the position of the eOarray_head_t inside the value. used only by eo_ropzip_array
+    @return     the bytes written or 0 if they would be more than capacity or if the arguments are not valid.
+ **/
+extern uint16_t eo_rop_zip_Encode(eOropzip_t encoding, uint8_t version, const uint8_t *value, const uint8_t *base, uint16_t size, uint16_t arrayoffset, uint8_t *zip, uint16_t capacity);
+
+
+/** @fn         extern eOresult_t eo_rop_zip_Decode(const uint8_t *zip, uint16_t zipsize, uint8_t *value, uint16_t size)
+    @brief      expands the data field of a sig<> of ropcode eo_ropcode_sigz into value, which must contain the 
+                previous value if the encoding is eo_ropzip_xordelta.
+    @return     eores_OK or eores_NOK_generic if zip is not well formed or not of size bytes.
+ **/
+extern eOresult_t eo_rop_zip_Decode(const uint8_t *zip, uint16_t zipsize, uint8_t *value, uint16_t size);
+
+
 /** @}            
     end of group eo_rop  
  **/
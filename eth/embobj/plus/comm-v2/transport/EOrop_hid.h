@@ -58,11 +58,13 @@ extern "C" {
 typedef struct
 {
     eOrophead_t         head; 
-    uint8_t*            data;       
+    uint8_t*            data;       // it is buffer or, if the rop borrows its data field, a pointer inside the parsed stream
     uint32_t            sign;
     uint64_t            time;    
     uint16_t		    capacity;
-    uint16_t	        dummy;			
+    uint8_t             borrowing;  // if 1 the parser does not copy the data field but makes data point to it
+    uint8_t	            dummy;			
+    uint8_t*            buffer;     // the memory owned by the rop: it has capacity bytes
 } eOropstream_t;
 
 
@@ -84,6 +86,10 @@ struct EOrop_hid
 
 extern void	eo_rop_hid_fill_ropdes(eOropdescriptor_t* ropdes, eOropstream_t* stream, uint16_t size, uint8_t* data);
 
+// if on is eobool_true the parser does not copy anymore the data field of a rop into the buffer of p, but it makes 
+// p point to the data field inside the stream. the stream must stay valid as long as p is used. 
+extern void eo_rop_hid_Borrowing_Set(EOrop *p, eObool_t on);
+
 
 
 #ifdef __cplusplus
@@ -227,8 +227,8 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
         return(eores_NOK_generic);
     }
     
-    // verify if we can accomodate the parsed rop in our buffer
-    if(rop->stream.capacity < parsedropsize)
+    // verify if we can accomodate the parsed rop in our buffer. a borrowing rop does not use it
+    if((0 == rop->stream.borrowing) && (rop->stream.capacity < parsedropsize))
     {   // cannot handle the parsed rop in the EOrop object
         *result = eo_parser_res_nok_ropistoobig;
         *consumedbytes = parsedropsize;       
@@ -242,11 +242,18 @@ extern eOresult_t eo_parser_GetROP(EOtheParser *p, const uint8_t *streamdata, co
     // copy head
     memcpy(&rop->stream.head, rophead, sizeof(eOrophead_t));
 
-    // copy data
+    // copy data, or just point to it
     if(NULL != ropdata)
     {
         rop->stream.head.dsiz = rophead->dsiz;
-        memcpy(rop->stream.data, ropdata, dataeffectivesize);
+        if(1 == rop->stream.borrowing)
+        {
+            rop->stream.data = ropdata;
+        }
+        else
+        {
+            memcpy(rop->stream.data, ropdata, dataeffectivesize);
+        }
     }
 		
     
@@ -99,7 +99,8 @@ extern EOtheParser * eo_parser_GetHandle(void);
                 call of the function will be passed the packet data with an offset. 
     @param      pktdata         The input data
     @param      pktsize         The size of the input data
-    @param      rop             The extracted rop.
+    @param      rop             The extracted rop. if rop is borrowing (see eo_rop_hid_Borrowing_Set()) its data field is not 
+                                copied but points inside pktdata, which must then stay valid as long as the rop is used.
     @param      consumedbytes   The number of bytes used by the retrieved rop.
     @return     The value eores_NOK_nullpointer if any is a NULL pointer, eores_NOK_generic if pktdata does not have a valid rop, 
                 eores_OK if the function can fill @e rop with meaninful data.
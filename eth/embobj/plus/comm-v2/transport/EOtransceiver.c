@@ -173,6 +173,7 @@ extern EOtransceiver* eo_transceiver_New(const eOtransceiver_cfg_t *cfg)
     agentcfg.nvset      = cfg->nvset;
     agentcfg.proxy      = retptr->proxy;
     agentcfg.confman    = retptr->confmanager;
+    agentcfg.capacityofrop = cfg->sizes.capacityofrop;
     
     retptr->agent = eo_agent_New(&agentcfg);               
  
@@ -95,18 +95,48 @@ static void s_eo_transmitter_list_shiftdownropinfo(void *item, void *param);
 
 static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t* ropdesc, EOropframe* intoropframe, EOVmutexDerived *mtx);
 
-static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype);
+static eo_transm_regropframe_t s_eo_transmitter_regulars_place(EOtransmitter* p, eOprotID32_t id32, uint8_t *period, uint8_t *phase);
 
-static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, uint16_t *ropsinside);
+static uint8_t s_eo_transmitter_regulars_cycle(EOtransmitter* p, uint8_t *skipped);
 
 
 static uint16_t s_eo_transmitter_get_maxsizeof_regularsropframe(EOtransmitter *p);
 
-static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint16_t ropbytes);
+static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, uint8_t period, uint8_t phase, uint16_t ropbytes);
 
 static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p);
 
-static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes);
+static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, const eo_transm_regrop_info_t *info, int16_t ropbytes);
+
+static uint16_t s_eo_transmitter_regulars_bytes(const eo_transm_regrop_info_t *info);
+
+static const eOtransmitter_regzip_rule_t * s_eo_transmitter_regulars_ziprule(EOtransmitter *p, eOropcode_t ropc, eOprotID32_t id32);
+
+static void s_eo_transmitter_list_zipbase_free(void *item, void *param);
+
+static uint16_t s_eo_transmitter_zip_rop(const eo_transm_regrop_info_t *info, uint8_t *out, uint16_t capacity);
+
+static void s_eo_transmitter_zip_commit(eo_transm_regrop_info_t *info, const uint8_t *rop);
+
+static eOresult_t s_eo_transmitter_confman_retransmit(void *arg, eOropdescriptor_t *ropdes);
+
+static void s_eo_transmitter_confman_transmitted(EOtransmitter *p, eo_transm_scheditem_t *item);
+
+static void s_eo_transmitter_queued(EOtransmitter *p, EOropframe *ropframe, eOresult_t res);
+
+static uint16_t s_eo_transmitter_schedule(EOtransmitter *p, const eObool_t *due, eOabstime_t now, uint16_t *sentrops);
+
+static uint16_t s_eo_transmitter_schedule_collect(EOtransmitter *p, uint16_t n, EOropframe *ropframe, eOtransmitter_class_t cls, uint32_t classkey, eObool_t late);
+
+static uint16_t s_eo_transmitter_schedule_inorder(EOtransmitter *p, const eObool_t *due, eObool_t *blocked, uint16_t *sentrops, uint16_t *remainingbytes);
+
+static uint16_t s_eo_transmitter_schedule_ropitem(EOropframe *ropframe, uint16_t offset, eOtransmitter_class_t cls, eo_transm_scheditem_t *item, eOprotID32_t *id32);
+
+static void s_eo_transmitter_schedule_cycleditem(EOtransmitter *p, eo_transm_regrop_info_t *info, eo_transm_scheditem_t *item, uint16_t *zipscratchused);
+
+static void s_eo_transmitter_schedule_place(EOtransmitter *p, eo_transm_scheditem_t *item, eObool_t *blocked, uint16_t *sentrops, uint16_t *remainingbytes);
+
+static void s_eo_transmitter_schedule_enable(EOtransmitter *p);
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -134,6 +164,25 @@ const eOtransmitter_cfg_t eo_transmitter_cfg_default =
 };
 
 
+static const eOtransmitter_regcycle_rule_t s_eo_transmitter_regcycle_rules_default[] = 
+{   // the split used before the rules: the joints and motors with index 0-5 in the even cycles, the others in the odd ones
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, eoprot_entity_mc_controller, 0, 0), EO_INIT(.mask) eo_transmitter_regcycle_mask_entity, EO_INIT(.period) 1, EO_INIT(.phase) 0, EO_INIT(.filler) {0} },
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, 0),      EO_INIT(.mask) 0xfffffc00,                          EO_INIT(.period) 2, EO_INIT(.phase) 0, EO_INIT(.filler) {0} },
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 4, 0),      EO_INIT(.mask) 0xfffffe00,                          EO_INIT(.period) 2, EO_INIT(.phase) 0, EO_INIT(.filler) {0} },
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, 0, 0),      EO_INIT(.mask) 0xfffffc00,                          EO_INIT(.period) 2, EO_INIT(.phase) 0, EO_INIT(.filler) {0} },
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, eoprot_entity_mc_motor, 4, 0),      EO_INIT(.mask) 0xfffffe00,                          EO_INIT(.period) 2, EO_INIT(.phase) 0, EO_INIT(.filler) {0} },
+    { EO_INIT(.id32) EOPROT_ID_GET(eoprot_endpoint_motioncontrol, 0, 0, 0),                           EO_INIT(.mask) eo_transmitter_regcycle_mask_endpoint, EO_INIT(.period) 2, EO_INIT(.phase) 1, EO_INIT(.filler) {0} }
+};
+
+
+static const eOtransmitter_classcfg_t s_eo_transmitter_classcfg_default[eo_transmitter_classes_numberof] = 
+{   // the order used before the introduction of the scheduling: regulars, occasionals, replies
+    { EO_INIT(.priority) 0, EO_INIT(.filler) {0}, EO_INIT(.deadline) 0 },
+    { EO_INIT(.priority) 1, EO_INIT(.filler) {0}, EO_INIT(.deadline) 0 },
+    { EO_INIT(.priority) 2, EO_INIT(.filler) {0}, EO_INIT(.deadline) 0 }
+};
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern public functions
 // --------------------------------------------------------------------------------------------------------------------
@@ -154,12 +203,20 @@ const eOtransmitter_cfg_t eo_transmitter_cfg_default =
 // moreover, i may have the rops distributed not evenly in these three containers. how do i partition them? best case is to give p->effectivecapacityofregulars to teh three of them.
 // in this way i can allocate all the space in the udp packet in only one container. for instance, i can create a larger skin status....
 // on the other hand we may waste memory. a good compromise is using 75% for all. see TAG(*1234*)
+//
+// marco.accame on 19oct26: the two cycled containers are now a single _cycled one and every cycled rop has a period 
+// and a phase given by the rules of eo_transmitter_regular_rops_Cycling_Set(). the packet of cycle c contains the _standard
+// and the rops of _cycled for which (c % period) == phase. the check at point 2 becomes: sizeof_standard + the max 
+// over the eo_transmitter_regcycles_max cycles of the bytes of their cycled rops. the default rules keep the old split.
+// the rops sent as sigz<> are formed at every packet from the ones in _cycled, which keep the size of the sig<>. they
+// count for 4 bytes more, which is the most that a sigz<> can be larger than its sig<>.
 
  
 extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
 {
     EOtransmitter *retptr = NULL;   
     uint16_t capacityofregularsubframes = 0;
+    uint16_t capacityofcycledregulars = 0;
 
     if(NULL == cfg)
     {    
@@ -176,8 +233,7 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     retptr->txpacket                = eo_packet_New(cfg->sizes.capacityoftxpacket);
     retptr->ropframereadytotx       = eo_ropframe_New();
     retptr->ropframeregulars_standard  = eo_ropframe_New();
-    retptr->ropframeregulars_cycle0of  = eo_ropframe_New();
-    retptr->ropframeregulars_cycle1of  = eo_ropframe_New();
+    retptr->ropframeregulars_cycled    = eo_ropframe_New();
     retptr->ropframeoccasionals     = eo_ropframe_New();
     retptr->ropframereplies         = eo_ropframe_New();
     retptr->roptmp                  = eo_rop_New(cfg->sizes.capacityofrop);
@@ -192,8 +248,9 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
 //    capacityofregularsubframes = (capacityofregularsubframes < eo_ropframe_sizeforZEROrops) ? (eo_ropframe_sizeforZEROrops) : (capacityofregularsubframes);
     capacityofregularsubframes = eo_ropframe_capacity2effectivecapacity(3*cfg->sizes.capacityofropframeregulars/4) + eo_ropframe_sizeforZEROrops;
     retptr->bufferropframeregulars_standard = (0 == capacityofregularsubframes) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacityofregularsubframes, 1));
-    retptr->bufferropframeregulars_cycle0of = (0 == capacityofregularsubframes) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacityofregularsubframes, 1));
-    retptr->bufferropframeregulars_cycle1of = (0 == capacityofregularsubframes) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacityofregularsubframes, 1));
+    // the cycled rops of all the cycles stay in a single ropframe which has the memory of the two cycled ropframes of the past
+    capacityofcycledregulars = eo_ropframe_capacity2effectivecapacity(3*cfg->sizes.capacityofropframeregulars/2) + eo_ropframe_sizeforZEROrops;
+    retptr->bufferropframeregulars_cycled = (0 == capacityofcycledregulars) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, capacityofcycledregulars, 1));
     // TAG(*1234*) : end
     retptr->bufferropframeoccasionals = (0 == cfg->sizes.capacityofropframeoccasionals) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframeoccasionals, 1));
     retptr->bufferropframereplies   = (0 == cfg->sizes.capacityofropframereplies) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, cfg->sizes.capacityofropframereplies, 1));
@@ -203,10 +260,8 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
 
     eo_ropframe_Load(retptr->ropframeregulars_standard, retptr->bufferropframeregulars_standard, eo_ropframe_sizeforZEROrops, capacityofregularsubframes);
     eo_ropframe_Clear(retptr->ropframeregulars_standard);
-    eo_ropframe_Load(retptr->ropframeregulars_cycle0of, retptr->bufferropframeregulars_cycle0of, eo_ropframe_sizeforZEROrops, capacityofregularsubframes);
-    eo_ropframe_Clear(retptr->ropframeregulars_cycle0of);    
-    eo_ropframe_Load(retptr->ropframeregulars_cycle1of, retptr->bufferropframeregulars_cycle1of, eo_ropframe_sizeforZEROrops, capacityofregularsubframes);
-    eo_ropframe_Clear(retptr->ropframeregulars_cycle1of);    
+    eo_ropframe_Load(retptr->ropframeregulars_cycled, retptr->bufferropframeregulars_cycled, eo_ropframe_sizeforZEROrops, capacityofcycledregulars);
+    eo_ropframe_Clear(retptr->ropframeregulars_cycled);    
     
     eo_ropframe_Load(retptr->ropframeoccasionals, retptr->bufferropframeoccasionals, eo_ropframe_sizeforZEROrops, cfg->sizes.capacityofropframeoccasionals);
     eo_ropframe_Clear(retptr->ropframeoccasionals);
@@ -269,6 +324,25 @@ extern EOtransmitter* eo_transmitter_New(const eOtransmitter_cfg_t *cfg)
     
     retptr->effectivecapacityofregulars = eo_ropframe_capacity2effectivecapacity(cfg->sizes.capacityofropframeregulars);
     retptr->txregularsprogressive = 0;
+    retptr->regularscycle = 0;
+    retptr->regcyclingskipempty = 1;
+    retptr->numberofregcyclingrules = sizeof(s_eo_transmitter_regcycle_rules_default) / sizeof(eOtransmitter_regcycle_rule_t);
+    retptr->regcyclingrules = s_eo_transmitter_regcycle_rules_default;
+    retptr->regcyclingrulesram = NULL;
+    retptr->numberofregziprules = 0;
+    retptr->regziprules = NULL;
+    retptr->zipscratch = NULL;
+    retptr->zipscratchsize = 0;
+    
+    memcpy(retptr->classcfg, s_eo_transmitter_classcfg_default, sizeof(retptr->classcfg));
+    memset(retptr->classstats, 0, sizeof(retptr->classstats));
+    memset(retptr->classqueuedsince, 0, sizeof(retptr->classqueuedsince));
+    memset(retptr->endpointpriority, EOK_uint08dummy, sizeof(retptr->endpointpriority));
+    // the standard regulars, each cycled regular and each rop of occasionals and replies, which is at least 8 bytes (its head) long
+    retptr->maxscheditems = 1 + cfg->sizes.maxnumberofregularrops + (cfg->sizes.capacityofropframeoccasionals + cfg->sizes.capacityofropframereplies) / sizeof(eOrophead_t);
+    // the items are allocated only when the default order is changed, so the boards which keep it dont spend memory for them
+    retptr->scheditems = NULL;
+    retptr->schedorder = NULL;
     
     return(retptr);
 }
@@ -305,23 +379,34 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
 
     if(NULL != p->listofregropinfo)
     {
+        eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_zipbase_free, NULL);
         eo_list_Delete(p->listofregropinfo);
     }     
+    if(NULL != p->zipscratch)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->zipscratch);
+        p->zipscratch = NULL;
+    }
+    if(NULL != p->regziprules)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regziprules);
+        p->regziprules = NULL;
+    }
+    if(NULL != p->regcyclingrulesram)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->regcyclingrulesram);
+        p->regcyclingrulesram = NULL;
+    }
     if(NULL != p->bufferropframeregulars_standard)
     {
         eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_standard);
         p->bufferropframeregulars_standard = NULL;
     }
-    if(NULL != p->bufferropframeregulars_cycle0of)
+    if(NULL != p->bufferropframeregulars_cycled)
     {
-        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_cycle0of);
-        p->bufferropframeregulars_cycle0of = NULL;
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_cycled);
+        p->bufferropframeregulars_cycled = NULL;
     } 
-    if(NULL != p->bufferropframeregulars_cycle1of)
-    {
-        eo_mempool_Delete(eo_mempool_GetHandle(), p->bufferropframeregulars_cycle1of);
-        p->bufferropframeregulars_cycle1of = NULL;
-    }     
     if(NULL != p->bufferropframeoccasionals)
     {
         eo_mempool_Delete(eo_mempool_GetHandle(),  p->bufferropframeoccasionals);
@@ -332,13 +417,19 @@ extern void eo_transmitter_Delete(EOtransmitter *p)
         eo_mempool_Delete(eo_mempool_GetHandle(),  p->bufferropframereplies);
         p->bufferropframereplies = NULL;
     }  
+    if(NULL != p->scheditems)
+    {
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->scheditems);
+        eo_mempool_Delete(eo_mempool_GetHandle(), p->schedorder);
+        p->scheditems = NULL;
+        p->schedorder = NULL;
+    }
     
     eo_rop_Delete(p->roptmp);
     
     eo_ropframe_Delete(p->ropframereadytotx);
     eo_ropframe_Delete(p->ropframeregulars_standard);
-    eo_ropframe_Delete(p->ropframeregulars_cycle0of);
-    eo_ropframe_Delete(p->ropframeregulars_cycle1of);
+    eo_ropframe_Delete(p->ropframeregulars_cycled);
     eo_ropframe_Delete(p->ropframeoccasionals);
     eo_ropframe_Delete(p->ropframereplies);
    
@@ -586,6 +677,9 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     EOnv* tmpnvptr = NULL;
     eo_transm_regropframe_t regropframe2use_type = eo_transm_regropframe_standard;
     EOropframe* regropframe2use = NULL;
+    uint8_t period = 1;
+    uint8_t phase = 0;
+    const eOtransmitter_regzip_rule_t *ziprule = NULL;
 
     if((NULL == p) || (NULL == ropdesc)) 
     {
@@ -692,12 +786,42 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     tmpnvptr = eo_rop_GetNV(p->roptmp);
     
 
-    // choose the relevant regular ropframe. that depends on the id32 of the ropdescriptor 
-    regropframe2use = s_eo_transmitter_id32_to_typeofregulars(p, ropdescriptor.id32, &regropframe2use_type);
+    // choose the relevant regular ropframe and the cycles of the rop. that depends on the id32 of the ropdescriptor and on the rules
+    regropframe2use_type = s_eo_transmitter_regulars_place(p, ropdescriptor.id32, &period, &phase);
+    // the rops sent as sigz<> are in _cycled also if sent in every cycle, because they are formed one by one
+    ziprule = s_eo_transmitter_regulars_ziprule(p, ropdescriptor.ropcode, ropdescriptor.id32);
+    if(NULL != ziprule)
+    {
+        regropframe2use_type = eo_transm_regropframe_cycled;
+    }
+    regropframe2use = (eo_transm_regropframe_standard == regropframe2use_type) ? (p->ropframeregulars_standard) : (p->ropframeregulars_cycled);
+    if((eo_transm_regropframe_cycled == regropframe2use_type) && (eo_transmitter_regcycle_phase_auto == phase))
+    {   // we balance the bytes: we use the phase whose cycles have the fewest bytes
+        uint16_t best = EOK_uint16dummy;
+        uint32_t bestsum = EOK_uint32dummy;
+        uint8_t ph = 0;
+        uint8_t c = 0;
+        for(ph=0; ph<period; ph++)
+        {
+            uint16_t worst = 0;
+            uint32_t sum = 0;
+            for(c=ph; c<eo_transmitter_regcycles_max; c+=period)
+            {
+                worst = EO_MAX(worst, p->totalsizeofregulars_cycle[c]);
+                sum += p->totalsizeofregulars_cycle[c];
+            }
+            if((worst < best) || ((worst == best) && (sum < bestsum)))
+            {
+                best = worst;
+                bestsum = sum;
+                phase = ph;
+            }
+        }
+    }
     
-    // see if we have space for this rop. as we transmit always a standard with one between cycled0of / cycled1of, we need verify
-    // with knowledge of regropframe2use_type and of usedbytes. 
-    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, regropframe2use_type, usedbytes))
+    // see if we have space for this rop. as we transmit always the standard with the cycled of one cycle, we need verify
+    // with knowledge of period, phase and of usedbytes. 
+    if(eobool_false == s_eo_transmitter_regulars_canadd_rop(p, period, phase, usedbytes + ((NULL == ziprule) ? (0) : (sizeof(eOropzip_head_t)))))
     {   // cannot load the rop because we dont have usedbytes anymore
         eov_mutex_Release(p->mtx_roptmp);
         eov_mutex_Release(p->mtx_regulars);
@@ -725,13 +849,21 @@ extern eOresult_t eo_transmitter_regular_rops_Load(EOtransmitter *p, eOropdescri
     regropinfo.ropsize                  = ropsize;
     regropinfo.timeoffsetinsiderop      = (0 == p->roptmp->stream.head.ctrl.plustime) ? (EOK_uint16dummy) : (ropsize - 8); //if we have time, then it is in teh last 8 bytes
     memcpy(&regropinfo.thenv, tmpnvptr, sizeof(EOnv));
+    regropinfo.period                   = period;
+    regropinfo.phase                    = phase;
+    regropinfo.zip                      = (NULL == ziprule) ? (0) : (1);
+    regropinfo.zipversion               = 0;
+    regropinfo.ziparrayoffset           = (NULL == ziprule) ? (EOK_uint16dummy) : (ziprule->arrayoffset);
+    regropinfo.zipkeyframeperiod        = (NULL == ziprule) ? (0) : (ziprule->keyframeperiod);
+    regropinfo.zipcountdown             = 0;
+    regropinfo.zipbase                  = (0 == regropinfo.zipkeyframeperiod) ? (NULL) : ((uint8_t*)eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, ropdescriptor.size, 1));
 
 
     // push back regropinfo inside the list.
     eo_list_PushBack(p->listofregropinfo, &regropinfo);
     
     // increment size of the relevant regular ropframe
-    s_eo_transmitter_regulars_update_sizes(p, regropframe2use_type, +regropinfo.ropsize); // with a + we increment
+    s_eo_transmitter_regulars_update_sizes(p, &regropinfo, +s_eo_transmitter_regulars_bytes(&regropinfo)); // with a + we increment
     
     eov_mutex_Release(p->mtx_roptmp);
     eov_mutex_Release(p->mtx_regulars);  
@@ -798,7 +930,9 @@ extern eOresult_t eo_transmitter_regular_rops_Unload(EOtransmitter *p, eOropdesc
     eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
     
     // decrement the size of relevant ropframe
-    s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement
+    s_eo_transmitter_regulars_update_sizes(p, &regropinfo, -s_eo_transmitter_regulars_bytes(&regropinfo)); // with a -regropinfo.ropsize we decrement
+    
+    s_eo_transmitter_list_zipbase_free(&regropinfo, NULL);
 
     eov_mutex_Release(p->mtx_regulars);
     
@@ -867,7 +1001,9 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
         eo_ropframe_ROP_Rem(regropinfo.ropframe, regropinfo.ropstarthere, regropinfo.ropsize);
         
         // decrement the size of relevant ropframe
-        s_eo_transmitter_regulars_update_sizes(p, (eo_transm_regropframe_t)regropinfo.regropframetype, -regropinfo.ropsize); // with a -regropinfo.ropsize we decrement    
+        s_eo_transmitter_regulars_update_sizes(p, &regropinfo, -s_eo_transmitter_regulars_bytes(&regropinfo)); // with a -regropinfo.ropsize we decrement    
+        
+        s_eo_transmitter_list_zipbase_free(&regropinfo, NULL);
     }
 
     eov_mutex_Release(p->mtx_regulars);
@@ -896,11 +1032,11 @@ extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p)
         return(eores_OK);
     } 
     
+    eo_list_Execute(p->listofregropinfo, s_eo_transmitter_list_zipbase_free, NULL);
     eo_list_Clear(p->listofregropinfo);
     
     eo_ropframe_Clear(p->ropframeregulars_standard);
-    eo_ropframe_Clear(p->ropframeregulars_cycle0of);
-    eo_ropframe_Clear(p->ropframeregulars_cycle1of);    
+    eo_ropframe_Clear(p->ropframeregulars_cycled);
     
     s_eo_transmitter_regulars_reset_sizes(p);
 
@@ -941,6 +1077,158 @@ extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p)
 }
 
 
+extern eOresult_t eo_transmitter_regular_rops_Cycling_Set(EOtransmitter *p, const eOtransmitter_regcycle_rule_t *rules, uint8_t numberof, eObool_t skipemptycycles)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL == rules)
+    {
+        rules = s_eo_transmitter_regcycle_rules_default;
+        numberof = sizeof(s_eo_transmitter_regcycle_rules_default) / sizeof(eOtransmitter_regcycle_rule_t);
+    }
+    
+    if(numberof > eo_transmitter_regcycle_maxrules)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    // the rules are used when a rop is loaded: the ones already loaded would keep the old cycles
+    if((NULL != p->listofregropinfo) && (eobool_false == eo_list_Empty(p->listofregropinfo)))
+    {
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_busy);
+    }
+    
+    if(s_eo_transmitter_regcycle_rules_default == rules)
+    {
+        p->regcyclingrules = s_eo_transmitter_regcycle_rules_default;
+    }
+    else
+    {   // the memory for the rules of the user is taken only once
+        if(NULL == p->regcyclingrulesram)
+        {
+            p->regcyclingrulesram = (eOtransmitter_regcycle_rule_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOtransmitter_regcycle_rule_t), eo_transmitter_regcycle_maxrules);
+        }
+        memcpy(p->regcyclingrulesram, rules, numberof*sizeof(eOtransmitter_regcycle_rule_t));
+        p->regcyclingrules = p->regcyclingrulesram;
+    }
+    p->numberofregcyclingrules = numberof;
+    p->regcyclingskipempty = (eobool_true == skipemptycycles) ? (1) : (0);
+    
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);
+}
+
+
+extern uint16_t eo_transmitter_regular_rops_Schedule_Get(EOtransmitter *p, eOtransmitter_regrop_schedule_t *schedule, uint16_t capacity)
+{
+    EOlistIter *li = NULL;
+    uint16_t n = 0;
+    
+    if((NULL == p) || (NULL == schedule) || (NULL == p->listofregropinfo)) 
+    {
+        return(0);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    for(li = eo_list_Begin(p->listofregropinfo); (NULL != li) && (n < capacity); li = eo_list_Next(p->listofregropinfo, li))
+    {
+        eo_transm_regrop_info_t *info = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+        schedule[n].id32 = info->thenv.id32;
+        schedule[n].size = info->ropsize;
+        schedule[n].period = info->period;
+        schedule[n].phase = info->phase;
+        n++;
+    }
+    
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(n);
+}
+
+
+extern eOresult_t eo_transmitter_regular_rops_Cycles_Get(EOtransmitter *p, eOtransmitter_regcycle_fill_t fill[eo_transmitter_regcycles_max])
+{
+    uint8_t c = 0;
+    uint8_t numberofstandard = 0;
+    
+    if((NULL == p) || (NULL == fill)) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    numberofstandard = eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard);
+    for(c=0; c<eo_transmitter_regcycles_max; c++)
+    {
+        fill[c].bytes = p->totalsizeofregulars_standard + p->totalsizeofregulars_cycle[c];
+        fill[c].rops = numberofstandard + p->numberofregulars_cycle[c];
+        fill[c].fillratio = (0 == p->effectivecapacityofregulars) ? (0) : ((uint8_t)((100 * (uint32_t)fill[c].bytes) / p->effectivecapacityofregulars));
+    }
+    
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_regular_rops_Zip_Set(EOtransmitter *p, const eOtransmitter_regzip_rule_t *rules, uint8_t numberof)
+{
+    if(NULL == p) 
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(NULL == rules)
+    {
+        numberof = 0;
+    }
+    
+    if(numberof > eo_transmitter_regzip_maxrules)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
+    
+    // the rules are used when a rop is loaded
+    if((NULL != p->listofregropinfo) && (eobool_false == eo_list_Empty(p->listofregropinfo)))
+    {
+        eov_mutex_Release(p->mtx_regulars);
+        return(eores_NOK_busy);
+    }
+    
+    if(0 != numberof)
+    {   // the memory for the rules is taken only once
+        if(NULL == p->regziprules)
+        {
+            p->regziprules = (eOtransmitter_regzip_rule_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOtransmitter_regzip_rule_t), eo_transmitter_regzip_maxrules);
+        }
+        memcpy(p->regziprules, rules, numberof*sizeof(eOtransmitter_regzip_rule_t));
+    }
+    p->numberofregziprules = numberof;
+    
+    // the sigz<> of a packet are at most as big as the regulars which may be sent in it
+    if((0 != numberof) && (NULL == p->zipscratch) && (0 != p->effectivecapacityofregulars))
+    {
+        p->zipscratchsize = p->effectivecapacityofregulars;
+        p->zipscratch = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, p->zipscratchsize, 1);
+    }
+    
+    eov_mutex_Release(p->mtx_regulars);
+    
+    return(eores_OK);
+}
+
+
 extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *numberofreplies, uint16_t *numberofoccasionals, uint16_t *numberofregulars)
 {
     if(NULL == p)
@@ -980,12 +1268,12 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
     {
         if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
         {
-            uint16_t cycledrops = 0;
+            uint8_t skipped = 0;
             eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
-            // we may have one of the cycled or not
-            s_eo_transmitter_get_cycled_regropframe(p, &cycledrops);
+            // we may have some of the cycled or not
+            uint8_t cycle = s_eo_transmitter_regulars_cycle(p, &skipped);
             // but the standard is alwyas added
-            *numberofregulars = eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard) + cycledrops;
+            *numberofregulars = eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard) + p->numberofregulars_cycle[cycle];
             eov_mutex_Release(p->mtx_regulars);
         }
         else
@@ -1002,7 +1290,9 @@ extern eOresult_t eo_transmitter_NumberofOutROPs(EOtransmitter *p, uint16_t *num
 
 extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *numberofrops, eOtransmitter_ropsnumber_t *ropsnum)
 {
-    uint16_t remainingbytes;
+    eObool_t due[eo_transmitter_classes_numberof] = {eobool_false};
+    uint16_t sentrops[eo_transmitter_classes_numberof] = {0};
+    eOabstime_t now = 0;
 
     if(NULL == p) 
     {
@@ -1079,68 +1369,72 @@ extern eOresult_t eo_transmitter_outpacket_Prepare(EOtransmitter *p, uint16_t *n
 //    }
 
 
-    // add to it the ropframe of regulars. keep it afterwards. dont clear it !!!
-    if(0 == (p->txdecimationprogressive % p->txdecimationregulars))
+    // marco.accame: the regulars, the occasionals and the replies are not appended anymore one ropframe after the other.
+    // the scheduler places them by deadline and priority and what does not fit stays for the following packet, 
+    // so that bulk rops cannot starve the others and nothing is lost if the packet is full.
+    
+    now = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    
+    due[eo_transmitter_class_regulars]      = (0 == (p->txdecimationprogressive % p->txdecimationregulars)) ? (eobool_true) : (eobool_false);
+    due[eo_transmitter_class_occasionals]   = (0 == (p->txdecimationprogressive % p->txdecimationoccasionals)) ? (eobool_true) : (eobool_false);
+    due[eo_transmitter_class_replies]       = (0 == (p->txdecimationprogressive % p->txdecimationreplies)) ? (eobool_true) : (eobool_false);
+    
+    // the regulars are always there: their delay starts now that they are due, before their refresh
+    if((eobool_true == due[eo_transmitter_class_regulars]) && (0 == p->classqueuedsince[eo_transmitter_class_regulars]))
     {
-        EOropframe* cycledregulars = NULL;
-        uint16_t nregularscycled = 0;
-        uint16_t nregulars = 0;
-
-        // refresh all regulars ...    
+        p->classqueuedsince[eo_transmitter_class_regulars] = now;
+    }
+    
+    if(eobool_true == due[eo_transmitter_class_regulars])
+    {   // refresh all regulars ...  
         eo_transmitter_regular_rops_Refresh(p);
-        
-        // then copy regulars into the ropframe ready to be transmitted
-        
+    }
+    
+    if((eobool_true == due[eo_transmitter_class_occasionals]) && (NULL != p->confmanager))
+    {   // the requests of confirmation which have expired are loaded again amongst the occasionals
+        eo_confman_Timeouts_Process(p->confmanager, s_eo_transmitter_confman_retransmit, p);
+    }
+    
+    // we lock all the ropframes which we use, always in the same order
+    if(eobool_true == due[eo_transmitter_class_regulars])
+    {
+        uint8_t skipped = 0;
         eov_mutex_Take(p->mtx_regulars, eok_reltimeINFINITE);
-        
-        // at first the standard regulars which are always transmitted
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframeregulars_standard, &remainingbytes);
-        nregulars += eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard);
-        
-        // then add the cycled one, if there are any
-        cycledregulars = s_eo_transmitter_get_cycled_regropframe(p, &nregularscycled);
-        if(NULL != cycledregulars)
-        {
-            eo_ropframe_Append(p->ropframereadytotx, cycledregulars, &remainingbytes);
-            nregulars += nregularscycled;
-        }
-                
-        eov_mutex_Release(p->mtx_regulars);
-        
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofregulars = nregulars;
-        }
-        
-        // very important: increment the regulars progressive number. it is used to decide which cycling regular to get
-        p->txregularsprogressive ++;
+        p->regularscycle = s_eo_transmitter_regulars_cycle(p, &skipped);
+        p->txregularsprogressive += skipped;
     }
-
-    // add the ropframe of occasionals ... and then clear it
-    if(0 == (p->txdecimationprogressive % p->txdecimationoccasionals))
+    if(eobool_true == due[eo_transmitter_class_occasionals])
     {
         eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofoccasionals = eo_ropframe_ROP_NumberOf(p->ropframeoccasionals);
-        }
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframeoccasionals, &remainingbytes);
-        eo_ropframe_Clear(p->ropframeoccasionals);
-        eov_mutex_Release(p->mtx_occasionals);
     }
-
-    // add the ropframe of replies ... and then clear it
-    if(0 == (p->txdecimationprogressive % p->txdecimationreplies))
+    if(eobool_true == due[eo_transmitter_class_replies])
     {
         eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
-        if(NULL != ropsnum)
-        {
-            ropsnum->numberofreplies = eo_ropframe_ROP_NumberOf(p->ropframereplies);
-        }        
-        eo_ropframe_Append(p->ropframereadytotx, p->ropframereplies, &remainingbytes);
-        eo_ropframe_Clear(p->ropframereplies);
+    }
+    
+    s_eo_transmitter_schedule(p, due, now, sentrops);
+    
+    if(eobool_true == due[eo_transmitter_class_replies])
+    {
         eov_mutex_Release(p->mtx_replies);
     }
+    if(eobool_true == due[eo_transmitter_class_occasionals])
+    {
+        eov_mutex_Release(p->mtx_occasionals);
+    }
+    if(eobool_true == due[eo_transmitter_class_regulars])
+    {
+        eov_mutex_Release(p->mtx_regulars);
+        // very important: increment the regulars progressive number. it is used to decide which cycling regular to get
+        p->txregularsprogressive ++;
+    }
+    
+    if(NULL != ropsnum)
+    {
+        ropsnum->numberofregulars = sentrops[eo_transmitter_class_regulars];
+        ropsnum->numberofoccasionals = sentrops[eo_transmitter_class_occasionals];
+        ropsnum->numberofreplies = sentrops[eo_transmitter_class_replies];
+    }
 
 
 
@@ -1185,6 +1479,61 @@ extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repl
     return(eores_NOK_nullpointer);       
 }
 
+extern eOresult_t eo_transmitter_Scheduling_Set(EOtransmitter *p, eOtransmitter_class_t cls, const eOtransmitter_classcfg_t *cfg)
+{
+    if((NULL == p) || (NULL == cfg))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((uint8_t)cls >= eo_transmitter_classes_numberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    s_eo_transmitter_schedule_enable(p);
+    memcpy(&p->classcfg[cls], cfg, sizeof(eOtransmitter_classcfg_t));
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_Scheduling_EndpointPriority_Set(EOtransmitter *p, eOprotEndpoint_t ep, uint8_t priority)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(ep >= eoprot_endpoints_numberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    s_eo_transmitter_schedule_enable(p);
+    p->endpointpriority[ep] = priority;
+    
+    return(eores_OK);
+}
+
+
+extern eOresult_t eo_transmitter_Scheduling_Stats_Get(EOtransmitter *p, eOtransmitter_class_t cls, eOtransmitter_classstats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((uint8_t)cls >= eo_transmitter_classes_numberof)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    memcpy(stats, &p->classstats[cls], sizeof(eOtransmitter_classstats_t));
+    
+    return(eores_OK);
+}
+
 extern eOresult_t eo_transmitter_outpacket_SetRemoteAddress(EOtransmitter *p, eOipv4addr_t remaddr, eOipv4port_t remport)
 {
     if(NULL == p) 
@@ -1241,7 +1590,7 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
     *outpkt = p->txpacket;
 
 
-    // if the confirmation manager is active .. call it
+    // if the confirmation manager is active .. call it. the rops of the packet have already been tracked when placed
     if(NULL != p->confmanager)
     {
         eo_confman_ConfirmationRequests_Process(p->confmanager, p->ipv4addr);
@@ -1297,6 +1646,7 @@ extern eOresult_t eo_transmitter_reply_ropframe_Load(EOtransmitter *p, EOropfram
 
     eov_mutex_Take(p->mtx_replies, eok_reltimeINFINITE);
     res = eo_ropframe_Append(p->ropframereplies, ropframe, &remainingbytes);
+    s_eo_transmitter_queued(p, p->ropframereplies, res);
     eov_mutex_Release(p->mtx_replies);
     
     // replies cannot have a conf request flagged on, then there is no insertion inside the p->confrequests
@@ -1308,7 +1658,10 @@ extern eOresult_t eo_transmitter_reply_ropframe_Load(EOtransmitter *p, EOropfram
 extern eOresult_t eo_transmitter_occasional_rops_LoadStream(EOtransmitter *p, uint8_t *stream, uint16_t size)
 {    
     eOresult_t res;
+    eov_mutex_Take(p->mtx_occasionals, eok_reltimeINFINITE);
     res = eo_ropframe_ROPdata_Add(p->ropframeoccasionals, stream, size, NULL);
+    s_eo_transmitter_queued(p, p->ropframeoccasionals, res);
+    eov_mutex_Release(p->mtx_occasionals);
     return(res);
 }
 
@@ -1503,6 +1856,7 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     // put the rop inside the ropframe: protec ropframe vs concurrent use
     eov_mutex_Take(mtx, eok_reltimeINFINITE);
     res = eo_ropframe_ROP_Add(intoropframe, p->roptmp, NULL, &ropsize, &remainingbytes);
+    s_eo_transmitter_queued(p, intoropframe, res);
     eov_mutex_Release(mtx);
     
     // we dont use p->tmprop anymore: release its mutex
@@ -1532,150 +1886,750 @@ static eOresult_t s_eo_transmitter_rops_Load(EOtransmitter *p, eOropdescriptor_t
     return(res);   
 }
 
-static EOropframe * s_eo_transmitter_id32_to_typeofregulars(EOtransmitter* p, eOprotID32_t id32, eo_transm_regropframe_t *ropframetype)
+static eo_transm_regropframe_t s_eo_transmitter_regulars_place(EOtransmitter* p, eOprotID32_t id32, uint8_t *period, uint8_t *phase)
 {
-    EOropframe* ret = NULL;
+    uint8_t i = 0;
+    uint8_t per = 1;
     
-    if(eoprot_endpoint_motioncontrol == eoprot_ID2endpoint(id32))
-    {   // we put in here joints, motors but also the controller  ...
-        
-        if(eoprot_entity_mc_controller == eoprot_ID2entity(id32))
-        {
-            *ropframetype = eo_transm_regropframe_standard;
-            ret = p->ropframeregulars_standard;
-        }
-        else if(eoprot_ID2index(id32) < 6)
+    *period = 1;
+    *phase = 0;
+    
+    for(i=0; i<p->numberofregcyclingrules; i++)
+    {
+        const eOtransmitter_regcycle_rule_t *rule = &p->regcyclingrules[i];
+        if((id32 & rule->mask) == (rule->id32 & rule->mask))
         {
-            *ropframetype = eo_transm_regropframe_cycle0of;    
-            ret = p->ropframeregulars_cycle0of;
+            // the period must divide eo_transmitter_regcycles_max so that the cycles repeat always in the same way
+            while((per < rule->period) && (per < eo_transmitter_regcycles_max))
+            {
+                per <<= 1;
+            }
+            *period = per;
+            *phase = (eo_transmitter_regcycle_phase_auto == rule->phase) ? (eo_transmitter_regcycle_phase_auto) : (rule->phase % per);
+            break;
         }
-        else
-        {
-            *ropframetype = eo_transm_regropframe_cycle1of;
-            ret = p->ropframeregulars_cycle1of;
-        }        
     }
-    else
+    
+    if(1 == *period)
     {
-        *ropframetype = eo_transm_regropframe_standard; 
-        ret = p->ropframeregulars_standard;        
+        *phase = 0;
+        return(eo_transm_regropframe_standard);
     }
-
-    return(ret);  
+    
+    return(eo_transm_regropframe_cycled);  
 }
 
-static EOropframe * s_eo_transmitter_get_cycled_regropframe(EOtransmitter* p, uint16_t *ropsinside)
+static uint8_t s_eo_transmitter_regulars_cycle(EOtransmitter* p, uint8_t *skipped)
 {
-    EOropframe* ret = NULL;
-    uint16_t s0 = eo_ropframe_ROP_NumberOf(p->ropframeregulars_cycle0of);
-    uint16_t s1 = eo_ropframe_ROP_NumberOf(p->ropframeregulars_cycle1of);
+    uint8_t cycle = p->txregularsprogressive % eo_transmitter_regcycles_max;
+    uint8_t i = 0;
     
-    if(0 == (s0+s1))
-    {   // we dont have any
-        ret = NULL;
-        *ropsinside = 0;
-    }
-    else if(0 == s1)
-    {   // we have only cycle0
-        ret = p->ropframeregulars_cycle0of;
-        *ropsinside = s0;
-    }
-    else if(0 == s0)
-    {   // we have only cycle1
-        ret = p->ropframeregulars_cycle1of;  
-        *ropsinside = s1;        
+    *skipped = 0;
+    
+    if(0 == p->regcyclingskipempty)
+    {
+        return(cycle);
     }
-    else
-    {   // we have both. i must alternate
-        if(0 == (p->txregularsprogressive % 2))
-        {   // we chose cycle0
-            ret = p->ropframeregulars_cycle0of;
-            *ropsinside = s0;
+    
+    // we use the first cycle which has some cycled rops. if none has, any cycle is ok
+    for(i=0; i<eo_transmitter_regcycles_max; i++)
+    {
+        uint8_t c = (cycle + i) % eo_transmitter_regcycles_max;
+        if(0 != p->numberofregulars_cycle[c])
+        {
+            *skipped = i;
+            return(c);
         }
-        else
-        {   // we chose cycle1
-            ret = p->ropframeregulars_cycle1of; 
-            *ropsinside = s1;
-        }        
     }
     
- 
-    return(ret);
+    return(cycle);
 }
 
 static void s_eo_transmitter_regulars_reset_sizes(EOtransmitter *p)
 {
     p->totalsizeofregulars_standard = 0;
-    p->totalsizeofregulars_cycle0of = 0;
-    p->totalsizeofregulars_cycle1of = 0;
+    memset(p->totalsizeofregulars_cycle, 0, sizeof(p->totalsizeofregulars_cycle));
+    memset(p->numberofregulars_cycle, 0, sizeof(p->numberofregulars_cycle));
     p->maxsizeofregulars = 0;    
 }
 
 static uint16_t s_eo_transmitter_get_maxsizeof_regularsropframe(EOtransmitter *p)
 {
-    return( p->totalsizeofregulars_standard + EO_MAX(p->totalsizeofregulars_cycle0of, p->totalsizeofregulars_cycle1of) );   
+    uint16_t max = 0;
+    uint8_t c = 0;
+    for(c=0; c<eo_transmitter_regcycles_max; c++)
+    {
+        max = EO_MAX(max, p->totalsizeofregulars_cycle[c]);
+    }
+    return(p->totalsizeofregulars_standard + max);   
 }
 
-static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, eo_transm_regropframe_t type, uint16_t ropbytes)
+static eObool_t s_eo_transmitter_regulars_canadd_rop(EOtransmitter *p, uint8_t period, uint8_t phase, uint16_t ropbytes)
 { 
-    uint16_t std = 0;
-    uint16_t cy0 = 0;
-    uint16_t cy1 = 0;
+    uint16_t std = p->totalsizeofregulars_standard;
+    uint8_t c = 0;
     
-    std = p->totalsizeofregulars_standard;
-    cy0 = p->totalsizeofregulars_cycle0of;
-    cy1 = p->totalsizeofregulars_cycle1of;
-
-    switch(type)
+    if(1 == period)
     {
-        case eo_transm_regropframe_standard:
+        std += ropbytes;
+    }
+    
+    // the packet of every cycle contains the standard and the cycled of the cycle
+    for(c=0; c<eo_transmitter_regcycles_max; c++)
+    {
+        uint16_t cycled = p->totalsizeofregulars_cycle[c];
+        if((1 != period) && ((c % period) == phase))
         {
-            std += ropbytes;
-        } break;
-        case eo_transm_regropframe_cycle0of:
+            cycled += ropbytes;
+        }
+        if((std + cycled) > p->effectivecapacityofregulars)
         {
-            cy0 += ropbytes;
-        } break; 
-        case eo_transm_regropframe_cycle1of:
+            return(eobool_false);
+        }
+    }
+    
+    return(eobool_true);          
+}
+
+
+static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, const eo_transm_regrop_info_t *info, int16_t ropbytes)
+{
+    uint8_t c = 0;
+    
+    if(eo_transm_regropframe_standard == info->regropframetype)
+    {
+        p->totalsizeofregulars_standard += ropbytes;
+    }
+    else
+    {
+        for(c=info->phase; c<eo_transmitter_regcycles_max; c+=info->period)
         {
-            cy1 += ropbytes;
-        } break;           
+            p->totalsizeofregulars_cycle[c] += ropbytes;
+            p->numberofregulars_cycle[c] += (ropbytes > 0) ? (+1) : (-1);
+        }
     }
+    
+    p->maxsizeofregulars = s_eo_transmitter_get_maxsizeof_regularsropframe(p);
+}
 
-    if( (std + EO_MAX(cy0, cy1)) > p->effectivecapacityofregulars)
+
+static uint16_t s_eo_transmitter_regulars_bytes(const eo_transm_regrop_info_t *info)
+{   // a sigz<> is at most as big as its sig<> plus the eOropzip_head_t
+    return(info->ropsize + ((1 == info->zip) ? (sizeof(eOropzip_head_t)) : (0)));
+}
+
+
+static const eOtransmitter_regzip_rule_t * s_eo_transmitter_regulars_ziprule(EOtransmitter *p, eOropcode_t ropc, eOprotID32_t id32)
+{
+    uint8_t i = 0;
+    
+    if((eo_ropcode_sig != ropc) || (NULL == p->zipscratch))
     {
-        return(eobool_false);
+        return(NULL);
     }
     
-    return(eobool_true);          
+    for(i=0; i<p->numberofregziprules; i++)
+    {
+        const eOtransmitter_regzip_rule_t *rule = &p->regziprules[i];
+        if((id32 & rule->mask) == (rule->id32 & rule->mask))
+        {
+            return(rule);
+        }
+    }
+    
+    return(NULL);
 }
 
 
-static void s_eo_transmitter_regulars_update_sizes(EOtransmitter *p, eo_transm_regropframe_t type, int16_t ropbytes)
+static void s_eo_transmitter_list_zipbase_free(void *item, void *param)
 {
-    switch(type)
+    eo_transm_regrop_info_t *info = (eo_transm_regrop_info_t*)item;
+    
+    param = param;
+    
+    if(NULL != info->zipbase)
     {
-        case eo_transm_regropframe_standard:
+        eo_mempool_Delete(eo_mempool_GetHandle(), info->zipbase);
+        info->zipbase = NULL;
+    }
+}
+
+
+static uint16_t s_eo_transmitter_zip_rop(const eo_transm_regrop_info_t *info, uint8_t *out, uint16_t capacity)
+{   // it writes into out the sigz<> of the sig<> of info, which is in _cycled. it returns its size or 0 if not worth it
+    const uint8_t *rop = eo_ropframe_hid_get_pointer_offset(info->ropframe, info->ropstarthere);
+    eOrophead_t head;
+    uint16_t datasize = 0;
+    uint16_t tailsize = 0;
+    uint16_t zipsize = 0;
+    uint8_t version = 0;
+    
+    if(capacity < s_eo_transmitter_regulars_bytes(info))
+    {
+        return(0);
+    }
+    
+    memcpy(&head, rop, sizeof(eOrophead_t));
+    datasize = eo_rop_datafield_effective_size(head.dsiz);
+    tailsize = info->ropsize - sizeof(eOrophead_t) - datasize;
+    
+    if(0 == info->zipkeyframeperiod)
+    {   // only the array and only if smaller
+        if((EOK_uint16dummy == info->ziparrayoffset) || (datasize <= sizeof(eOropzip_head_t)))
+        {
+            return(0);
+        }
+        zipsize = eo_rop_zip_Encode(eo_ropzip_array, 0, rop + sizeof(eOrophead_t), NULL, head.dsiz, info->ziparrayoffset, out + sizeof(eOrophead_t), datasize - sizeof(eOropzip_head_t));
+    }
+    else
+    {   // a xor-delta if it is not time for a keyframe, else the array or the full value
+        version = (255 == info->zipversion) ? (1) : (info->zipversion + 1);
+        if((0 != info->zipversion) && (0 != info->zipcountdown))
         {
-            p->totalsizeofregulars_standard += ropbytes;
-        } break;
-        case eo_transm_regropframe_cycle0of:
+            zipsize = eo_rop_zip_Encode(eo_ropzip_xordelta, version, rop + sizeof(eOrophead_t), info->zipbase, head.dsiz, 0, out + sizeof(eOrophead_t), head.dsiz);
+        }
+        if((0 == zipsize) && (EOK_uint16dummy != info->ziparrayoffset))
         {
-            p->totalsizeofregulars_cycle0of += ropbytes;
-        } break; 
-        case eo_transm_regropframe_cycle1of:
+            zipsize = eo_rop_zip_Encode(eo_ropzip_array, version, rop + sizeof(eOrophead_t), NULL, head.dsiz, info->ziparrayoffset, out + sizeof(eOrophead_t), head.dsiz + sizeof(eOropzip_head_t));
+        }
+        if(0 == zipsize)
         {
-            p->totalsizeofregulars_cycle1of += ropbytes;
-        } break;           
+            zipsize = eo_rop_zip_Encode(eo_ropzip_full, version, rop + sizeof(eOrophead_t), NULL, head.dsiz, 0, out + sizeof(eOrophead_t), head.dsiz + sizeof(eOropzip_head_t));
+        }
     }
     
-    p->maxsizeofregulars = s_eo_transmitter_get_maxsizeof_regularsropframe(p);
+    if(0 == zipsize)
+    {
+        return(0);
+    }
+    
+    head.ropc = eo_ropcode_sigz;
+    head.dsiz = zipsize;
+    memcpy(out, &head, sizeof(eOrophead_t));
+    memset(out + sizeof(eOrophead_t) + zipsize, 0, eo_rop_datafield_effective_size(zipsize) - zipsize);
+    memcpy(out + sizeof(eOrophead_t) + eo_rop_datafield_effective_size(zipsize), rop + sizeof(eOrophead_t) + datasize, tailsize);
+    
+    return(sizeof(eOrophead_t) + eo_rop_datafield_effective_size(zipsize) + tailsize);
 }
 
-// --------------------------------------------------------------------------------------------------------------------
-// - end-of-file (leave a blank line after)
-// --------------------------------------------------------------------------------------------------------------------
+
+static void s_eo_transmitter_zip_commit(eo_transm_regrop_info_t *info, const uint8_t *rop)
+{   // the sigz<> in rop was sent: the receiver has now the value which we obtain by decoding it as it does
+    eOrophead_t head;
+    eOropzip_head_t ziphead;
+    
+    if(0 == info->zipkeyframeperiod)
+    {
+        return;
+    }
+    
+    if(NULL == rop)
+    {   // it was the sig<>: the receiver has the full value without a version, so the next sigz<> is a keyframe
+        info->zipversion = 0;
+        info->zipcountdown = 0;
+        return;
+    }
+    
+    memcpy(&head, rop, sizeof(eOrophead_t));
+    memcpy(&ziphead, rop + sizeof(eOrophead_t), sizeof(eOropzip_head_t));
+    eo_rop_zip_Decode(rop + sizeof(eOrophead_t), head.dsiz, info->zipbase, ziphead.size);
+    
+    info->zipversion = ziphead.version;
+    info->zipcountdown = (eo_ropzip_xordelta == ziphead.encoding) ? (info->zipcountdown - 1) : (info->zipkeyframeperiod - 1);
+}
 
 
+static eOresult_t s_eo_transmitter_confman_retransmit(void *arg, eOropdescriptor_t *ropdes)
+{
+    return(eo_transmitter_occasional_rops_Load((EOtransmitter*)arg, ropdes));
+}
 
 
+static void s_eo_transmitter_confman_transmitted(EOtransmitter *p, eo_transm_scheditem_t *item)
+{   // the timeout of a request of confirmation starts when its rop leaves the queue, placed in the packet or dropped
+    uint8_t *framedata = NULL;
+    uint16_t framesize = 0;
+    uint16_t framecapacity = 0;
+    uint8_t *rop = NULL;
+    uint32_t signature = EOK_uint32dummy;
+    eOrophead_t head;
+    
+    if((NULL == p->confmanager) || (eo_transmitter_class_regulars == item->cls) || (0 == item->size))
+    {
+        return;
+    }
+    
+    eo_ropframe_Get(item->ropframe, &framedata, &framesize, &framecapacity);
+    rop = framedata + sizeof(EOropframeHeader_t) + item->offset;
+    memcpy(&head, rop, sizeof(eOrophead_t));
+    
+    if(1 != head.ctrl.rqstconf)
+    {
+        return;
+    }
+    
+    if(1 == head.ctrl.plussign)
+    {   // the signature follows the data field
+        uint16_t datasize = (eobool_true == eo_rop_datafield_is_present(&head)) ? (eo_rop_datafield_effective_size(head.dsiz)) : (0);
+        memcpy(&signature, rop + sizeof(eOrophead_t) + datasize, sizeof(signature));
+    }
+    
+    eo_confman_ConfirmationRequest_Transmitted(p->confmanager, p->ipv4addr, head.id32, signature);
+}
+
+
+static void s_eo_transmitter_queued(EOtransmitter *p, EOropframe *ropframe, eOresult_t res)
+{   // it is called with the mutex of the ropframe taken. the regulars are not queued: they stay until unloaded
+    eOtransmitter_class_t cls = eo_transmitter_class_regulars;
+    
+    if(ropframe == p->ropframeoccasionals)
+    {
+        cls = eo_transmitter_class_occasionals;
+    }
+    else if(ropframe == p->ropframereplies)
+    {
+        cls = eo_transmitter_class_replies;
+    }
+    else
+    {
+        return;
+    }
+    
+    if(eores_OK != res)
+    {
+        p->classstats[cls].dropped++;
+    }
+    else if(0 == p->classqueuedsince[cls])
+    {
+        p->classqueuedsince[cls] = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    }
+}
+
+
+static void s_eo_transmitter_schedule_enable(EOtransmitter *p)
+{   // the items which order the rops of a packet. the order is allocated first because a non NULL p->scheditems enables them
+    if(NULL != p->scheditems)
+    {
+        return;
+    }
+    p->schedorder = (uint16_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_16bit, sizeof(uint16_t), p->maxscheditems);
+    p->scheditems = (eo_transm_scheditem_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eo_transm_scheditem_t), p->maxscheditems);
+}
+
+
+static uint16_t s_eo_transmitter_schedule_ropitem(EOropframe *ropframe, uint16_t offset, eOtransmitter_class_t cls, eo_transm_scheditem_t *item, eOprotID32_t *id32)
+{   // it fills item with the rop at offset inside ropframe and returns its size, or 0 if there is no rop there
+    uint8_t *framedata = NULL;
+    uint16_t framesize = 0;
+    uint16_t framecapacity = 0;
+    uint16_t ropssize = 0;
+    uint16_t size = sizeof(eOrophead_t);
+    eOrophead_t head;
+    
+    eo_ropframe_Get(ropframe, &framedata, &framesize, &framecapacity);
+    ropssize = ((EOropframeHeader_t*)framedata)->ropssizeof;
+    
+    if((offset + sizeof(eOrophead_t)) > ropssize)
+    {
+        return(0);
+    }
+    
+    memcpy(&head, framedata + sizeof(EOropframeHeader_t) + offset, sizeof(eOrophead_t));
+    if(eobool_true == eo_rop_datafield_is_present(&head))
+    {
+        size += eo_rop_datafield_effective_size(head.dsiz);
+    }
+    size += (1 == head.ctrl.plussign) ? (4) : (0);
+    size += (1 == head.ctrl.plustime) ? (8) : (0);
+    
+    if((offset + size) > ropssize)
+    {
+        return(0);
+    }
+    
+    item->key = offset;
+    item->offset = offset;
+    item->size = size;
+    item->ropframe = ropframe;
+    item->data = NULL;
+    item->zipinfo = NULL;
+    item->cls = cls;
+    item->sent = 0;
+    
+    if(NULL != id32)
+    {
+        *id32 = head.id32;
+    }
+    
+    return(size);
+}
+
+
+static void s_eo_transmitter_schedule_cycleditem(EOtransmitter *p, eo_transm_regrop_info_t *info, eo_transm_scheditem_t *item, uint16_t *zipscratchused)
+{   // it fills item with a rop of the cycled regulars, formed as a sigz<> if it has a rule
+    item->key = 1 + info->ropstarthere;
+    item->offset = info->ropstarthere;
+    item->size = info->ropsize;
+    item->ropframe = p->ropframeregulars_cycled;
+    item->data = NULL;
+    item->zipinfo = NULL;
+    item->cls = eo_transmitter_class_regulars;
+    item->sent = 0;
+    
+    if(1 == info->zip)
+    {
+        uint16_t size = s_eo_transmitter_zip_rop(info, p->zipscratch + *zipscratchused, p->zipscratchsize - *zipscratchused);
+        if(0 != size)
+        {
+            item->size = size;
+            item->data = p->zipscratch + *zipscratchused;
+            item->zipinfo = info;
+            *zipscratchused += size;
+        }
+        else if(0 != info->zipkeyframeperiod)
+        {   // no room for the sigz<>: the sig<> is a keyframe of the full value, after which the xor-deltas start again
+            item->zipinfo = info;
+        }
+    }
+}
+
+
+static void s_eo_transmitter_schedule_place(EOtransmitter *p, eo_transm_scheditem_t *item, eObool_t *blocked, uint16_t *sentrops, uint16_t *remainingbytes)
+{   // it places item inside the packet. when a rop does not fit, all the following ones of its class wait so that their order is kept
+    uint16_t numberofrops = (0 == item->size) ? (eo_ropframe_ROP_NumberOf(item->ropframe)) : (1);
+    uint16_t capacity = 0;
+    uint16_t space = 0;
+    eOresult_t res = eores_NOK_generic;
+    
+    if(eobool_true == blocked[item->cls])
+    {
+        p->classstats[item->cls].carried += numberofrops;
+        return;
+    }
+    
+    if(0 == item->size)
+    {
+        res = eo_ropframe_Append(p->ropframereadytotx, item->ropframe, remainingbytes);
+    }
+    else if(NULL != item->data)
+    {
+        res = eo_ropframe_ROPdata_Add(p->ropframereadytotx, item->data, item->size, remainingbytes);
+    }
+    else
+    {
+        uint8_t *framedata = NULL;
+        uint16_t framesize = 0;
+        uint16_t framecapacity = 0;
+        eo_ropframe_Get(item->ropframe, &framedata, &framesize, &framecapacity);
+        res = eo_ropframe_ROPdata_Add(p->ropframereadytotx, framedata + sizeof(EOropframeHeader_t) + item->offset, item->size, remainingbytes);
+    }
+    
+    if(eores_OK == res)
+    {
+        item->sent = 1;
+        sentrops[item->cls] += numberofrops;
+        p->classstats[item->cls].sent += numberofrops;
+        if(NULL != item->zipinfo)
+        {
+            s_eo_transmitter_zip_commit(item->zipinfo, item->data);
+        }
+        s_eo_transmitter_confman_transmitted(p, item);
+        return;
+    }
+    
+    // a rop which does not fit even in a packet with only the largest regulars would block its class forever: we drop it
+    eo_ropframe_EffectiveCapacity_Get(p->ropframereadytotx, &capacity);
+    space = (capacity > p->maxsizeofregulars) ? (capacity - p->maxsizeofregulars) : (0);
+    if((eo_transmitter_class_regulars != item->cls) && (item->size > space))
+    {
+        item->sent = 2;
+        p->classstats[item->cls].oversized++;
+        p->lasterror_info0 = item->size;
+        p->lasterror_info1 = space;
+        p->lasterror_info2 = item->cls;
+        p->lasterror = 6;
+        s_eo_transmitter_confman_transmitted(p, item);
+        return;
+    }
+    
+    blocked[item->cls] = eobool_true;
+    p->classstats[item->cls].carried += numberofrops;
+}
+
+
+static uint16_t s_eo_transmitter_schedule_collect(EOtransmitter *p, uint16_t n, EOropframe *ropframe, eOtransmitter_class_t cls, uint32_t classkey, eObool_t late)
+{   // it adds to p->scheditems one item for every rop inside ropframe, in the order they have inside it
+    uint16_t offset = 0;
+    uint16_t size = 0;
+    uint16_t start = n;
+    uint16_t i = 0;
+    
+    if(eobool_false == eo_ropframe_IsValid(ropframe))
+    {
+        return(n);
+    }
+    
+    while(n < p->maxscheditems)
+    {
+        eo_transm_scheditem_t *item = &p->scheditems[n];
+        uint8_t priority = (uint8_t)(classkey >> 7);
+        eOprotID32_t id32 = eo_prot_ID32dummy;
+        eOprotEndpoint_t ep = eoprot_endpoint_none;
+        
+        if(0 == (size = s_eo_transmitter_schedule_ropitem(ropframe, offset, cls, item, &id32)))
+        {
+            break;
+        }
+        
+        // the priority of the endpoint is used only if higher than the one of the class and only if the class is not late
+        ep = eoprot_ID2endpoint(id32);
+        if((eobool_false == late) && (ep < eoprot_endpoints_numberof) && (p->endpointpriority[ep] < priority))
+        {
+            priority = p->endpointpriority[ep];
+        }
+        
+        item->key = (((classkey & 0x807f) | ((uint32_t)priority << 7)) << 16) | offset;
+        n++;
+        
+        offset += size;
+    }
+    
+    // the order inside the class is kept: a rop with the priority of its endpoint takes ahead also the rops before it.
+    // the priorities (bits 23-30 of the key) become not decreasing along the offsets, hence so are the keys
+    for(i=n; i>(start+1); i--)
+    {
+        uint32_t after = p->scheditems[i-1].key & 0x7f800000;
+        if(after < (p->scheditems[i-2].key & 0x7f800000))
+        {
+            p->scheditems[i-2].key = (p->scheditems[i-2].key & ~0x7f800000) | after;
+        }
+    }
+    
+    return(n);
+}
+
+
+static uint16_t s_eo_transmitter_schedule_inorder(EOtransmitter *p, const eObool_t *due, eObool_t *blocked, uint16_t *sentrops, uint16_t *remainingbytes)
+{   // the default order: the regulars, the occasionals and the replies, each in its order. it does not need p->scheditems
+    EOropframe *ropframes[eo_transmitter_classes_numberof] = {NULL, p->ropframeoccasionals, p->ropframereplies};
+    eo_transm_scheditem_t item;
+    uint16_t zipscratchused = 0;
+    uint16_t n = 0;
+    uint8_t c = 0;
+    
+    if(eobool_true == due[eo_transmitter_class_regulars])
+    {
+        if(0 != eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard))
+        {
+            memset(&item, 0, sizeof(item));
+            item.ropframe = p->ropframeregulars_standard;
+            item.cls = eo_transmitter_class_regulars;
+            s_eo_transmitter_schedule_place(p, &item, blocked, sentrops, remainingbytes);
+            n++;
+        }
+        if((NULL != p->listofregropinfo) && (0 != p->numberofregulars_cycle[p->regularscycle]))
+        {
+            EOlistIter *li = NULL;
+            for(li = eo_list_Begin(p->listofregropinfo); NULL != li; li = eo_list_Next(p->listofregropinfo, li))
+            {
+                eo_transm_regrop_info_t *info = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+                if((eo_transm_regropframe_cycled == info->regropframetype) && ((p->regularscycle % info->period) == info->phase))
+                {
+                    s_eo_transmitter_schedule_cycleditem(p, info, &item, &zipscratchused);
+                    s_eo_transmitter_schedule_place(p, &item, blocked, sentrops, remainingbytes);
+                    n++;
+                }
+            }
+        }
+    }
+    
+    for(c=eo_transmitter_class_occasionals; c<eo_transmitter_classes_numberof; c++)
+    {
+        uint16_t offset = 0;
+        uint16_t size = 0;
+        
+        if((eobool_false == due[c]) || (eobool_false == eo_ropframe_IsValid(ropframes[c])))
+        {
+            continue;
+        }
+        
+        // a rop which leaves the ropframe is removed at once, so the following one moves to its offset
+        while(0 != (size = s_eo_transmitter_schedule_ropitem(ropframes[c], offset, (eOtransmitter_class_t)c, &item, NULL)))
+        {
+            s_eo_transmitter_schedule_place(p, &item, blocked, sentrops, remainingbytes);
+            n++;
+            if(0 != item.sent)
+            {
+                eo_ropframe_ROP_Rem(ropframes[c], offset, size);
+            }
+            else
+            {
+                offset += size;
+            }
+        }
+    }
+    
+    return(n);
+}
+
+
+static uint16_t s_eo_transmitter_schedule(EOtransmitter *p, const eObool_t *due, eOabstime_t now, uint16_t *sentrops)
+{   // it is called with the mutexes of the due classes taken
+    uint32_t classkey[eo_transmitter_classes_numberof] = {0};
+    eObool_t late[eo_transmitter_classes_numberof] = {eobool_false};
+    eObool_t blocked[eo_transmitter_classes_numberof] = {eobool_false};
+    uint16_t remainingbytes = 0;
+    uint16_t zipscratchused = 0;
+    uint16_t n = 0;
+    uint16_t i = 0;
+    uint16_t j = 0;
+    uint8_t c = 0;
+    eOabstime_t placed = 0;
+    
+    if(NULL == p->scheditems)
+    {   // the default order has not been changed
+        n = s_eo_transmitter_schedule_inorder(p, due, blocked, sentrops, &remainingbytes);
+    }
+    else
+    {
+        // 1. the key of every class is 16 bits: bit 15 is 0 for the late classes, which are ordered by age, then there
+        //    are 8 bits of priority (or of age rank for the late) and in the lower bits the class itself. the key of an 
+        //    item is the key of its class followed by the 16 bits of its offset.
+        for(c=0; c<eo_transmitter_classes_numberof; c++)
+        {
+            eOabstime_t since = p->classqueuedsince[c];
+            if((0 != p->classcfg[c].deadline) && (0 != since) && ((now - since) >= p->classcfg[c].deadline))
+            {
+                late[c] = eobool_true;
+            }
+        }
+        for(c=0; c<eo_transmitter_classes_numberof; c++)
+        {
+            if(eobool_true == late[c])
+            {   // the rank amongst the late classes: the older goes first
+                uint8_t rank = 0;
+                uint8_t k = 0;
+                for(k=0; k<eo_transmitter_classes_numberof; k++)
+                {
+                    if((eobool_true == late[k]) && ((p->classqueuedsince[k] < p->classqueuedsince[c]) || ((p->classqueuedsince[k] == p->classqueuedsince[c]) && (k < c))))
+                    {
+                        rank++;
+                    }
+                }
+                classkey[c] = ((uint32_t)rank << 7) | c;
+            }
+            else
+            {
+                classkey[c] = 0x8000 | ((uint32_t)p->classcfg[c].priority << 7) | c;
+            }
+        }
+    
+        // 2. the items: the regulars as whole ropframes, the occasionals and the replies rop by rop
+        if(eobool_true == due[eo_transmitter_class_regulars])
+        {   // the standard as a whole ropframe and then the cycled of the current cycle, which stay in their ropframe
+            if(0 != eo_ropframe_ROP_NumberOf(p->ropframeregulars_standard))
+            {
+                p->scheditems[n].key = (classkey[eo_transmitter_class_regulars] << 16);
+                p->scheditems[n].offset = 0;
+                p->scheditems[n].size = 0;
+                p->scheditems[n].ropframe = p->ropframeregulars_standard;
+                p->scheditems[n].data = NULL;
+                p->scheditems[n].zipinfo = NULL;
+                p->scheditems[n].cls = eo_transmitter_class_regulars;
+                p->scheditems[n].sent = 0;
+                n++;
+            }
+            if((NULL != p->listofregropinfo) && (0 != p->numberofregulars_cycle[p->regularscycle]))
+            {
+                EOlistIter *li = NULL;
+                for(li = eo_list_Begin(p->listofregropinfo); NULL != li; li = eo_list_Next(p->listofregropinfo, li))
+                {
+                    eo_transm_regrop_info_t *info = (eo_transm_regrop_info_t*) eo_list_At(p->listofregropinfo, li);
+                    if((eo_transm_regropframe_cycled == info->regropframetype) && ((p->regularscycle % info->period) == info->phase) && (n < p->maxscheditems))
+                    {
+                        s_eo_transmitter_schedule_cycleditem(p, info, &p->scheditems[n], &zipscratchused);
+                        p->scheditems[n].key |= (classkey[eo_transmitter_class_regulars] << 16);
+                        n++;
+                    }
+                }
+            }
+        }
+        if(eobool_true == due[eo_transmitter_class_occasionals])
+        {
+            n = s_eo_transmitter_schedule_collect(p, n, p->ropframeoccasionals, eo_transmitter_class_occasionals, classkey[eo_transmitter_class_occasionals], late[eo_transmitter_class_occasionals]);
+        }
+        if(eobool_true == due[eo_transmitter_class_replies])
+        {
+            n = s_eo_transmitter_schedule_collect(p, n, p->ropframereplies, eo_transmitter_class_replies, classkey[eo_transmitter_class_replies], late[eo_transmitter_class_replies]);
+        }
+    
+        // 3. the order of transmission: a stable insertion sort on the key. the items are few and almost always in order
+        for(i=0; i<n; i++)
+        {
+            uint16_t item = i;
+            for(j=i; (j>0) && (p->scheditems[p->schedorder[j-1]].key > p->scheditems[item].key); j--)
+            {
+                p->schedorder[j] = p->schedorder[j-1];
+            }
+            p->schedorder[j] = item;
+        }
+    
+        // 4. we fill the packet
+        for(i=0; i<n; i++)
+        {
+            s_eo_transmitter_schedule_place(p, &p->scheditems[p->schedorder[i]], blocked, sentrops, &remainingbytes);
+        }
+    
+        // 5. we remove the sent and the dropped rops from occasionals and replies. we go backwards so that the offsets stay valid
+        for(i=n; i>0; i--)
+        {
+            eo_transm_scheditem_t *item = &p->scheditems[i-1];
+            if((0 != item->sent) && (eo_transmitter_class_regulars != item->cls))
+            {
+                eo_ropframe_ROP_Rem(item->ropframe, item->offset, item->size);
+            }
+        }
+    }
+    
+    // 6. the statistics of the delays, up to when the rops are inside the packet
+    placed = eov_sys_LifeTimeGet(eov_sys_GetHandle());
+    for(c=0; c<eo_transmitter_classes_numberof; c++)
+    {
+        eOtransmitter_classstats_t *stats = &p->classstats[c];
+        
+        if((0 == sentrops[c]) || (0 == p->classqueuedsince[c]))
+        {
+            continue;
+        }
+        
+        {
+            uint32_t delay = (uint32_t)(placed - p->classqueuedsince[c]);
+            stats->numberofdelays++;
+            stats->sumofdelays += delay;
+            if(delay > stats->maxdelay)
+            {
+                stats->maxdelay = delay;
+            }
+            if((0 != p->classcfg[c].deadline) && (delay > p->classcfg[c].deadline))
+            {
+                stats->deadlinemisses++;
+            }
+        }
+        
+        if(eobool_false == blocked[c])
+        {   // nothing is left
+            p->classqueuedsince[c] = 0;
+        }
+        else if(eo_transmitter_class_regulars != c)
+        {   // we dont know when the rops left were queued: we use now, which is a lower bound
+            p->classqueuedsince[c] = now;
+        }
+    }
+    
+    return(n);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -53,7 +53,12 @@ extern "C" {
 
 
 // - public #define  --------------------------------------------------------------------------------------------------
-// empty-section
+
+// masks for the field mask of eOtransmitter_regcycle_rule_t
+#define eo_transmitter_regcycle_mask_endpoint   0xff000000
+#define eo_transmitter_regcycle_mask_entity     0xffff0000
+#define eo_transmitter_regcycle_mask_index      0xffffff00
+#define eo_transmitter_regcycle_mask_id32       0xffffffff
   
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
@@ -101,6 +106,103 @@ typedef struct
     uint8_t     numberofregulars;
     uint8_t     numberofreplies;    
 } eOtransmitter_ropsnumber_t;
+
+
+enum { eo_transmitter_regcycles_max = 8, eo_transmitter_regcycle_maxrules = 16 };
+
+enum { eo_transmitter_regcycle_phase_auto = 0xff };
+
+
+/** @typedef    typedef struct eOtransmitter_regcycle_rule_t
+    @brief      tells how often a regular rop is sent. the regular rops are transmitted in cycles numbered from 0 to 
+                eo_transmitter_regcycles_max-1: a rop with a given period and phase is inside the packets of the cycles 
+                c for which (c % period) == phase. a rop uses the first rule for which (id32 & mask) == (rule.id32 & mask),
+                or period 1 if no rule matches.
+ **/
+typedef struct
+{
+    eOprotID32_t    id32;
+    uint32_t        mask;       /**< use eo_transmitter_regcycle_mask_endpoint, ... or any other mask */
+    uint8_t         period;     /**< 1, 2, 4 or eo_transmitter_regcycles_max. other values use the next of these */
+    uint8_t         phase;      /**< lower than period or eo_transmitter_regcycle_phase_auto to use the cycle with fewer bytes */
+    uint8_t         filler[2];
+} eOtransmitter_regcycle_rule_t;
+
+
+typedef struct
+{
+    eOprotID32_t    id32;
+    uint16_t        size;       /**< bytes of the rop */
+    uint8_t         period;
+    uint8_t         phase;
+} eOtransmitter_regrop_schedule_t;
+
+
+typedef struct
+{
+    uint16_t        bytes;      /**< bytes of the regular rops inside the packet of this cycle */
+    uint8_t         rops;
+    uint8_t         fillratio;  /**< bytes in percentage of the capacity for the regulars */
+} eOtransmitter_regcycle_fill_t;
+
+
+enum { eo_transmitter_regzip_maxrules = 8 };
+
+/** @typedef    typedef struct eOtransmitter_regzip_rule_t
+    @brief      tells which regular sig<> are sent as sigz<>, whose data field is compressed as in eOropzip_t. a rop 
+                uses the first rule for which (id32 & mask) == (rule.id32 & mask). the receiver must know eo_ropcode_sigz,
+                thus the rules are typically given for the endpoints of a host which has declared so.
+ **/
+typedef struct
+{
+    eOprotID32_t    id32;
+    uint32_t        mask;           /**< use eo_transmitter_regcycle_mask_endpoint, ... or any other mask */
+    uint16_t        arrayoffset;    /**< the position of an EOarray inside the variable of which only the used items are sent, or EOK_uint16dummy */
+    uint8_t         keyframeperiod; /**< if 0 there are no deltas. else every keyframeperiod rops one is the full value (or array) and the others are xor-deltas */
+    uint8_t         filler[1];
+} eOtransmitter_regzip_rule_t;
+
+
+/** @typedef    typedef enum eOtransmitter_class_t
+    @brief      the classes of rops which eo_transmitter_outpacket_Prepare() places inside the packet
+ **/
+typedef enum
+{
+    eo_transmitter_class_regulars       = 0,
+    eo_transmitter_class_occasionals    = 1,
+    eo_transmitter_class_replies        = 2
+} eOtransmitter_class_t;
+
+enum { eo_transmitter_classes_numberof = 3 };
+
+
+/** @typedef    typedef struct eOtransmitter_classcfg_t
+    @brief      how eo_transmitter_outpacket_Prepare() schedules a class. the packet is filled with the classes whose 
+                oldest rop has waited more than its deadline, oldest first, and then with the others in order of priority.
+                a rop which does not fit stays queued for the following packet together with all the later rops of its 
+                class, so that the order of the rops of a class is kept. a rop which does not fit even beside the largest
+                regulars would block its class forever, so it is dropped and eo_transmitter_lasterror_Get() gives 6 with 
+                its size, the space left by the regulars and its class.
+ **/
+typedef struct
+{
+    uint8_t     priority;       /**< 0 is the highest */
+    uint8_t     filler[3];
+    uint32_t    deadline;       /**< in usec, the max time a rop should be queued. 0 means no deadline */
+} eOtransmitter_classcfg_t;
+
+
+typedef struct
+{
+    uint32_t    sent;           /**< rops placed inside a packet */
+    uint32_t    carried;        /**< rops which did not fit inside a packet and were kept for the following one (counted every time) */
+    uint32_t    dropped;        /**< rops which could not be queued because the ropframe of the class was full */
+    uint32_t    oversized;      /**< rops which were removed from the queue because they never fit beside the regulars */
+    uint32_t    deadlinemisses; /**< packets which contained rops of the class queued for more than its deadline */
+    uint32_t    maxdelay;       /**< in usec, the max time from the queueing of the oldest rop to its transmission */
+    uint32_t    numberofdelays; 
+    uint64_t    sumofdelays;    /**< in usec. sumofdelays / numberofdelays is the average delay */
+} eOtransmitter_classstats_t;
     
 // - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
 
@@ -152,6 +254,26 @@ extern eOresult_t eo_transmitter_outpacket_Get(EOtransmitter *p, EOpacket **outp
 
 extern eOresult_t eo_transmitter_TXdecimation_Set(EOtransmitter *p, uint8_t repliesTXdecimation, uint8_t regularsTXdecimation, uint8_t occasionalsTXdecimation);
 
+/** @fn         extern eOresult_t eo_transmitter_Scheduling_Set(EOtransmitter *p, eOtransmitter_class_t cls, const eOtransmitter_classcfg_t *cfg)
+    @brief      sets priority and deadline of a class of rops. by default regulars, occasionals and replies have priority 
+                0, 1, 2 and no deadline, which is the order used by eo_transmitter_outpacket_Prepare() in the past.
+                the first call allocates the items which order the rops of a packet.
+    @return     eores_OK or eores_NOK_nullpointer or eores_NOK_generic if cls is not valid
+ **/
+extern eOresult_t eo_transmitter_Scheduling_Set(EOtransmitter *p, eOtransmitter_class_t cls, const eOtransmitter_classcfg_t *cfg);
+
+/** @fn         extern eOresult_t eo_transmitter_Scheduling_EndpointPriority_Set(EOtransmitter *p, eOprotEndpoint_t ep, uint8_t priority)
+    @brief      gives a priority to the occasionals and replies of an endpoint, which use the higher between it and the 
+                priority of their class. for instance, the setpoints of eoprot_endpoint_motioncontrol with priority 0 
+                are placed in the packet before the other classes. the order inside a class is kept, so the rops queued 
+                before them in their class go ahead together with them. use EOK_uint08dummy to remove it. as
+                eo_transmitter_Scheduling_Set(), the first call allocates the items which order the rops of a packet.
+    @return     eores_OK or eores_NOK_nullpointer or eores_NOK_generic if ep is not valid
+ **/
+extern eOresult_t eo_transmitter_Scheduling_EndpointPriority_Set(EOtransmitter *p, eOprotEndpoint_t ep, uint8_t priority);
+
+extern eOresult_t eo_transmitter_Scheduling_Stats_Get(EOtransmitter *p, eOtransmitter_class_t cls, eOtransmitter_classstats_t *stats);
+
 // the rops in regular_rops stay forever unless unloaded one by one or all cleared. at each eo_transmitter_outpacket_Prepare() they are placed 
 // inside the packet. they however need an explicit refresh of their values. 
 extern eOsizecntnr_t eo_transmitter_regular_rops_Size(EOtransmitter *p);
@@ -164,8 +286,40 @@ extern eOresult_t eo_transmitter_regular_rops_entity_Unload(EOtransmitter *p, eO
 extern eOresult_t eo_transmitter_regular_rops_Clear(EOtransmitter *p); 
 extern eOresult_t eo_transmitter_regular_rops_Refresh(EOtransmitter *p);
 
-// the rops in occasional_rops are inserted with following functions, put inside the packet with function eo_transmitter_outpacket_Get()
-// and after that they are cleared.
+/** @fn         extern eOresult_t eo_transmitter_regular_rops_Cycling_Set(EOtransmitter *p, const eOtransmitter_regcycle_rule_t *rules, uint8_t numberof, eObool_t skipemptycycles)
+    @brief      sets the rules which decide the period and phase of every regular rop loaded afterwards. by default 
+                the joints and motors of motion control with index lower than 6 are sent in the even cycles, the other 
+                joints and motors in the odd ones, and everything else in every cycle.
+    @param      rules           up to eo_transmitter_regcycle_maxrules. if NULL the default rules are used
+    @param      skipemptycycles if eobool_true the cycles without cycled rops are skipped, so that a period is the 
+                                maximum one. for instance: if there are only rops of phase 0 and period 2 they are 
+                                sent every cycle. the default rules use it.
+    @return     eores_OK or eores_NOK_busy if there are regular rops loaded, eores_NOK_generic if too many rules.
+ **/
+extern eOresult_t eo_transmitter_regular_rops_Cycling_Set(EOtransmitter *p, const eOtransmitter_regcycle_rule_t *rules, uint8_t numberof, eObool_t skipemptycycles);
+
+/** @fn         extern uint16_t eo_transmitter_regular_rops_Schedule_Get(EOtransmitter *p, eOtransmitter_regrop_schedule_t *schedule, uint16_t capacity)
+    @brief      fills schedule with period and phase of the loaded regular rops, in order of load.
+    @return     the number of items written.
+ **/
+extern uint16_t eo_transmitter_regular_rops_Schedule_Get(EOtransmitter *p, eOtransmitter_regrop_schedule_t *schedule, uint16_t capacity);
+
+/** @fn         extern eOresult_t eo_transmitter_regular_rops_Cycles_Get(EOtransmitter *p, eOtransmitter_regcycle_fill_t fill[eo_transmitter_regcycles_max])
+    @brief      tells how the regular rops fill the packet of every cycle. the rops sent in every cycle are counted in all of them.
+ **/
+extern eOresult_t eo_transmitter_regular_rops_Cycles_Get(EOtransmitter *p, eOtransmitter_regcycle_fill_t fill[eo_transmitter_regcycles_max]);
+
+/** @fn         extern eOresult_t eo_transmitter_regular_rops_Zip_Set(EOtransmitter *p, const eOtransmitter_regzip_rule_t *rules, uint8_t numberof)
+    @brief      sets the rules which decide which regular sig<> loaded afterwards are sent as sigz<>. by default there are 
+                no rules. a sigz<> is used only if smaller than the sig<>, apart the keyframes of the xor-deltas which 
+                are 4 bytes larger: the space reserved for such rops in the regulars counts them.
+    @param      rules           up to eo_transmitter_regzip_maxrules. if NULL there are no rules
+    @return     eores_OK or eores_NOK_busy if there are regular rops loaded, eores_NOK_generic if too many rules.
+ **/
+extern eOresult_t eo_transmitter_regular_rops_Zip_Set(EOtransmitter *p, const eOtransmitter_regzip_rule_t *rules, uint8_t numberof);
+
+// the rops in occasional_rops are inserted with following functions, put inside the packet with function eo_transmitter_outpacket_Prepare()
+// and after that they are removed. the ones which do not fit inside the packet stay for the following one.
 
 extern eOresult_t eo_transmitter_lasterror_Get(EOtransmitter *p, int32_t *err, int32_t *info0, int32_t *info1, int32_t *info2);
 
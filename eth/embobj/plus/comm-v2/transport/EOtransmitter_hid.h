@@ -58,12 +58,11 @@ extern "C" {
 
 typedef enum
 {
-    eo_transm_regropframe_standard  = 0,
-    eo_transm_regropframe_cycle0of  = 1,
-    eo_transm_regropframe_cycle1of  = 2
+    eo_transm_regropframe_standard  = 0,    // sent in every cycle
+    eo_transm_regropframe_cycled    = 1     // sent every period cycles
 } eo_transm_regropframe_t;
 
-typedef struct      // 40 bytes on arm .... but not 40 on a 64-bit architecture because of the pointer
+typedef struct      // 56 bytes on arm, 88 on a 64-bit architecture because of the pointers
 {
     eOropcode_t     ropcode;
     uint8_t         hasdata2update  : 1;    // use eobool_true / eobool_false
@@ -73,7 +72,15 @@ typedef struct      // 40 bytes on arm .... but not 40 on a 64-bit architecture
     uint16_t        timeoffsetinsiderop;    // if time is not present its value is 0xffff 
     EOnv            thenv;
     EOropframe*     ropframe;
-} eo_transm_regrop_info_t;   //EO_VERIFYsizeof(eo_transm_regrop_info_t, (8+28+4))
+    uint8_t         period;                 // the rop is sent in the cycles c for which (c % period) == phase
+    uint8_t         phase;
+    uint8_t         zip;                    // 1 if the rop is sent as sigz<>. it is then in the _cycled ropframe also if period is 1
+    uint8_t         zipversion;             // of the last sigz<> sent. 0 if none
+    uint16_t        ziparrayoffset;         // see eOtransmitter_regzip_rule_t
+    uint8_t         zipkeyframeperiod;
+    uint8_t         zipcountdown;           // the xor-deltas still to send before a keyframe
+    uint8_t*        zipbase;                // the value that the receiver has after the last sigz<> sent. only for the xor-deltas
+} eo_transm_regrop_info_t;   EO_VERIFYsizeof(eo_transm_regrop_info_t, (8+sizeof(EOnv)+8+2*sizeof(void*)))
 
 
 typedef struct
@@ -82,6 +89,20 @@ typedef struct
 } EOtransmitterDEBUG_t;
 
 
+typedef struct
+{
+    uint32_t        key;        // the order of transmission: lower goes first
+    uint16_t        offset;     // of the rop inside the ropframe of its class
+    uint16_t        size;       // of the rop. if 0 the item is the whole ropframe (the regulars)
+    EOropframe*     ropframe;
+    uint8_t*        data;       // if not NULL it is the rop, else the rop is inside ropframe
+    eo_transm_regrop_info_t* zipinfo;   // not NULL if the rop is a sigz<> of the regulars or the sig<> sent in place of it
+    uint8_t         cls;        // use eOtransmitter_class_t
+    uint8_t         sent;       // 0 if it stays queued, 1 if sent, 2 if dropped because it never fits
+    uint8_t         filler[2];
+} eo_transm_scheditem_t;
+
+
 /** @struct     EOtransmitter_hid
     @brief      Hidden definition. Implements private data used only internally by the 
                 public or private (static) functions of the object and protected data
@@ -93,8 +114,7 @@ struct EOtransmitter_hid
     EOpacket*                   txpacket;
     EOropframe*                 ropframereadytotx;
     EOropframe*                 ropframeregulars_standard;
-    EOropframe*                 ropframeregulars_cycle0of;  
-    EOropframe*                 ropframeregulars_cycle1of;  
+    EOropframe*                 ropframeregulars_cycled;  
     EOropframe*                 ropframeoccasionals;    
     EOropframe*                 ropframereplies;
     EOrop*                      roptmp;
@@ -104,8 +124,7 @@ struct EOtransmitter_hid
     eOipv4addr_t                ipv4addr;
     eOipv4port_t                ipv4port;
     uint8_t*                    bufferropframeregulars_standard;
-    uint8_t*                    bufferropframeregulars_cycle0of;
-    uint8_t*                    bufferropframeregulars_cycle1of;
+    uint8_t*                    bufferropframeregulars_cycled;
     uint8_t*                    bufferropframeoccasionals;
     uint8_t*                    bufferropframereplies;
     EOlist*                     listofregropinfo; 
@@ -127,11 +146,27 @@ struct EOtransmitter_hid
     uint8_t                     txdecimationregulars;
     uint8_t                     txdecimationoccasionals;
     uint16_t                    totalsizeofregulars_standard;
-    uint16_t                    totalsizeofregulars_cycle0of;
-    uint16_t                    totalsizeofregulars_cycle1of;
+    uint16_t                    totalsizeofregulars_cycle[eo_transmitter_regcycles_max];   // bytes of the cycled rops sent in each cycle
+    uint8_t                     numberofregulars_cycle[eo_transmitter_regcycles_max];
     uint16_t                    maxsizeofregulars;
     uint16_t                    effectivecapacityofregulars;
     uint64_t                    txregularsprogressive;
+    uint8_t                     regularscycle;      // the cycle used by the packet in preparation
+    uint8_t                     regcyclingskipempty;
+    uint8_t                     numberofregcyclingrules;
+    const eOtransmitter_regcycle_rule_t* regcyclingrules;   // the default ones or regcyclingrulesram
+    eOtransmitter_regcycle_rule_t* regcyclingrulesram;      // eo_transmitter_regcycle_maxrules, allocated with the first rules of the user
+    uint8_t                     numberofregziprules;
+    eOtransmitter_regzip_rule_t* regziprules;   // eo_transmitter_regzip_maxrules, allocated with the first rules
+    uint8_t*                    zipscratch;         // where the sigz<> of a packet are formed. allocated with the first rules
+    uint16_t                    zipscratchsize;
+    eOtransmitter_classcfg_t    classcfg[eo_transmitter_classes_numberof];
+    eOtransmitter_classstats_t  classstats[eo_transmitter_classes_numberof];
+    eOabstime_t                 classqueuedsince[eo_transmitter_classes_numberof];  // time of the oldest rop not yet sent, 0 if none
+    uint8_t                     endpointpriority[eoprot_endpoints_numberof];
+    eo_transm_scheditem_t*      scheditems;         // maxscheditems: the two regulars ropframes plus any rop of occasionals and replies. NULL until the default order is changed
+    uint16_t*                   schedorder;         // maxscheditems
+    uint16_t                    maxscheditems;
 }; 
 
 
@@ -0,0 +1,727 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eODeb_columnarExporter.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include "stddef.h"
+
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoMotionControl.h"
+#include "EoAnalogSensors.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_columnarExporter.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_columnarExporter_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+#define RECORD_SERIES       1
+#define RECORD_CHUNK        2
+
+#define FIELD(type, member, ftype)      { #member, (uint16_t)offsetof(type, member), ftype, (uint8_t)sizeof(((type*)0)->member) }
+
+#define INERTIAL3FIELDS(n)                                                                                          \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].id, eodeb_colfield_u8),                                      \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].typeofsensor, eodeb_colfield_u8),                            \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].status, eodeb_colfield_u8),                                  \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].timestamp, eodeb_colfield_u32),                              \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].w, eodeb_colfield_i16),                                      \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].x, eodeb_colfield_i16),                                      \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].y, eodeb_colfield_i16),                                      \
+    FIELD(eOas_inertial3_status_t, arrayofdata.data[n].z, eodeb_colfield_i16)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eODeb_columnarExporter_cfg_t eODeb_columnarExporter_cfg_default =
+{
+    EO_INIT(.maxseries)         1024,
+    EO_INIT(.rowsperchunk)      1024
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eODeb_columnarExporter_series_t * s_eodeb_columnarExporter_series_get(eODeb_columnarExporter *p, eOipv4addr_t board, const eOropdescriptor_t *rop);
+static eOresult_t s_eodeb_columnarExporter_series_write(eODeb_columnarExporter *p, eODeb_columnarExporter_series_t *series);
+static eOresult_t s_eodeb_columnarExporter_chunk_write(eODeb_columnarExporter *p, eODeb_columnarExporter_series_t *series);
+static uint32_t s_eodeb_columnarExporter_encode_timestamps(const uint64_t *timestamps, uint32_t rows, uint8_t *out);
+static uint32_t s_eodeb_columnarExporter_encode_field(const eODeb_columnarExporter_series_t *series, const eODeb_columnarExporter_field_t *field, uint8_t *shuffled, uint8_t *out);
+static uint32_t s_eodeb_columnarExporter_varint(uint64_t v, uint8_t *out);
+static uint32_t s_eodeb_columnarExporter_hash(eOipv4addr_t board, eOprotID32_t id32);
+static void s_eodeb_columnarExporter_put(uint8_t **pos, const void *data, uint32_t size);
+static void s_eodeb_columnarExporter_putstring(uint8_t **pos, const char *str);
+static eOresult_t s_eodeb_columnarExporter_raw_split(eODeb_columnarExporter_series_t *series);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint8_t s_eodeb_columnarExporter_magic[8] = { 'E', 'O', 'C', 'O', 'L', 'S', 0x00, 0x01 };
+
+static const eODeb_columnarExporter_field_t s_eodeb_columnarExporter_fields_jointstatuscore[] =
+{
+    FIELD(eOmc_joint_status_core_t, measures.meas_position, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, measures.meas_velocity, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, measures.meas_acceleration, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, measures.meas_torque, eodeb_colfield_f32),
+    FIELD(eOmc_joint_status_core_t, ofpid.generic.reference1, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, ofpid.generic.reference2, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, ofpid.generic.error1, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, ofpid.generic.error2, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, ofpid.generic.output, eodeb_colfield_i32),
+    FIELD(eOmc_joint_status_core_t, modes.controlmodestatus, eodeb_colfield_u8),
+    FIELD(eOmc_joint_status_core_t, modes.interactionmodestatus, eodeb_colfield_u8),
+    FIELD(eOmc_joint_status_core_t, modes.ismotiondone, eodeb_colfield_u8)
+};
+
+static const eODeb_columnarExporter_field_t s_eodeb_columnarExporter_fields_fttimedvalue[] =
+{
+    FIELD(eOas_ft_timedvalue_t, age, eodeb_colfield_u64),
+    FIELD(eOas_ft_timedvalue_t, info, eodeb_colfield_u32),
+    FIELD(eOas_ft_timedvalue_t, temperature, eodeb_colfield_i16),
+    FIELD(eOas_ft_timedvalue_t, values[0], eodeb_colfield_f32),
+    FIELD(eOas_ft_timedvalue_t, values[1], eodeb_colfield_f32),
+    FIELD(eOas_ft_timedvalue_t, values[2], eodeb_colfield_f32),
+    FIELD(eOas_ft_timedvalue_t, values[3], eodeb_colfield_f32),
+    FIELD(eOas_ft_timedvalue_t, values[4], eodeb_colfield_f32),
+    FIELD(eOas_ft_timedvalue_t, values[5], eodeb_colfield_f32)
+};
+
+static const eODeb_columnarExporter_field_t s_eodeb_columnarExporter_fields_inertial3status[] =
+{
+    FIELD(eOas_inertial3_status_t, arrayofdata.head.size, eodeb_colfield_u8),
+    INERTIAL3FIELDS(0),
+    INERTIAL3FIELDS(1),
+    INERTIAL3FIELDS(2),
+    INERTIAL3FIELDS(3)
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eODeb_columnarExporter * eODeb_columnarExporter_New(const eODeb_columnarExporter_cfg_t *cfg, const char *filename)
+{
+    eODeb_columnarExporter *retptr = NULL;
+
+    if(NULL == cfg)
+    {
+        cfg = &eODeb_columnarExporter_cfg_default;
+    }
+
+    if((NULL == filename) || (0 == cfg->maxseries) || (0 == cfg->rowsperchunk))
+    {
+        return(NULL);
+    }
+
+    // the buffers of the series are much bigger than what the memory pool can give, so we use the heap
+    retptr = (eODeb_columnarExporter*) calloc(1, sizeof(eODeb_columnarExporter));
+    if(NULL == retptr)
+    {
+        return(NULL);
+    }
+
+    memcpy(&retptr->cfg, cfg, sizeof(eODeb_columnarExporter_cfg_t));
+
+    // the table is a power of two at least twice maxseries so that it is never more than half full
+    retptr->tablesize = 1;
+    while(retptr->tablesize < 2*(uint32_t)cfg->maxseries)
+    {
+        retptr->tablesize <<= 1;
+    }
+
+    retptr->table = (eODeb_columnarExporter_series_t**) calloc(retptr->tablesize, sizeof(eODeb_columnarExporter_series_t*));
+    retptr->series = (eODeb_columnarExporter_series_t*) calloc(cfg->maxseries, sizeof(eODeb_columnarExporter_series_t));
+    retptr->file = fopen(filename, "wb");
+
+    if((NULL == retptr->table) || (NULL == retptr->series) || (NULL == retptr->file) ||
+       (1 != fwrite(s_eodeb_columnarExporter_magic, sizeof(s_eodeb_columnarExporter_magic), 1, retptr->file)))
+    {
+        if(NULL != retptr->file)
+        {
+            fclose(retptr->file);
+        }
+        free(retptr->series);
+        free(retptr->table);
+        free(retptr);
+        return(NULL);
+    }
+
+    retptr->stats.bytesout = sizeof(s_eodeb_columnarExporter_magic);
+
+    eODeb_columnarExporter_DescribeTag(retptr, eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, eoprot_tag_mc_joint_status_core,
+                                       s_eodeb_columnarExporter_fields_jointstatuscore, sizeof(s_eodeb_columnarExporter_fields_jointstatuscore)/sizeof(eODeb_columnarExporter_field_t));
+    eODeb_columnarExporter_DescribeTag(retptr, eoprot_endpoint_analogsensors, eoprot_entity_as_ft, eoprot_tag_as_ft_status_timedvalue,
+                                       s_eodeb_columnarExporter_fields_fttimedvalue, sizeof(s_eodeb_columnarExporter_fields_fttimedvalue)/sizeof(eODeb_columnarExporter_field_t));
+    eODeb_columnarExporter_DescribeTag(retptr, eoprot_endpoint_analogsensors, eoprot_entity_as_inertial3, eoprot_tag_as_inertial3_status,
+                                       s_eodeb_columnarExporter_fields_inertial3status, sizeof(s_eodeb_columnarExporter_fields_inertial3status)/sizeof(eODeb_columnarExporter_field_t));
+
+    return(retptr);
+}
+
+
+extern void eODeb_columnarExporter_Delete(eODeb_columnarExporter *p)
+{
+    uint16_t i = 0;
+
+    if(NULL == p)
+    {
+        return;
+    }
+
+    if(NULL == p->file)
+    {
+        return;
+    }
+
+    eODeb_columnarExporter_Flush(p);
+    fclose(p->file);
+
+    for(i=0; i<p->numberofseries; i++)
+    {
+        free(p->series[i].timestamps);
+        free(p->series[i].values);
+        free(p->series[i].raw);
+    }
+
+    free(p->scratch);
+    free(p->series);
+    free(p->table);
+
+    memset(p, 0, sizeof(eODeb_columnarExporter));
+    free(p);
+}
+
+
+extern eOresult_t eODeb_columnarExporter_DescribeTag(eODeb_columnarExporter *p, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotTag_t tag,
+                                                     const eODeb_columnarExporter_field_t *fields, uint8_t numberof)
+{
+    uint8_t i = 0;
+    eODeb_columnarExporter_tagdes_t *des = NULL;
+
+    if((NULL == p) || (NULL == fields))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(numberof > eODeb_columnarExporter_maxfields)
+    {
+        return(eores_NOK_generic);
+    }
+
+    // a new description of the same tag replaces the previous one
+    for(i=0; i<p->numberoftags; i++)
+    {
+        if((ep == p->tags[i].ep) && (entity == p->tags[i].entity) && (tag == p->tags[i].tag))
+        {
+            des = &p->tags[i];
+            break;
+        }
+    }
+
+    if(NULL == des)
+    {
+        if(p->numberoftags >= eODeb_columnarExporter_maxtags)
+        {
+            return(eores_NOK_busy);
+        }
+        des = &p->tags[p->numberoftags++];
+    }
+
+    des->ep = ep;
+    des->entity = entity;
+    des->tag = tag;
+    des->fields = fields;
+    des->numberof = numberof;
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_columnarExporter_Push(eODeb_columnarExporter *p, eOipv4addr_t board, const eOropdescriptor_t *rop, uint64_t timestamp)
+{
+    eODeb_columnarExporter_series_t *series = NULL;
+
+    if((NULL == p) || (NULL == rop))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(((eo_ropcode_say != rop->ropcode) && (eo_ropcode_sig != rop->ropcode)) || (NULL == rop->data) || (0 == rop->size))
+    {
+        p->stats.ignored++;
+        return(eores_NOK_generic);
+    }
+
+    series = s_eodeb_columnarExporter_series_get(p, board, rop);
+
+    if((NULL == series) || (series->size != rop->size))
+    {
+        p->stats.ignored++;
+        return(eores_NOK_generic);
+    }
+
+    series->timestamps[series->rows] = timestamp;
+    memcpy(&series->values[series->rows * series->size], rop->data, series->size);
+    series->rows++;
+    p->stats.rows++;
+
+    if(series->rows == p->cfg.rowsperchunk)
+    {
+        return(s_eodeb_columnarExporter_chunk_write(p, series));
+    }
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_columnarExporter_Flush(eODeb_columnarExporter *p)
+{
+    uint16_t i = 0;
+    eOresult_t res = eores_OK;
+
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    for(i=0; i<p->numberofseries; i++)
+    {
+        if((0 != p->series[i].rows) && (eores_OK != s_eodeb_columnarExporter_chunk_write(p, &p->series[i])))
+        {
+            res = eores_NOK_generic;
+        }
+    }
+
+    fflush(p->file);
+
+    return(res);
+}
+
+
+extern eOresult_t eODeb_columnarExporter_GetStats(eODeb_columnarExporter *p, eODeb_columnarExporter_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    memcpy(stats, &p->stats, sizeof(eODeb_columnarExporter_stats_t));
+
+    return(eores_OK);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint32_t s_eodeb_columnarExporter_hash(eOipv4addr_t board, eOprotID32_t id32)
+{
+    uint32_t h = (id32 ^ (board * 0x9e3779b1U)) * 2654435761U;
+    return(h ^ (h >> 16));
+}
+
+
+static eODeb_columnarExporter_series_t * s_eodeb_columnarExporter_series_get(eODeb_columnarExporter *p, eOipv4addr_t board, const eOropdescriptor_t *rop)
+{
+    uint32_t i = s_eodeb_columnarExporter_hash(board, rop->id32) & (p->tablesize - 1);
+    eODeb_columnarExporter_series_t *series = NULL;
+    eOprotEndpoint_t ep = eoprot_ID2endpoint(rop->id32);
+    eOprotEntity_t entity = eoprot_ID2entity(rop->id32);
+    eOprotTag_t tag = eoprot_ID2tag(rop->id32);
+    uint8_t t = 0;
+    uint8_t f = 0;
+
+    while(NULL != p->table[i])
+    {
+        if((board == p->table[i]->board) && (rop->id32 == p->table[i]->id32))
+        {
+            return(p->table[i]);
+        }
+        i = (i + 1) & (p->tablesize - 1);
+    }
+
+    if(p->numberofseries >= p->cfg.maxseries)
+    {
+        return(NULL);
+    }
+
+    series = &p->series[p->numberofseries];
+    series->board = board;
+    series->id32 = rop->id32;
+    series->seriesid = p->numberofseries;
+    series->size = rop->size;
+    series->rows = 0;
+    series->raw = NULL;
+    series->fields = NULL;
+    series->numberof = 0;
+
+    for(t=0; t<p->numberoftags; t++)
+    {
+        if((ep == p->tags[t].ep) && (entity == p->tags[t].entity) && (tag == p->tags[t].tag))
+        {
+            // we use the description only if all its fields are inside the variable
+            for(f=0; f<p->tags[t].numberof; f++)
+            {
+                if((p->tags[t].fields[f].offset + p->tags[t].fields[f].width) > series->size)
+                {
+                    break;
+                }
+            }
+            if(f == p->tags[t].numberof)
+            {
+                series->fields = p->tags[t].fields;
+                series->numberof = p->tags[t].numberof;
+            }
+            break;
+        }
+    }
+
+    if((NULL == series->fields) && (eores_OK != s_eodeb_columnarExporter_raw_split(series)))
+    {
+        return(NULL);
+    }
+
+    series->timestamps = (uint64_t*) malloc(sizeof(uint64_t) * p->cfg.rowsperchunk);
+    series->values = (uint8_t*) malloc((size_t)series->size * p->cfg.rowsperchunk);
+    if((NULL == series->timestamps) || (NULL == series->values) || (eores_OK != s_eodeb_columnarExporter_series_write(p, series)))
+    {
+        free(series->timestamps);
+        free(series->values);
+        free(series->raw);
+        series->timestamps = NULL;
+        series->values = NULL;
+        series->raw = NULL;
+        return(NULL);
+    }
+
+    p->table[i] = series;
+    p->numberofseries++;
+
+    return(series);
+}
+
+
+static eOresult_t s_eodeb_columnarExporter_series_write(eODeb_columnarExporter *p, eODeb_columnarExporter_series_t *series)
+{
+    // the record is at most: header (5) + fixed part (12) + name (1+255) + numberoffields (1) + fields * (4 + 1+255).
+    // the up to 255 raw columns of a variable without description have names of at most 6 chars, so they also fit.
+    uint8_t record[5 + 12 + 256 + 1 + eODeb_columnarExporter_maxfields*(4+256)];
+    uint8_t *pos = &record[5];
+    char name[256] = {0};
+    uint32_t length = 0;
+    uint8_t f = 0;
+
+    snprintf(name, sizeof(name), "%s.%s[%d].%s", eoprot_ID2stringOfEndpoint(series->id32), eoprot_ID2stringOfEntity(series->id32),
+                                                  eoprot_ID2index(series->id32), eoprot_ID2stringOfTag(series->id32));
+
+    s_eodeb_columnarExporter_put(&pos, &series->seriesid, 2);
+    s_eodeb_columnarExporter_put(&pos, &series->board, 4);
+    s_eodeb_columnarExporter_put(&pos, &series->id32, 4);
+    s_eodeb_columnarExporter_put(&pos, &series->size, 2);
+    s_eodeb_columnarExporter_putstring(&pos, name);
+    s_eodeb_columnarExporter_put(&pos, &series->numberof, 1);
+
+    for(f=0; f<series->numberof; f++)
+    {
+        s_eodeb_columnarExporter_put(&pos, &series->fields[f].type, 1);
+        s_eodeb_columnarExporter_put(&pos, &series->fields[f].offset, 2);
+        s_eodeb_columnarExporter_put(&pos, &series->fields[f].width, 1);
+        s_eodeb_columnarExporter_putstring(&pos, series->fields[f].name);
+    }
+
+    length = (uint32_t)(pos - record) - 5;
+    record[0] = RECORD_SERIES;
+    memcpy(&record[1], &length, 4);
+
+    if(1 != fwrite(record, length + 5, 1, p->file))
+    {
+        return(eores_NOK_generic);
+    }
+
+    p->stats.bytesout += length + 5;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eodeb_columnarExporter_chunk_write(eODeb_columnarExporter *p, eODeb_columnarExporter_series_t *series)
+{
+    // the scratch holds the shuffled bytes of one field followed by its encoding, or the encoding of the timestamps.
+    // a field has at most rows*255 bytes and its encoding is at most 1.5 times that. a timestamp varint is at most 10 bytes.
+    uint32_t rows = series->rows;
+    uint32_t required = 3*rows*255 + 16;
+    uint32_t length = 0;
+    uint32_t encoded = 0;
+    uint8_t header[5 + 2 + 4];
+    uint8_t *shuffled = NULL;
+    uint8_t *out = NULL;
+    uint8_t f = 0;
+    long start = 0;
+
+    if(p->scratchsize < required)
+    {
+        uint8_t *tmp = (uint8_t*) realloc(p->scratch, required);
+        if(NULL == tmp)
+        {
+            series->rows = 0;
+            return(eores_NOK_generic);
+        }
+        p->scratch = tmp;
+        p->scratchsize = required;
+    }
+
+    shuffled = p->scratch;
+    out = &p->scratch[rows*255];
+
+    // we dont know the length of the record before encoding, so we write a placeholder and we patch it later
+    start = ftell(p->file);
+
+    header[0] = RECORD_CHUNK;
+    memset(&header[1], 0, 4);
+    memcpy(&header[5], &series->seriesid, 2);
+    memcpy(&header[7], &rows, 4);
+    fwrite(header, sizeof(header), 1, p->file);
+    length = 2 + 4;
+
+    encoded = s_eodeb_columnarExporter_encode_timestamps(series->timestamps, rows, out);
+    fwrite(&encoded, 4, 1, p->file);
+    fwrite(out, encoded, 1, p->file);
+    length += 4 + encoded;
+    p->stats.bytesin += sizeof(uint64_t) * rows;
+
+    for(f=0; f<series->numberof; f++)
+    {
+        encoded = s_eodeb_columnarExporter_encode_field(series, &series->fields[f], shuffled, out);
+        fwrite(&encoded, 4, 1, p->file);
+        fwrite(out, encoded, 1, p->file);
+        length += 4 + encoded;
+        p->stats.bytesin += series->fields[f].width * rows;
+    }
+
+    fseek(p->file, start + 1, SEEK_SET);
+    fwrite(&length, 4, 1, p->file);
+    fseek(p->file, 0, SEEK_END);
+
+    p->stats.bytesout += length + 5;
+    p->stats.chunks++;
+
+    series->rows = 0;
+
+    return((0 == ferror(p->file)) ? (eores_OK) : (eores_NOK_generic));
+}
+
+
+static uint32_t s_eodeb_columnarExporter_encode_timestamps(const uint64_t *timestamps, uint32_t rows, uint8_t *out)
+{
+    uint32_t size = 0;
+    uint32_t r = 0;
+    uint64_t prev = 0;
+    int64_t delta = 0;
+
+    for(r=0; r<rows; r++)
+    {
+        delta = (int64_t)(timestamps[r] - prev);
+        prev = timestamps[r];
+        // zig-zag so that small negative deltas are also small
+        size += s_eodeb_columnarExporter_varint(((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63), &out[size]);
+    }
+
+    return(size);
+}
+
+
+static uint32_t s_eodeb_columnarExporter_encode_field(const eODeb_columnarExporter_series_t *series, const eODeb_columnarExporter_field_t *field, uint8_t *shuffled, uint8_t *out)
+{
+    const uint32_t rows = series->rows;
+    const uint8_t *v = &series->values[field->offset];
+    uint32_t total = rows * field->width;
+    uint32_t size = 0;
+    uint32_t run = 0;
+    uint32_t r = 0;
+    uint32_t i = 0;
+    uint8_t b = 0;
+
+    // xor vs previous row and shuffle: byte b of row r goes in position b*rows + r
+    for(b=0; b<field->width; b++)
+    {
+        shuffled[b*rows] = v[b];
+        for(r=1; r<rows; r++)
+        {
+            shuffled[b*rows + r] = v[r*series->size + b] ^ v[(r-1)*series->size + b];
+        }
+    }
+
+    // run length of zeros
+    for(i=0; i<total; i++)
+    {
+        if(0 == shuffled[i])
+        {
+            run++;
+            continue;
+        }
+        if(0 != run)
+        {
+            out[size++] = 0;
+            size += s_eodeb_columnarExporter_varint(run, &out[size]);
+            run = 0;
+        }
+        out[size++] = shuffled[i];
+    }
+
+    if(0 != run)
+    {
+        out[size++] = 0;
+        size += s_eodeb_columnarExporter_varint(run, &out[size]);
+    }
+
+    return(size);
+}
+
+
+static uint32_t s_eodeb_columnarExporter_varint(uint64_t v, uint8_t *out)
+{
+    uint32_t size = 0;
+
+    while(v >= 0x80)
+    {
+        out[size++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[size++] = (uint8_t)v;
+
+    return(size);
+}
+
+
+static void s_eodeb_columnarExporter_put(uint8_t **pos, const void *data, uint32_t size)
+{
+    memcpy(*pos, data, size);
+    *pos += size;
+}
+
+
+static void s_eodeb_columnarExporter_putstring(uint8_t **pos, const char *str)
+{
+    size_t len = strlen(str);
+    uint8_t l = (len > 255) ? (255) : ((uint8_t)len);
+
+    s_eodeb_columnarExporter_put(pos, &l, 1);
+    s_eodeb_columnarExporter_put(pos, str, l);
+}
+
+
+static eOresult_t s_eodeb_columnarExporter_raw_split(eODeb_columnarExporter_series_t *series)
+{
+    // a column is at most 255 bytes wide, so a variable without description is split in columns raw0, raw1, etc.
+    // if it fits in one column, it is simply raw. the names are kept just after the fields.
+    const uint32_t numberof = (series->size + 254) / 255;
+    char *names = NULL;
+    uint32_t c = 0;
+
+    if(numberof > 255)
+    {
+        return(eores_NOK_generic);
+    }
+
+    series->raw = (eODeb_columnarExporter_field_t*) calloc(numberof, sizeof(eODeb_columnarExporter_field_t) + 8);
+    if(NULL == series->raw)
+    {
+        return(eores_NOK_generic);
+    }
+
+    names = (char*) &series->raw[numberof];
+
+    for(c=0; c<numberof; c++)
+    {
+        if(1 == numberof)
+        {
+            snprintf(&names[8*c], 8, "raw");
+        }
+        else
+        {
+            snprintf(&names[8*c], 8, "raw%u", (unsigned)c);
+        }
+        series->raw[c].name = &names[8*c];
+        series->raw[c].offset = (uint16_t)(255*c);
+        series->raw[c].type = eodeb_colfield_bytes;
+        series->raw[c].width = (uint8_t)(((series->size - 255*c) > 255) ? (255) : (series->size - 255*c));
+    }
+
+    series->fields = series->raw;
+    series->numberof = (uint8_t)numberof;
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_COLUMNAREXPORTER_H_
+#define _EODEB_COLUMNAREXPORTER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eODeb_columnarExporter.h
+    @brief      export of the values of say/sig ROPs in a columnar, chunked and compressed file
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eodeb_columnarexporter Object eODeb_columnarExporter
+    The eODeb_columnarExporter receives say/sig ROPs (e.g., from the cbk_onNVfound of eODeb_eoProtoParser or from
+    the receive path of the host) and stores their values in a series for every couple (board, ID32). A series has
+    one column for the timestamps and one column for every field of the variable. The fields of the variables
+    eoprot_tag_mc_joint_status_core, eoprot_tag_as_ft_status_timedvalue and eoprot_tag_as_inertial3_status are
+    built in, others can be described with eODeb_columnarExporter_DescribeTag(), and all the rest are exported as
+    columns of raw bytes: one named raw if the variable is at most 255 bytes, otherwise raw0, raw1, etc. of 255 bytes
+    each but the last one. The file is read back by eODeb_columnarReader.
+
+    Every series keeps its rows in memory and writes them as a chunk when rowsperchunk rows are collected, so that
+    the cost of Push() is a copy and the cost of encoding is amortised over a chunk.
+
+    The file is little endian and is formed by:
+    - the 8 bytes of magic "EOCOLS" 0x00 0x01
+    - a sequence of records, each one with a header of type (1 byte) and length of the body (4 bytes):
+      - type 1, series descriptor: seriesid (2), ipv4addr (4), id32 (4), sizeofvariable (2), name (1 + n),
+        numberoffields (1) and for every field: type (1), offset (2), width (1), name (1 + n).
+        the name of the series is endpoint.entity[index].tag as given by the EoProtocol strings.
+      - type 2, chunk: seriesid (2), numberofrows (4), then the timestamp column and one column for every field,
+        each one as encodedsize (4) + encoded bytes.
+    - the timestamp column is zig-zag varint of the delta from the previous timestamp (the first vs 0).
+    - a field column is obtained by XOR of every value with the one of the previous row (the first vs 0), then the
+      bytes are shuffled so that byte k of all rows are contiguous, and then runs of zero bytes are coded as
+      0x00 + varint(length) while every other byte is literal.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoProtocol.h"
+#include "EOrop.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eODeb_columnarExporter_maxfields        32
+#define eODeb_columnarExporter_maxtags          32
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eODeb_columnarExporter_hid eODeb_columnarExporter;
+
+
+typedef enum
+{
+    eodeb_colfield_u8       = 0,
+    eodeb_colfield_i8       = 1,
+    eodeb_colfield_u16      = 2,
+    eodeb_colfield_i16      = 3,
+    eodeb_colfield_u32      = 4,
+    eodeb_colfield_i32      = 5,
+    eodeb_colfield_u64      = 6,
+    eodeb_colfield_i64      = 7,
+    eodeb_colfield_f32      = 8,
+    eodeb_colfield_f64      = 9,
+    eodeb_colfield_bytes    = 10
+} eODeb_columnarExporter_fieldtype_t;
+
+
+typedef struct
+{
+    const char      *name;
+    uint16_t        offset;     /**< offset of the field inside the variable */
+    uint8_t         type;       /**< use eODeb_columnarExporter_fieldtype_t */
+    uint8_t         width;      /**< in bytes */
+} eODeb_columnarExporter_field_t;
+
+
+typedef struct
+{
+    uint16_t        maxseries;      /**< max number of couples (board, ID32) */
+    uint16_t        rowsperchunk;   /**< rows of a series which are written together */
+} eODeb_columnarExporter_cfg_t;
+
+
+typedef struct
+{
+    uint64_t        rows;           /**< rows pushed */
+    uint64_t        ignored;        /**< rops which are not say/sig or which do not fit in a new series */
+    uint64_t        chunks;
+    uint64_t        bytesin;        /**< bytes of timestamps and values which were encoded */
+    uint64_t        bytesout;       /**< bytes written in the file */
+} eODeb_columnarExporter_stats_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eODeb_columnarExporter_cfg_t eODeb_columnarExporter_cfg_default; // = { 1024, 1024 };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eODeb_columnarExporter * eODeb_columnarExporter_New(const eODeb_columnarExporter_cfg_t *cfg, const char *filename)
+    @brief      creates the exporter and the file, which is overwritten if it exists.
+    @return     the object or NULL if the file cannot be created.
+ **/
+extern eODeb_columnarExporter * eODeb_columnarExporter_New(const eODeb_columnarExporter_cfg_t *cfg, const char *filename);
+
+/** @fn         extern void eODeb_columnarExporter_Delete(eODeb_columnarExporter *p)
+    @brief      writes the rows not yet written, closes the file and releases the object.
+ **/
+extern void eODeb_columnarExporter_Delete(eODeb_columnarExporter *p);
+
+/** @fn         extern eOresult_t eODeb_columnarExporter_DescribeTag(eODeb_columnarExporter *p, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotTag_t tag, const eODeb_columnarExporter_field_t *fields, uint8_t numberof)
+    @brief      describes the fields of the variables of a given tag. it must be called before the first Push() of
+                such variables. the fields array is not copied, thus it must be kept in scope.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_busy if there is no room for more descriptions.
+ **/
+extern eOresult_t eODeb_columnarExporter_DescribeTag(eODeb_columnarExporter *p, eOprotEndpoint_t ep, eOprotEntity_t entity, eOprotTag_t tag,
+                                                     const eODeb_columnarExporter_field_t *fields, uint8_t numberof);
+
+/** @fn         extern eOresult_t eODeb_columnarExporter_Push(eODeb_columnarExporter *p, eOipv4addr_t board, const eOropdescriptor_t *rop, uint64_t timestamp)
+    @brief      adds a row with the value of the rop. only say and sig rops are exported.
+    @param      timestamp   the time of the row in usec. if the rop has plustime it is wise to use rop->time.
+    @return     eores_OK, eores_NOK_nullpointer or eores_NOK_generic if the rop is ignored.
+ **/
+extern eOresult_t eODeb_columnarExporter_Push(eODeb_columnarExporter *p, eOipv4addr_t board, const eOropdescriptor_t *rop, uint64_t timestamp);
+
+/** @fn         extern eOresult_t eODeb_columnarExporter_Flush(eODeb_columnarExporter *p)
+    @brief      writes the rows collected so far in every series, even if they are less than rowsperchunk.
+ **/
+extern eOresult_t eODeb_columnarExporter_Flush(eODeb_columnarExporter *p);
+
+extern eOresult_t eODeb_columnarExporter_GetStats(eODeb_columnarExporter *p, eODeb_columnarExporter_stats_t *stats);
+
+
+/** @}
+    end of group eodeb_columnarexporter
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_COLUMNAREXPORTER_HID_H_
+#define _EODEB_COLUMNAREXPORTER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eODeb_columnarExporter_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "stdio.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eODeb_columnarExporter.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    eOprotEndpoint_t                        ep;
+    eOprotEntity_t                          entity;
+    eOprotTag_t                             tag;
+    const eODeb_columnarExporter_field_t    *fields;
+    uint8_t                                 numberof;
+} eODeb_columnarExporter_tagdes_t;
+
+
+typedef struct
+{
+    eOipv4addr_t                            board;
+    eOprotID32_t                            id32;
+    uint16_t                                seriesid;
+    uint16_t                                size;       // the size of the variable: every row has it
+    const eODeb_columnarExporter_field_t    *fields;
+    uint8_t                                 numberof;
+    eODeb_columnarExporter_field_t          *raw;       // if there is no description: columns of at most 255 bytes
+    uint32_t                                rows;
+    uint64_t                                *timestamps;
+    uint8_t                                 *values;    // rowsperchunk * size, row major
+} eODeb_columnarExporter_series_t;
+
+
+struct eODeb_columnarExporter_hid
+{
+    eODeb_columnarExporter_cfg_t            cfg;
+    FILE                                    *file;
+    eODeb_columnarExporter_tagdes_t         tags[eODeb_columnarExporter_maxtags];
+    uint8_t                                 numberoftags;
+    eODeb_columnarExporter_series_t         **table;    // open addressing on (board, id32), tablesize entries
+    uint32_t                                tablesize;
+    eODeb_columnarExporter_series_t         *series;    // maxseries entries, in order of creation
+    uint16_t                                numberofseries;
+    uint8_t                                 *scratch;   // used to encode a column
+    uint32_t                                scratchsize;
+    eODeb_columnarExporter_stats_t          stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
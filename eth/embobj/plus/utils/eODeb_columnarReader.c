@@ -0,0 +1,522 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eODeb_columnarReader.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_columnarReader.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_columnarReader_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// they must be the same as in eODeb_columnarExporter.c
+#define RECORD_SERIES       1
+#define RECORD_CHUNK        2
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    const uint8_t   *pos;
+    const uint8_t   *end;
+} eODeb_columnarReader_cursor_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eodeb_columnarReader_series_read(eODeb_columnarReader *p, uint32_t length);
+static eOresult_t s_eodeb_columnarReader_chunk_read(eODeb_columnarReader *p, uint32_t length, eODeb_columnarReader_chunk_t *chunk);
+static eOresult_t s_eodeb_columnarReader_decode_timestamps(eODeb_columnarReader_cursor_t *cur, uint32_t rows, uint64_t *timestamps);
+static eOresult_t s_eodeb_columnarReader_decode_field(eODeb_columnarReader *p, eODeb_columnarReader_cursor_t *cur, const eODeb_columnarReader_series_t *series,
+                                                      const eODeb_columnarExporter_field_t *field, uint32_t rows);
+static eObool_t s_eodeb_columnarReader_varint(eODeb_columnarReader_cursor_t *cur, uint64_t *v);
+static eObool_t s_eodeb_columnarReader_get(eODeb_columnarReader_cursor_t *cur, void *data, uint32_t size);
+static eObool_t s_eodeb_columnarReader_getstring(eODeb_columnarReader_cursor_t *cur, char **strings);
+static eObool_t s_eodeb_columnarReader_reserve(void **buffer, uint32_t *capacity, uint32_t required);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static const uint8_t s_eodeb_columnarReader_magic[8] = { 'E', 'O', 'C', 'O', 'L', 'S', 0x00, 0x01 };
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eODeb_columnarReader * eODeb_columnarReader_New(const char *filename)
+{
+    eODeb_columnarReader *retptr = NULL;
+    uint8_t magic[8] = {0};
+
+    if(NULL == filename)
+    {
+        return(NULL);
+    }
+
+    retptr = (eODeb_columnarReader*) calloc(1, sizeof(eODeb_columnarReader));
+    if(NULL == retptr)
+    {
+        return(NULL);
+    }
+
+    retptr->file = fopen(filename, "rb");
+
+    if((NULL == retptr->file) || (1 != fread(magic, sizeof(magic), 1, retptr->file)) ||
+       (0 != memcmp(magic, s_eodeb_columnarReader_magic, sizeof(magic))))
+    {
+        if(NULL != retptr->file)
+        {
+            fclose(retptr->file);
+        }
+        free(retptr);
+        return(NULL);
+    }
+
+    return(retptr);
+}
+
+
+extern void eODeb_columnarReader_Delete(eODeb_columnarReader *p)
+{
+    uint32_t i = 0;
+
+    if(NULL == p)
+    {
+        return;
+    }
+
+    fclose(p->file);
+
+    for(i=0; i<p->numberofseries; i++)
+    {
+        free(p->series[i].fields);
+        free(p->series[i].strings);
+    }
+
+    free(p->series);
+    free(p->record);
+    free(p->shuffled);
+    free(p->timestamps);
+    free(p->values);
+
+    memset(p, 0, sizeof(eODeb_columnarReader));
+    free(p);
+}
+
+
+extern eOresult_t eODeb_columnarReader_Next(eODeb_columnarReader *p, eODeb_columnarReader_chunk_t *chunk)
+{
+    uint8_t header[5] = {0};
+    uint32_t length = 0;
+    size_t n = 0;
+    eOresult_t res = eores_OK;
+
+    if((NULL == p) || (NULL == chunk))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    for(;;)
+    {
+        n = fread(header, 1, sizeof(header), p->file);
+        if(0 == n)
+        {
+            return((0 != feof(p->file)) ? (eores_NOK_nodata) : (eores_NOK_generic));
+        }
+        if(sizeof(header) != n)
+        {
+            return(eores_NOK_generic);
+        }
+
+        memcpy(&length, &header[1], 4);
+
+        if((eobool_false == s_eodeb_columnarReader_reserve((void**)&p->record, &p->recordsize, length)) ||
+           ((0 != length) && (1 != fread(p->record, length, 1, p->file))))
+        {
+            return(eores_NOK_generic);
+        }
+
+        if(RECORD_SERIES == header[0])
+        {
+            res = s_eodeb_columnarReader_series_read(p, length);
+            if(eores_OK != res)
+            {
+                return(res);
+            }
+        }
+        else if(RECORD_CHUNK == header[0])
+        {
+            return(s_eodeb_columnarReader_chunk_read(p, length, chunk));
+        }
+        // else: a record of a later version of the format, which we skip
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eodeb_columnarReader_series_read(eODeb_columnarReader *p, uint32_t length)
+{
+    eODeb_columnarReader_cursor_t cur = { p->record, p->record + length };
+    eODeb_columnarReader_series_t des = {0};
+    eODeb_columnarExporter_field_t *fields = NULL;
+    eODeb_columnarReader_seriesdes_t *tmp = NULL;
+    char *strings = NULL;
+    char *s = NULL;
+    uint8_t f = 0;
+
+    // the strings are not longer than the record, because each one loses its length and gains its terminator
+    strings = (char*) malloc(length + 1);
+    s = strings;
+
+    if((NULL == strings) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &des.seriesid, 2)) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &des.board, 4)) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &des.id32, 4)) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &des.size, 2)) ||
+       (eobool_false == s_eodeb_columnarReader_getstring(&cur, &s)) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &des.numberof, 1)))
+    {
+        free(strings);
+        return(eores_NOK_generic);
+    }
+
+    des.name = strings;
+
+    fields = (eODeb_columnarExporter_field_t*) calloc((0 == des.numberof) ? (1) : (des.numberof), sizeof(eODeb_columnarExporter_field_t));
+    if(NULL == fields)
+    {
+        free(strings);
+        return(eores_NOK_generic);
+    }
+
+    for(f=0; f<des.numberof; f++)
+    {
+        fields[f].name = s;
+        if((eobool_false == s_eodeb_columnarReader_get(&cur, &fields[f].type, 1)) ||
+           (eobool_false == s_eodeb_columnarReader_get(&cur, &fields[f].offset, 2)) ||
+           (eobool_false == s_eodeb_columnarReader_get(&cur, &fields[f].width, 1)) ||
+           (eobool_false == s_eodeb_columnarReader_getstring(&cur, &s)) ||
+           (((uint32_t)fields[f].offset + fields[f].width) > des.size))
+        {
+            free(fields);
+            free(strings);
+            return(eores_NOK_generic);
+        }
+    }
+
+    // the exporter gives the seriesid in order of creation, so the table grows by one at a time
+    if(des.seriesid >= p->numberofseries)
+    {
+        tmp = (eODeb_columnarReader_seriesdes_t*) realloc(p->series, (des.seriesid + 1) * sizeof(eODeb_columnarReader_seriesdes_t));
+        if(NULL == tmp)
+        {
+            free(fields);
+            free(strings);
+            return(eores_NOK_generic);
+        }
+        memset(&tmp[p->numberofseries], 0, (des.seriesid + 1 - p->numberofseries) * sizeof(eODeb_columnarReader_seriesdes_t));
+        p->series = tmp;
+        p->numberofseries = des.seriesid + 1;
+    }
+
+    free(p->series[des.seriesid].fields);
+    free(p->series[des.seriesid].strings);
+
+    des.fields = fields;
+    p->series[des.seriesid].des = des;
+    p->series[des.seriesid].fields = fields;
+    p->series[des.seriesid].strings = strings;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eodeb_columnarReader_chunk_read(eODeb_columnarReader *p, uint32_t length, eODeb_columnarReader_chunk_t *chunk)
+{
+    eODeb_columnarReader_cursor_t cur = { p->record, p->record + length };
+    const eODeb_columnarReader_series_t *series = NULL;
+    uint16_t seriesid = 0;
+    uint32_t rows = 0;
+    uint8_t f = 0;
+
+    if((eobool_false == s_eodeb_columnarReader_get(&cur, &seriesid, 2)) ||
+       (eobool_false == s_eodeb_columnarReader_get(&cur, &rows, 4)) ||
+       (seriesid >= p->numberofseries) || (NULL == p->series[seriesid].strings))
+    {
+        return(eores_NOK_generic);
+    }
+
+    series = &p->series[seriesid].des;
+
+    // every row takes at least one byte in the column of the timestamps, so there cannot be more rows than bytes
+    if((0 == rows) || (rows > length) || (((uint64_t)rows * ((series->size > 255) ? (series->size) : (255))) > 0xffffffff) ||
+       (eobool_false == s_eodeb_columnarReader_reserve((void**)&p->timestamps, &p->timestampssize, rows * sizeof(uint64_t))) ||
+       (eobool_false == s_eodeb_columnarReader_reserve((void**)&p->values, &p->valuessize, rows * series->size)) ||
+       (eobool_false == s_eodeb_columnarReader_reserve((void**)&p->shuffled, &p->shuffledsize, rows * 255)))
+    {
+        return(eores_NOK_generic);
+    }
+
+    if(eores_OK != s_eodeb_columnarReader_decode_timestamps(&cur, rows, p->timestamps))
+    {
+        return(eores_NOK_generic);
+    }
+
+    memset(p->values, 0, rows * series->size);
+
+    for(f=0; f<series->numberof; f++)
+    {
+        if(eores_OK != s_eodeb_columnarReader_decode_field(p, &cur, series, &series->fields[f], rows))
+        {
+            return(eores_NOK_generic);
+        }
+    }
+
+    chunk->series = series;
+    chunk->rows = rows;
+    chunk->timestamps = p->timestamps;
+    chunk->values = p->values;
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eodeb_columnarReader_decode_timestamps(eODeb_columnarReader_cursor_t *cur, uint32_t rows, uint64_t *timestamps)
+{
+    eODeb_columnarReader_cursor_t col = {0};
+    uint32_t encoded = 0;
+    uint64_t prev = 0;
+    uint64_t v = 0;
+    uint32_t r = 0;
+
+    if((eobool_false == s_eodeb_columnarReader_get(cur, &encoded, 4)) || (encoded > (uint32_t)(cur->end - cur->pos)))
+    {
+        return(eores_NOK_generic);
+    }
+
+    col.pos = cur->pos;
+    col.end = cur->pos + encoded;
+    cur->pos += encoded;
+
+    for(r=0; r<rows; r++)
+    {
+        if(eobool_false == s_eodeb_columnarReader_varint(&col, &v))
+        {
+            return(eores_NOK_generic);
+        }
+        // undo the zig-zag of the delta
+        prev += (v >> 1) ^ (0 - (v & 1));
+        timestamps[r] = prev;
+    }
+
+    return((col.pos == col.end) ? (eores_OK) : (eores_NOK_generic));
+}
+
+
+static eOresult_t s_eodeb_columnarReader_decode_field(eODeb_columnarReader *p, eODeb_columnarReader_cursor_t *cur, const eODeb_columnarReader_series_t *series,
+                                                      const eODeb_columnarExporter_field_t *field, uint32_t rows)
+{
+    eODeb_columnarReader_cursor_t col = {0};
+    uint8_t *v = &p->values[field->offset];
+    uint32_t total = rows * field->width;
+    uint32_t encoded = 0;
+    uint64_t run = 0;
+    uint32_t i = 0;
+    uint32_t r = 0;
+    uint8_t b = 0;
+
+    if((eobool_false == s_eodeb_columnarReader_get(cur, &encoded, 4)) || (encoded > (uint32_t)(cur->end - cur->pos)))
+    {
+        return(eores_NOK_generic);
+    }
+
+    col.pos = cur->pos;
+    col.end = cur->pos + encoded;
+    cur->pos += encoded;
+
+    // runs of zeros are 0x00 + varint(length), every other byte is literal
+    while(col.pos < col.end)
+    {
+        b = *col.pos++;
+        if(0 != b)
+        {
+            if(i >= total)
+            {
+                return(eores_NOK_generic);
+            }
+            p->shuffled[i++] = b;
+            continue;
+        }
+        if((eobool_false == s_eodeb_columnarReader_varint(&col, &run)) || (run > (total - i)))
+        {
+            return(eores_NOK_generic);
+        }
+        memset(&p->shuffled[i], 0, (size_t)run);
+        i += (uint32_t)run;
+    }
+
+    if(i != total)
+    {
+        return(eores_NOK_generic);
+    }
+
+    // unshuffle and undo the xor vs the previous row: byte b of row r is in position b*rows + r
+    for(b=0; b<field->width; b++)
+    {
+        v[b] = p->shuffled[b*rows];
+        for(r=1; r<rows; r++)
+        {
+            v[r*series->size + b] = p->shuffled[b*rows + r] ^ v[(r-1)*series->size + b];
+        }
+    }
+
+    return(eores_OK);
+}
+
+
+static eObool_t s_eodeb_columnarReader_varint(eODeb_columnarReader_cursor_t *cur, uint64_t *v)
+{
+    uint8_t shift = 0;
+    uint8_t b = 0;
+
+    *v = 0;
+
+    do
+    {
+        if((cur->pos >= cur->end) || (shift > 63))
+        {
+            return(eobool_false);
+        }
+        b = *cur->pos++;
+        *v |= (uint64_t)(b & 0x7f) << shift;
+        shift += 7;
+    } while(0 != (b & 0x80));
+
+    return(eobool_true);
+}
+
+
+static eObool_t s_eodeb_columnarReader_get(eODeb_columnarReader_cursor_t *cur, void *data, uint32_t size)
+{
+    if(size > (uint32_t)(cur->end - cur->pos))
+    {
+        return(eobool_false);
+    }
+
+    memcpy(data, cur->pos, size);
+    cur->pos += size;
+
+    return(eobool_true);
+}
+
+
+static eObool_t s_eodeb_columnarReader_getstring(eODeb_columnarReader_cursor_t *cur, char **strings)
+{
+    uint8_t l = 0;
+
+    if((eobool_false == s_eodeb_columnarReader_get(cur, &l, 1)) || (eobool_false == s_eodeb_columnarReader_get(cur, *strings, l)))
+    {
+        return(eobool_false);
+    }
+
+    (*strings)[l] = 0;
+    *strings += l + 1;
+
+    return(eobool_true);
+}
+
+
+static eObool_t s_eodeb_columnarReader_reserve(void **buffer, uint32_t *capacity, uint32_t required)
+{
+    void *tmp = NULL;
+
+    if(*capacity >= required)
+    {
+        return(eobool_true);
+    }
+
+    tmp = realloc(*buffer, required);
+    if(NULL == tmp)
+    {
+        return(eobool_false);
+    }
+
+    *buffer = tmp;
+    *capacity = required;
+
+    return(eobool_true);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
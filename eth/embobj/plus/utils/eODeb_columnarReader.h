@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_COLUMNARREADER_H_
+#define _EODEB_COLUMNARREADER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eODeb_columnarReader.h
+    @brief      reading of the files written by eODeb_columnarExporter
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eodeb_columnarreader Object eODeb_columnarReader
+    The eODeb_columnarReader reads the file of an eODeb_columnarExporter one chunk at a time. It decodes the columns
+    of a chunk and it puts back every field at its offset inside the variable, so that a row is the value of the
+    variable as it was pushed, with zero in the bytes which are not inside any field.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "eODeb_columnarExporter.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eODeb_columnarReader_hid eODeb_columnarReader;
+
+
+typedef struct
+{
+    eOipv4addr_t                            board;
+    eOprotID32_t                            id32;
+    uint16_t                                seriesid;
+    uint16_t                                size;       /**< the size of the variable */
+    const char                              *name;      /**< endpoint.entity[index].tag */
+    const eODeb_columnarExporter_field_t    *fields;
+    uint8_t                                 numberof;
+} eODeb_columnarReader_series_t;
+
+
+typedef struct
+{
+    const eODeb_columnarReader_series_t     *series;
+    uint32_t                                rows;
+    const uint64_t                          *timestamps;    /**< rows entries */
+    const uint8_t                           *values;        /**< rows * series->size bytes, row major */
+} eODeb_columnarReader_chunk_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eODeb_columnarReader * eODeb_columnarReader_New(const char *filename)
+    @brief      opens the file.
+    @return     the object or NULL if the file cannot be opened or it is not written by eODeb_columnarExporter.
+ **/
+extern eODeb_columnarReader * eODeb_columnarReader_New(const char *filename);
+
+extern void eODeb_columnarReader_Delete(eODeb_columnarReader *p);
+
+/** @fn         extern eOresult_t eODeb_columnarReader_Next(eODeb_columnarReader *p, eODeb_columnarReader_chunk_t *chunk)
+    @brief      reads the next chunk of the file. the descriptors of the series are read on the way. the memory
+                pointed by chunk stays valid until the next call.
+    @return     eores_OK, eores_NOK_nodata at the end of the file, eores_NOK_nullpointer or eores_NOK_generic if the
+                file is truncated or corrupted.
+ **/
+extern eOresult_t eODeb_columnarReader_Next(eODeb_columnarReader *p, eODeb_columnarReader_chunk_t *chunk);
+
+
+/** @}
+    end of group eodeb_columnarreader
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
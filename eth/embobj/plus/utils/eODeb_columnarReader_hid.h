@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_COLUMNARREADER_HID_H_
+#define _EODEB_COLUMNARREADER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eODeb_columnarReader_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "stdio.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eODeb_columnarReader.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    eODeb_columnarReader_series_t           des;
+    eODeb_columnarExporter_field_t          *fields;
+    char                                    *strings;   // the name of the series and of its fields, zero terminated
+} eODeb_columnarReader_seriesdes_t;
+
+
+struct eODeb_columnarReader_hid
+{
+    FILE                                    *file;
+    eODeb_columnarReader_seriesdes_t        *series;    // indexed by seriesid, numberofseries entries
+    uint32_t                                numberofseries;
+    uint8_t                                 *record;    // the body of the record being decoded
+    uint32_t                                recordsize;
+    uint8_t                                 *shuffled;  // the bytes of one column before the xor is undone
+    uint32_t                                shuffledsize;
+    uint64_t                                *timestamps;
+    uint32_t                                timestampssize;
+    uint8_t                                 *values;
+    uint32_t                                valuessize;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
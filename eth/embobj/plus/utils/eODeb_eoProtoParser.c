@@ -33,6 +33,14 @@
 #include "EOropframe_hid.h"
 #include "EOrop_hid.h"
 
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -53,6 +61,19 @@
 // --------------------------------------------------------------------------------------------------------------------
 #define ROPFRAME_HEADER_SIZE        sizeof(EOropframeHeader_t)
 #define ROP_HEADER_SIZE             sizeof(eOrophead_t)
+#define ROPFRAME_FOOTER_SIZE        sizeof(EOropframeFooter_t)
+
+// libpcap file format: global header of 24 bytes, then every record has a header of 16 bytes followed by the frame
+#define PCAP_GLOBALHEADER_SIZE      24
+#define PCAP_RECORDHEADER_SIZE      16
+#define PCAP_MAGIC_USEC             0xa1b2c3d4
+#define PCAP_MAGIC_USEC_SWAPPED     0xd4c3b2a1
+#define PCAP_MAGIC_NSEC             0xa1b23c4d
+#define PCAP_MAGIC_NSEC_SWAPPED     0x4d3cb2a1
+#define PCAP_LINKTYPE_ETHERNET      1
+
+// the smallest frame which can contain a udp datagram: ethernet + ip + udp headers
+#define FRAME_MINSIZE               (14 + 20 + 8)
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -65,7 +86,15 @@
 // --------------------------------------------------------------------------------------------------------------------
 // - typedef with internal scope
 // --------------------------------------------------------------------------------------------------------------------
-// empty-section
+
+typedef struct
+{
+    const uint8_t           *capture;       // the whole capture file
+    eObool_t                swapped;
+    size_t                  begin;          // offset of the first record of the chunk
+    size_t                  end;            // offset past the last record of the chunk
+    eODeb_eoProtoParser     *parser;        // the instance which dissects the chunk
+} eodeb_eoProtoParser_chunk_t;
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -76,6 +105,12 @@ static uint8_t s_eodeb_eoProtoParser_NVisrequired(eODeb_eoProtoParser *p, eOprot
 static uint8_t s_eodeb_eoProtoParser_CheckSeqnum(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr, 
                                                 uint32_t *rec_seqnum, uint32_t *expeted_seqnum);
 static uint8_t s_eodeb_eoProtoParser_isvalidropframe(uint8_t *payload, uint32_t size);
+static void s_eodeb_eoProtoParser_prepare(eODeb_eoProtoParser *p, const eODeb_eoProtoParser_cfg_t *cfg);
+static uint32_t s_eodeb_eoProtoParser_hash(uint32_t key);
+static eODeb_eoProtoParser_source_t * s_eodeb_eoProtoParser_source_get(eODeb_eoProtoParser *p, uint32_t addr, eObool_t *isnew);
+static void s_eodeb_eoProtoParser_seqnumerror(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr, uint32_t rec_seqnum, uint32_t expeted_seqnum);
+static uint32_t s_eodeb_eoProtoParser_u32(const uint8_t *data, eObool_t swapped);
+static void * s_eodeb_eoProtoParser_chunk_dissect(void *arg);
 //static eOresult_t s_eodeb_eoProtoParser_DumpNV(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr);
 
 
@@ -103,12 +138,61 @@ extern eODeb_eoProtoParser * eODeb_eoProtoParser_Initialise(const eODeb_eoProtoP
         return(NULL);
     }
     
-    memcpy(&s_debParser_singleton.cfg, cfg, sizeof(eODeb_eoProtoParser_cfg_t));
+    s_eodeb_eoProtoParser_prepare(&s_debParser_singleton, cfg);
     s_debParser_singleton.initted = 1;
     
     return(&s_debParser_singleton);
 }
 
+
+extern eODeb_eoProtoParser * eODeb_eoProtoParser_New(const eODeb_eoProtoParser_cfg_t *cfg)
+{
+    eODeb_eoProtoParser *retptr = NULL;
+
+    if(NULL == cfg)
+    {
+        return(NULL);
+    }
+
+    // the object is big enough that we don't want it in the memory pool which the transceivers use
+    retptr = (eODeb_eoProtoParser*) calloc(1, sizeof(eODeb_eoProtoParser));
+    if(NULL == retptr)
+    {
+        return(NULL);
+    }
+
+    s_eodeb_eoProtoParser_prepare(retptr, cfg);
+    retptr->initted = 1;
+
+    return(retptr);
+}
+
+
+extern void eODeb_eoProtoParser_Delete(eODeb_eoProtoParser *p)
+{
+    if((NULL == p) || (&s_debParser_singleton == p))
+    {
+        return;
+    }
+
+    free(p->deferred);
+    memset(p, 0, sizeof(eODeb_eoProtoParser));
+    free(p);
+}
+
+
+extern eOresult_t eODeb_eoProtoParser_GetStats(eODeb_eoProtoParser *p, eODeb_eoProtoParser_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    memcpy(stats, &p->stats, sizeof(eODeb_eoProtoParser_stats_t));
+
+    return(eores_OK);
+}
+
 extern eODeb_eoProtoParser * eODeb_eoProtoParser_GetHandle(void)
 {
     return( (s_debParser_singleton.initted == 1)? &s_debParser_singleton : NULL);
@@ -124,9 +208,12 @@ extern eOresult_t eODeb_eoProtoParser_RopFrameDissect(eODeb_eoProtoParser *p, eO
         return(eores_NOK_nullpointer);
     }
 
+    p->stats.packets++;
+
     //1) verify if i received a valid ropframe
     if(!(s_eodeb_eoProtoParser_isvalidropframe(pktInfo_ptr->payload_ptr, pktInfo_ptr->size)))
     {
+        p->stats.invalidropframes++;
         if(p->cfg.checks.invalidRopFrame.cbk != NULL)
         {
             p->cfg.checks.invalidRopFrame.cbk(pktInfo_ptr);
@@ -139,7 +226,7 @@ extern eOresult_t eODeb_eoProtoParser_RopFrameDissect(eODeb_eoProtoParser *p, eO
     {
         if(!s_eodeb_eoProtoParser_CheckSeqnum(p, pktInfo_ptr, &rec_seqnum, &expeted_seqnum))
         {
-            p->cfg.checks.seqNum.cbk_onErrSeqNum(pktInfo_ptr, rec_seqnum, expeted_seqnum);
+            s_eodeb_eoProtoParser_seqnumerror(p, pktInfo_ptr, rec_seqnum, expeted_seqnum);
         }
     }
     
@@ -158,6 +245,253 @@ extern eOresult_t eODeb_eoProtoParser_RopFrameDissect(eODeb_eoProtoParser *p, eO
 
 
 
+extern eOresult_t eODeb_eoProtoParser_CaptureDissect(const eODeb_eoProtoParser_cfg_t *cfg, const char *capturefile, uint8_t numberofthreads, eODeb_eoProtoParser_stats_t *stats)
+{
+    eodeb_eoProtoParser_chunk_t chunks[eODeb_eoProtoParser_maxThreads] = {0};
+    eODeb_eoProtoParser *merger = NULL;
+    const uint8_t *capture = NULL;
+    size_t capturesize = 0;
+    size_t offset = 0;
+    size_t chunksize = 0;
+    eObool_t swapped = eobool_false;
+    uint32_t magic = 0;
+    uint8_t n = 0;
+    uint8_t i = 0;
+    uint16_t j = 0;
+    uint32_t k = 0;
+    eOresult_t res = eores_OK;
+
+    if((NULL == cfg) || (NULL == capturefile))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(0 == numberofthreads)
+    {
+        numberofthreads = 1;
+    }
+    if(numberofthreads > eODeb_eoProtoParser_maxThreads)
+    {
+        numberofthreads = eODeb_eoProtoParser_maxThreads;
+    }
+
+    // 1. we get the whole capture in memory: mapped if we can, else read
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    {
+        struct stat st;
+        int fd = open(capturefile, O_RDONLY);
+        if(fd < 0)
+        {
+            return(eores_NOK_nodata);
+        }
+        if((0 != fstat(fd, &st)) || (st.st_size < PCAP_GLOBALHEADER_SIZE))
+        {
+            close(fd);
+            return(eores_NOK_unsupported);
+        }
+        capturesize = (size_t)st.st_size;
+        capture = (const uint8_t*) mmap(NULL, capturesize, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if(MAP_FAILED == (void*)capture)
+        {
+            return(eores_NOK_nodata);
+        }
+        madvise((void*)capture, capturesize, MADV_SEQUENTIAL);
+    }
+#else
+    {
+        long size = 0;
+        FILE *file = fopen(capturefile, "rb");
+        if(NULL == file)
+        {
+            return(eores_NOK_nodata);
+        }
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        if((size < PCAP_GLOBALHEADER_SIZE) || (NULL == (capture = (const uint8_t*) malloc((size_t)size))) ||
+           (1 != fread((void*)capture, (size_t)size, 1, file)))
+        {
+            free((void*)capture);
+            fclose(file);
+            return(eores_NOK_unsupported);
+        }
+        fclose(file);
+        capturesize = (size_t)size;
+    }
+#endif
+
+    magic = s_eodeb_eoProtoParser_u32(capture, eobool_false);
+    if((PCAP_MAGIC_USEC == magic) || (PCAP_MAGIC_NSEC == magic))
+    {
+        swapped = eobool_false;
+    }
+    else if((PCAP_MAGIC_USEC_SWAPPED == magic) || (PCAP_MAGIC_NSEC_SWAPPED == magic))
+    {
+        swapped = eobool_true;
+    }
+    else
+    {
+        res = eores_NOK_unsupported;
+    }
+
+    if((eores_OK == res) && (PCAP_LINKTYPE_ETHERNET != s_eodeb_eoProtoParser_u32(&capture[20], swapped)))
+    {
+        res = eores_NOK_unsupported;
+    }
+
+    // the low level parser is a singleton and it is used read-only by the workers
+    if((eores_OK == res) && (NULL == eo_ethLowLevParser_GetHandle()))
+    {
+        eOethLowLevParser_cfg_t llcfg = {0};
+        eo_ethLowLevParser_Initialise(&llcfg);
+    }
+
+    // 2. we split the capture in chunks of about the same size. we walk only the record headers, so it is quick.
+    if(eores_OK == res)
+    {
+        chunksize = (capturesize - PCAP_GLOBALHEADER_SIZE) / numberofthreads;
+        offset = PCAP_GLOBALHEADER_SIZE;
+        chunks[0].begin = offset;
+
+        while((offset + PCAP_RECORDHEADER_SIZE) <= capturesize)
+        {
+            offset += PCAP_RECORDHEADER_SIZE + s_eodeb_eoProtoParser_u32(&capture[offset+8], swapped);
+
+            if(((n+1) < numberofthreads) && ((offset - PCAP_GLOBALHEADER_SIZE) >= (n+1)*chunksize) && (offset < capturesize))
+            {
+                chunks[n].end = offset;
+                n++;
+                chunks[n].begin = offset;
+            }
+        }
+        chunks[n].end = (offset > capturesize) ? (capturesize) : (offset);
+        n++;
+    }
+
+    // 3. every chunk has its own parser instance, which defers the errors in sequence number
+    for(i=0; (eores_OK == res) && (i<n); i++)
+    {
+        chunks[i].capture = capture;
+        chunks[i].swapped = swapped;
+        if(NULL == (chunks[i].parser = eODeb_eoProtoParser_New(cfg)))
+        {
+            res = eores_NOK_generic;
+            break;
+        }
+        chunks[i].parser->deferseqnumerrors = eobool_true;
+    }
+
+    if(eores_OK == res)
+    {
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+        pthread_t threads[eODeb_eoProtoParser_maxThreads];
+        eObool_t started[eODeb_eoProtoParser_maxThreads] = {0};
+        for(i=1; i<n; i++)
+        {
+            started[i] = (0 == pthread_create(&threads[i], NULL, s_eodeb_eoProtoParser_chunk_dissect, &chunks[i])) ? eobool_true : eobool_false;
+        }
+        s_eodeb_eoProtoParser_chunk_dissect(&chunks[0]);
+        for(i=1; i<n; i++)
+        {
+            if(eobool_true == started[i])
+            {
+                pthread_join(threads[i], NULL);
+            }
+            else
+            {
+                s_eodeb_eoProtoParser_chunk_dissect(&chunks[i]);
+            }
+        }
+#else
+        for(i=0; i<n; i++)
+        {
+            s_eodeb_eoProtoParser_chunk_dissect(&chunks[i]);
+        }
+#endif
+    }
+
+    // 4. we merge the chunks in order. the merger keeps the last sequence number of every source, so that we can check
+    //    the first packet of a source in a chunk vs the last one in the previous chunks. then we emit the errors found
+    //    inside the chunk.
+    if(eores_OK == res)
+    {
+        merger = eODeb_eoProtoParser_New(cfg);
+    }
+
+    if(NULL != merger)
+    {
+        for(i=0; i<n; i++)
+        {
+            eODeb_eoProtoParser *w = chunks[i].parser;
+
+            for(j=0; j<eODeb_eoProtoParser_hashsizeSources; j++)
+            {
+                eODeb_eoProtoParser_source_t *ws = &w->sources[j];
+                eODeb_eoProtoParser_source_t *ms = NULL;
+                eObool_t isnew = eobool_false;
+
+                if(0 == ws->used)
+                {
+                    continue;
+                }
+
+                ms = s_eodeb_eoProtoParser_source_get(merger, ws->addr, &isnew);
+                if(NULL == ms)
+                {
+                    continue;
+                }
+
+                if((eobool_false == isnew) && (ws->firstseqnum != (ms->currseqnum+1)))
+                {
+                    merger->stats.seqnumerrors++;
+                    if(NULL != cfg->checks.seqNum.cbk_onErrSeqNum)
+                    {
+                        cfg->checks.seqNum.cbk_onErrSeqNum(&ws->firstpkt, ws->firstseqnum, ms->currseqnum+1);
+                    }
+                }
+                ms->currseqnum = ws->currseqnum;
+            }
+
+            for(k=0; k<w->deferredsize; k++)
+            {
+                if(NULL != cfg->checks.seqNum.cbk_onErrSeqNum)
+                {
+                    cfg->checks.seqNum.cbk_onErrSeqNum(&w->deferred[k].pkt, w->deferred[k].rec_seqnum, w->deferred[k].exp_seqnum);
+                }
+            }
+
+            merger->stats.packets += w->stats.packets;
+            merger->stats.discarded += w->stats.discarded;
+            merger->stats.invalidropframes += w->stats.invalidropframes;
+            merger->stats.seqnumerrors += w->stats.seqnumerrors;
+            merger->stats.nvfound += w->stats.nvfound;
+        }
+
+        if(NULL != stats)
+        {
+            memcpy(stats, &merger->stats, sizeof(eODeb_eoProtoParser_stats_t));
+        }
+
+        eODeb_eoProtoParser_Delete(merger);
+    }
+
+    for(i=0; i<n; i++)
+    {
+        eODeb_eoProtoParser_Delete(chunks[i].parser);
+    }
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    munmap((void*)capture, capturesize);
+#else
+    free((void*)capture);
+#endif
+
+    return(res);
+}
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 // - definition of extern hidden functions 
 // --------------------------------------------------------------------------------------------------------------------
@@ -170,7 +504,14 @@ extern eOresult_t eODeb_eoProtoParser_RopFrameDissect(eODeb_eoProtoParser *p, eO
 static uint8_t s_eodeb_eoProtoParser_isvalidropframe(uint8_t *payload, uint32_t size)
 {
     EOropframeHeader_t *ropframeHdr = (EOropframeHeader_t *)payload;
-    uint32_t footer =*((uint32_t*)(&payload[size-4]));
+    uint32_t footer = 0;
+
+    if((NULL == payload) || (size < (ROPFRAME_HEADER_SIZE + ROPFRAME_FOOTER_SIZE)))
+    {
+        return(0);
+    }
+
+    footer =*((uint32_t*)(&payload[size-4]));
     if((ropframeHdr->startofframe == 0x12345678) && (footer == 0x87654321))
     {
         return(1);
@@ -253,6 +594,7 @@ static eOresult_t s_eodeb_eoProtoParser_CheckNV(eODeb_eoProtoParser *p, eOethLow
 			ropAddInfo.time = time;
                         ropAddInfo.seqnum = ropframeheader->sequencenumber;
 
+			p->stats.nvfound++;
 			p->cfg.checks.nv.cbk_onNVfound(pktInfo_ptr, &ropAddInfo);
 		}
 
@@ -268,64 +610,217 @@ static eOresult_t s_eodeb_eoProtoParser_CheckNV(eODeb_eoProtoParser *p, eOethLow
 
 static uint8_t s_eodeb_eoProtoParser_NVisrequired(eODeb_eoProtoParser *p, eOprotID32_t id32)
 {
-    uint8_t i, max;
-    eODeb_eoProtoParser_nv_identify_t *id;
-    
-    max = p->cfg.checks.nv.NVs2searchArray.head.size;
-    
-    for(i=0; i<max; i++)
+    // p->nvs is an open addressing hash set filled by s_eodeb_eoProtoParser_prepare() with the NVs2searchArray.
+    // it is never more than half full, thus we always find either the id32 or an empty slot.
+    uint32_t i = s_eodeb_eoProtoParser_hash(id32) & (eODeb_eoProtoParser_hashsizeNVs - 1);
+
+    while(1 == p->nvs[i].used)
     {
-        id  = (eODeb_eoProtoParser_nv_identify_t *)eo_array_At((EOarray*)&p->cfg.checks.nv.NVs2searchArray, i);
-        if(id->id32 == id32)
+        if(p->nvs[i].id32 == id32)
         {
             return(1);
         }
+        i = (i + 1) & (eODeb_eoProtoParser_hashsizeNVs - 1);
     }
+
     return(0);
 }
 
 
 static uint8_t s_eodeb_eoProtoParser_CheckSeqnum(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr, uint32_t *rec_seqnum, uint32_t *expeted_seqnum)
 {
-    static uint8_t isfirstframe = 1;
-    static uint32_t curr_seqNum; //current sequence number
+    eObool_t isfirstframe = eobool_false;
+    eODeb_eoProtoParser_source_t *source = NULL;
     
     EOropframeHeader_t *ropframeHdr = (EOropframeHeader_t *)pktInfo_ptr->payload_ptr;
     uint32_t *u32ptr =  (uint32_t*)&ropframeHdr->sequencenumber;
     *rec_seqnum = *u32ptr;
 
+    // every source has its own sequence
+    source = s_eodeb_eoProtoParser_source_get(p, pktInfo_ptr->src_addr, &isfirstframe);
+    if(NULL == source)
+    {
+        // too many sources: we dont check
+        *expeted_seqnum = *rec_seqnum;
+        return(1);
+    }
 
     //if it is first pkt received i save start seqNum (initialized curr_seqNum with received seqnum)
-    if(isfirstframe)
+    if(eobool_true == isfirstframe)
     {
-        curr_seqNum = *rec_seqnum;
-        *expeted_seqnum = curr_seqNum;
-        isfirstframe = 0;
+        source->currseqnum = *rec_seqnum;
+        source->firstseqnum = *rec_seqnum;
+        memcpy(&source->firstpkt, pktInfo_ptr, sizeof(eOethLowLevParser_packetInfo_t));
+        *expeted_seqnum = source->currseqnum;
         return(1);
     }
     
     //calculate expected seqnum
-    *expeted_seqnum = curr_seqNum+1;
+    *expeted_seqnum = source->currseqnum+1;
     
     
     if(*expeted_seqnum == *rec_seqnum)
     {
-        curr_seqNum = *expeted_seqnum;
+        source->currseqnum = *expeted_seqnum;
         return(1);
     }
 
     //if i'm here i lost a packt or packets arrived not in order.
     
-    if(*rec_seqnum != curr_seqNum)
+    if(*rec_seqnum != source->currseqnum)
     {
         //i lost a pkt, so i restart with received seqnum
-        curr_seqNum = *rec_seqnum;
+        source->currseqnum = *rec_seqnum;
     }
     
     return(0);
 }
 
 
+static void s_eodeb_eoProtoParser_prepare(eODeb_eoProtoParser *p, const eODeb_eoProtoParser_cfg_t *cfg)
+{
+    uint8_t i, max;
+    uint32_t h;
+    eODeb_eoProtoParser_nv_identify_t *id;
+
+    free(p->deferred);
+    memset(p, 0, sizeof(eODeb_eoProtoParser));
+    memcpy(&p->cfg, cfg, sizeof(eODeb_eoProtoParser_cfg_t));
+
+    max = p->cfg.checks.nv.NVs2searchArray.head.size;
+    if(max > eODeb_eoProtoParser_maxNV2find)
+    {
+        max = eODeb_eoProtoParser_maxNV2find;
+    }
+
+    for(i=0; i<max; i++)
+    {
+        id = (eODeb_eoProtoParser_nv_identify_t *)eo_array_At((EOarray*)&p->cfg.checks.nv.NVs2searchArray, i);
+        if(1 == s_eodeb_eoProtoParser_NVisrequired(p, id->id32))
+        {
+            continue;
+        }
+        h = s_eodeb_eoProtoParser_hash(id->id32) & (eODeb_eoProtoParser_hashsizeNVs - 1);
+        while(1 == p->nvs[h].used)
+        {
+            h = (h + 1) & (eODeb_eoProtoParser_hashsizeNVs - 1);
+        }
+        p->nvs[h].id32 = id->id32;
+        p->nvs[h].used = 1;
+    }
+}
+
+
+static uint32_t s_eodeb_eoProtoParser_hash(uint32_t key)
+{
+    // fibonacci hashing: the high bits are the best mixed, so we fold them down
+    key *= 2654435761U;
+    return(key ^ (key >> 16));
+}
+
+
+static eODeb_eoProtoParser_source_t * s_eodeb_eoProtoParser_source_get(eODeb_eoProtoParser *p, uint32_t addr, eObool_t *isnew)
+{
+    uint32_t i = s_eodeb_eoProtoParser_hash(addr) & (eODeb_eoProtoParser_hashsizeSources - 1);
+
+    *isnew = eobool_false;
+
+    while(1 == p->sources[i].used)
+    {
+        if(p->sources[i].addr == addr)
+        {
+            return(&p->sources[i]);
+        }
+        i = (i + 1) & (eODeb_eoProtoParser_hashsizeSources - 1);
+    }
+
+    if(p->numberofsources >= eODeb_eoProtoParser_maxSources)
+    {
+        return(NULL);
+    }
+
+    p->numberofsources++;
+    p->sources[i].used = 1;
+    p->sources[i].addr = addr;
+    *isnew = eobool_true;
+
+    return(&p->sources[i]);
+}
+
+
+static void s_eodeb_eoProtoParser_seqnumerror(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr, uint32_t rec_seqnum, uint32_t expeted_seqnum)
+{
+    p->stats.seqnumerrors++;
+
+    if(eobool_false == p->deferseqnumerrors)
+    {
+        p->cfg.checks.seqNum.cbk_onErrSeqNum(pktInfo_ptr, rec_seqnum, expeted_seqnum);
+        return;
+    }
+
+    if(p->deferredsize == p->deferredcapacity)
+    {
+        uint32_t capacity = (0 == p->deferredcapacity) ? (64) : (2*p->deferredcapacity);
+        eODeb_eoProtoParser_seqnumerror_t *tmp = (eODeb_eoProtoParser_seqnumerror_t*) realloc(p->deferred, capacity*sizeof(eODeb_eoProtoParser_seqnumerror_t));
+        if(NULL == tmp)
+        {
+            return;
+        }
+        p->deferred = tmp;
+        p->deferredcapacity = capacity;
+    }
+
+    memcpy(&p->deferred[p->deferredsize].pkt, pktInfo_ptr, sizeof(eOethLowLevParser_packetInfo_t));
+    p->deferred[p->deferredsize].rec_seqnum = rec_seqnum;
+    p->deferred[p->deferredsize].exp_seqnum = expeted_seqnum;
+    p->deferredsize++;
+}
+
+
+static uint32_t s_eodeb_eoProtoParser_u32(const uint8_t *data, eObool_t swapped)
+{
+    uint32_t v = 0;
+    memcpy(&v, data, sizeof(v));
+
+    if(eobool_true == swapped)
+    {
+        v = ((v & 0xff000000) >> 24) | ((v & 0x00ff0000) >> 8) | ((v & 0x0000ff00) << 8) | ((v & 0x000000ff) << 24);
+    }
+
+    return(v);
+}
+
+
+static void * s_eodeb_eoProtoParser_chunk_dissect(void *arg)
+{
+    eodeb_eoProtoParser_chunk_t *chunk = (eodeb_eoProtoParser_chunk_t*)arg;
+    eOTheEthLowLevParser *llparser = eo_ethLowLevParser_GetHandle();
+    eOethLowLevParser_packetInfo_t pktinfo = {0};
+    size_t offset = chunk->begin;
+    uint32_t inclen = 0;
+    uint8_t *frame = NULL;
+
+    while((offset + PCAP_RECORDHEADER_SIZE) <= chunk->end)
+    {
+        inclen = s_eodeb_eoProtoParser_u32(&chunk->capture[offset+8], chunk->swapped);
+        frame = (uint8_t*)&chunk->capture[offset + PCAP_RECORDHEADER_SIZE];
+        offset += PCAP_RECORDHEADER_SIZE + inclen;
+
+        if((offset > chunk->end) || (inclen < FRAME_MINSIZE) ||
+           (eores_OK != eOTheEthLowLevParser_GetUDPdatagramPayload(llparser, frame, &pktinfo)) ||
+           ((pktinfo.payload_ptr + pktinfo.size) > (frame + inclen)))
+        {
+            chunk->parser->stats.discarded++;
+            continue;
+        }
+
+        eODeb_eoProtoParser_RopFrameDissect(chunk->parser, &pktinfo);
+    }
+
+    return(NULL);
+}
+
+
 #if 0
 static eOresult_t s_eodeb_eoProtoParser_DumpNV(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr)
 {
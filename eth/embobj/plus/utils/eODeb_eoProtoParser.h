@@ -50,6 +50,10 @@ extern "C" {
 // - public #define  --------------------------------------------------------------------------------------------------
 #define eODeb_eoProtoParser_maxNV2find     40
 
+#define eODeb_eoProtoParser_maxSources     64
+
+#define eODeb_eoProtoParser_maxThreads     32
+
 #define ALL_EP 							   0xFFFF
   
 
@@ -117,6 +121,16 @@ typedef struct
 
 
 
+typedef struct
+{
+    uint64_t            packets;            /**< packets given to the parser */
+    uint64_t            discarded;          /**< frames of a capture which do not contain a udp datagram */
+    uint64_t            invalidropframes;
+    uint64_t            seqnumerrors;
+    uint64_t            nvfound;
+} eODeb_eoProtoParser_stats_t;
+
+
 typedef struct
 {
     struct
@@ -139,6 +153,30 @@ extern eODeb_eoProtoParser * eODeb_eoProtoParser_Initialise(const eODeb_eoProtoP
 extern eODeb_eoProtoParser * eODeb_eoProtoParser_GetHandle(void);
 extern eOresult_t eODeb_eoProtoParser_RopFrameDissect(eODeb_eoProtoParser *p, eOethLowLevParser_packetInfo_t *pktInfo_ptr);
 
+/** @fn         extern eODeb_eoProtoParser * eODeb_eoProtoParser_New(const eODeb_eoProtoParser_cfg_t *cfg)
+    @brief      creates a parser instance which is independent from the singleton and from other instances, so that
+                more packets can be dissected concurrently by different threads, one instance per thread.
+                the sequence number is checked separately for every source address.
+    @return     the instance or NULL if cfg is NULL
+ **/
+extern eODeb_eoProtoParser * eODeb_eoProtoParser_New(const eODeb_eoProtoParser_cfg_t *cfg);
+
+extern void eODeb_eoProtoParser_Delete(eODeb_eoProtoParser *p);
+
+extern eOresult_t eODeb_eoProtoParser_GetStats(eODeb_eoProtoParser *p, eODeb_eoProtoParser_stats_t *stats);
+
+/** @fn         extern eOresult_t eODeb_eoProtoParser_CaptureDissect(const eODeb_eoProtoParser_cfg_t *cfg, const char *capturefile, uint8_t numberofthreads, eODeb_eoProtoParser_stats_t *stats)
+    @brief      dissects a whole capture file (libpcap format, ethernet link type). the file is memory mapped and split
+                in numberofthreads chunks on packet boundaries, which are dissected in parallel by as many instances.
+                the cbk_onNVfound is called from the worker threads, thus it must be thread safe. the cbk_onErrSeqNum
+                is instead called by the calling thread after all chunks are done, in capture order for every source,
+                with the sequence numbers checked also across chunk boundaries.
+    @param      numberofthreads     from 1 to eODeb_eoProtoParser_maxThreads. on platforms without threads it is 1.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_nodata if the file cannot be read or eores_NOK_unsupported
+                if it is not a supported capture.
+ **/
+extern eOresult_t eODeb_eoProtoParser_CaptureDissect(const eODeb_eoProtoParser_cfg_t *cfg, const char *capturefile, uint8_t numberofthreads, eODeb_eoProtoParser_stats_t *stats);
+
 
 /** @}            
     end of group  
@@ -41,7 +41,10 @@ extern "C" {
 
 
 // - #define used with hidden struct ----------------------------------------------------------------------------------
-// empty-section
+
+// sizes of the open addressing tables: they are power of two and at least twice the max number of items
+#define eODeb_eoProtoParser_hashsizeNVs         128
+#define eODeb_eoProtoParser_hashsizeSources     128
 
 
 // - definition of the hidden struct implementing the object ----------------------------------------------------------
@@ -50,10 +53,44 @@ extern "C" {
 
 // - declaration of public user-defined types ------------------------------------------------------------------------- 
 
+typedef struct
+{
+    eOprotID32_t                        id32;
+    uint8_t                             used;
+} eODeb_eoProtoParser_nvslot_t;
+
+
+typedef struct
+{
+    uint32_t                            addr;           // as in eOethLowLevParser_packetInfo_t::src_addr
+    uint8_t                             used;
+    uint32_t                            currseqnum;
+    uint32_t                            firstseqnum;
+    eOethLowLevParser_packetInfo_t      firstpkt;       // used to merge the checks across chunks of a capture
+} eODeb_eoProtoParser_source_t;
+
+
+typedef struct
+{
+    eOethLowLevParser_packetInfo_t      pkt;
+    uint32_t                            rec_seqnum;
+    uint32_t                            exp_seqnum;
+} eODeb_eoProtoParser_seqnumerror_t;
+
+
 struct eODeb_eoProtoParser_hid
 {
-    eODeb_eoProtoParser_cfg_t     cfg;
-    uint8_t                       initted;
+    eODeb_eoProtoParser_cfg_t           cfg;
+    uint8_t                             initted;
+    eODeb_eoProtoParser_nvslot_t        nvs[eODeb_eoProtoParser_hashsizeNVs];
+    eODeb_eoProtoParser_source_t        sources[eODeb_eoProtoParser_hashsizeSources];
+    uint8_t                             numberofsources;
+    eODeb_eoProtoParser_stats_t         stats;
+    // if deferseqnumerrors is eobool_true the errors are stored in deferred rather than given to cbk_onErrSeqNum
+    eObool_t                            deferseqnumerrors;
+    eODeb_eoProtoParser_seqnumerror_t   *deferred;
+    uint32_t                            deferredsize;
+    uint32_t                            deferredcapacity;
 };
 // - declaration of extern hidden functions ---------------------------------------------------------------------------
 
@@ -0,0 +1,637 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eODeb_replayEngine.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#include "EOtheMemoryPool.h"
+#include "EOtransceiver.h"
+#include "eOtheEthLowLevelParser.h"
+#include "eODeb_eoProtoParser.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+#include <time.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_replayEngine.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eODeb_replayEngine_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+// libpcap file format: global header of 24 bytes, then every record has a header of 16 bytes followed by the frame
+#define PCAP_GLOBALHEADER_SIZE          24
+#define PCAP_RECORDHEADER_SIZE          16
+#define PCAP_MAGIC_USEC                 0xa1b2c3d4
+#define PCAP_MAGIC_USEC_SWAPPED         0xd4c3b2a1
+#define PCAP_MAGIC_NSEC                 0xa1b23c4d
+#define PCAP_MAGIC_NSEC_SWAPPED         0x4d3cb2a1
+#define PCAP_LINKTYPE_ETHERNET          1
+
+// the smallest frame which can contain a udp datagram: ethernet + ip + udp headers
+#define FRAME_MINSIZE                   (14 + 20 + 8)
+
+// we read the frame at this offset inside the buffer so that the udp payload (at offset 42) is 32-bit aligned,
+// as it is when the host receives it from a socket
+#define FRAME_ALIGNOFFSET               2
+
+// below this wait we spin rather than sleep
+#define PACING_SPINLIMIT_NS             (100*1000)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eODeb_replayEngine_cfg_t eODeb_replayEngine_cfg_default =
+{
+    EO_INIT(.maxtransceivers)   32,
+    EO_INIT(.speedfactor)       0.0f,
+    EO_INIT(.maxpackets)        0,
+    EO_INIT(.dissect)           eobool_false,
+    EO_INIT(.onpacket)          NULL,
+    EO_INIT(.onpacketarg)       NULL,
+    EO_INIT(.nanotime)          NULL
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+
+typedef struct
+{
+    FILE        *file;
+    eObool_t    swapped;
+    eObool_t    nanosec;
+} eodeb_replayEngine_capture_t;
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eodeb_replayEngine_nanotime(void);
+static uint32_t s_eodeb_replayEngine_u32(const uint8_t *data, eObool_t swapped);
+static eOresult_t s_eodeb_replayEngine_capture_open(eodeb_replayEngine_capture_t *cap, const char *capturefile);
+static eOresult_t s_eodeb_replayEngine_capture_next(eodeb_replayEngine_capture_t *cap, uint8_t *frame, uint32_t *size, uint64_t *timestamp);
+static eODeb_replayEngine_board_t * s_eodeb_replayEngine_board_find(eODeb_replayEngine *p, eOipv4addr_t ipv4addr);
+static void s_eodeb_replayEngine_pace(eODeb_replayEngine *p, uint64_t target);
+static void s_eodeb_replayEngine_stats_add(eODeb_replayEngine_stats_t *to, const eODeb_replayEngine_stats_t *from);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eODeb_replayEngine * eODeb_replayEngine_New(const eODeb_replayEngine_cfg_t *cfg)
+{
+    eODeb_replayEngine *retptr = NULL;
+    uint8_t i = 0;
+
+    if(NULL == cfg)
+    {
+        cfg = &eODeb_replayEngine_cfg_default;
+    }
+
+    if(0 == cfg->maxtransceivers)
+    {
+        return(NULL);
+    }
+
+    retptr = (eODeb_replayEngine*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eODeb_replayEngine), 1);
+
+    memcpy(&retptr->cfg, cfg, sizeof(eODeb_replayEngine_cfg_t));
+
+    if(NULL == retptr->cfg.nanotime)
+    {
+        retptr->cfg.nanotime = s_eodeb_replayEngine_nanotime;
+    }
+
+    retptr->boards = (eODeb_replayEngine_board_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eODeb_replayEngine_board_t), cfg->maxtransceivers);
+    for(i=0; i<cfg->maxtransceivers; i++)
+    {
+        retptr->boards[i].ipv4addr = 0;
+        retptr->boards[i].htrx = NULL;
+        retptr->boards[i].packet = NULL;
+        memset(&retptr->boards[i].stats, 0, sizeof(eODeb_replayEngine_stats_t));
+    }
+    retptr->numberofboards = 0;
+    retptr->lastboard = 0;
+
+    retptr->framebuffer = (uint8_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, eODeb_replayEngine_maxframesize + FRAME_ALIGNOFFSET, 1);
+
+    memset(&retptr->stats, 0, sizeof(eODeb_replayEngine_stats_t));
+
+    return(retptr);
+}
+
+
+extern void eODeb_replayEngine_Delete(eODeb_replayEngine *p)
+{
+    uint8_t i = 0;
+
+    if(NULL == p)
+    {
+        return;
+    }
+
+    if(NULL == p->boards)
+    {
+        return;
+    }
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        eo_packet_Delete(p->boards[i].packet);
+    }
+
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->framebuffer);
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->boards);
+
+    memset(p, 0, sizeof(eODeb_replayEngine));
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern eOresult_t eODeb_replayEngine_AddTransceiver(eODeb_replayEngine *p, EOhostTransceiver *htrx)
+{
+    eODeb_replayEngine_board_t *board = NULL;
+    eOipv4addr_t ipv4addr = 0;
+
+    if((NULL == p) || (NULL == htrx))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    ipv4addr = eo_hosttransceiver_GetRemoteIP(htrx);
+
+    if(NULL != s_eodeb_replayEngine_board_find(p, ipv4addr))
+    {
+        return(eores_NOK_generic);
+    }
+
+    if(p->numberofboards >= p->cfg.maxtransceivers)
+    {
+        return(eores_NOK_busy);
+    }
+
+    board = &p->boards[p->numberofboards];
+    board->ipv4addr = ipv4addr;
+    board->htrx = htrx;
+    board->packet = eo_packet_New(0);
+    memset(&board->stats, 0, sizeof(eODeb_replayEngine_stats_t));
+
+    p->numberofboards++;
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_replayEngine_Run(eODeb_replayEngine *p, const char *capturefile)
+{
+    eodeb_replayEngine_capture_t capture = {0};
+    eOTheEthLowLevParser *llparser = NULL;
+    eODeb_eoProtoParser *debparser = NULL;
+    eOethLowLevParser_packetInfo_t pktinfo = {0};
+    eODeb_replayEngine_board_t *board = NULL;
+    eODeb_replayEngine_stats_t *stats = NULL;
+    uint8_t *frame = NULL;
+    uint32_t framesize = 0;
+    uint64_t timestamp = 0;
+    uint64_t lasttimestamp = 0;
+    uint64_t target = 0;
+    uint64_t start = 0;
+    uint64_t t0 = 0;
+    uint64_t t1 = 0;
+    uint32_t numberofpackets = 0;
+    uint16_t numberofrops = 0;
+    eOresult_t res = eores_OK;
+
+    if((NULL == p) || (NULL == capturefile))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eores_OK != (res = s_eodeb_replayEngine_capture_open(&capture, capturefile)))
+    {
+        return(res);
+    }
+
+    // the low level parser is a singleton: if the application has not initialised it, we do it with no filters
+    llparser = eo_ethLowLevParser_GetHandle();
+    if(NULL == llparser)
+    {
+        eOethLowLevParser_cfg_t llcfg = {0};
+        llparser = eo_ethLowLevParser_Initialise(&llcfg);
+    }
+
+    debparser = (eobool_true == p->cfg.dissect) ? eODeb_eoProtoParser_GetHandle() : NULL;
+
+    frame = &p->framebuffer[FRAME_ALIGNOFFSET];
+    start = p->cfg.nanotime();
+
+    while(eores_OK == s_eodeb_replayEngine_capture_next(&capture, frame, &framesize, &timestamp))
+    {
+        if((0 != p->cfg.maxpackets) && (numberofpackets >= p->cfg.maxpackets))
+        {
+            break;
+        }
+
+        // the time at which the packet is due advances by the delta from the previous one in the capture. if the
+        // timestamps go backwards (the clock of the capture was adjusted or two captures were merged) the delta is 0,
+        // so that the packet is due together with the previous one rather than in a far future
+        if(0 == numberofpackets)
+        {
+            target = start;
+        }
+        else if(timestamp > lasttimestamp)
+        {
+            target += (0.0f == p->cfg.speedfactor) ? (0) : ((uint64_t)((double)(timestamp - lasttimestamp) / (double)p->cfg.speedfactor));
+        }
+        lasttimestamp = timestamp;
+        numberofpackets++;
+
+        if((framesize < FRAME_MINSIZE) || (eores_OK != eOTheEthLowLevParser_GetUDPdatagramPayload(llparser, frame, &pktinfo)) ||
+           ((pktinfo.payload_ptr + pktinfo.size) > (frame + framesize)))
+        {
+            p->stats.packetsdiscarded++;
+            continue;
+        }
+
+        // the low level parser gives addresses in host order, whereas the EOpacket uses the EO_COMMON_IPV4ADDR() layout
+        board = s_eodeb_replayEngine_board_find(p, EO_COMMON_IPV4ADDR((pktinfo.src_addr >> 24) & 0xff, (pktinfo.src_addr >> 16) & 0xff,
+                                                                      (pktinfo.src_addr >> 8) & 0xff, pktinfo.src_addr & 0xff));
+        if(NULL == board)
+        {
+            p->stats.packetsdiscarded++;
+            continue;
+        }
+
+        if(0.0f != p->cfg.speedfactor)
+        {
+            s_eodeb_replayEngine_pace(p, target);
+        }
+
+        if(NULL != debparser)
+        {
+            eODeb_eoProtoParser_RopFrameDissect(debparser, &pktinfo);
+        }
+
+        stats = &board->stats;
+
+        eo_packet_Full_LinkTo(board->packet, board->ipv4addr, (eOipv4port_t)pktinfo.src_port, (uint16_t)pktinfo.size, pktinfo.payload_ptr);
+
+        numberofrops = 0;
+        t0 = p->cfg.nanotime();
+        res = eo_transceiver_Receive(eo_hosttransceiver_GetTransceiver(board->htrx), board->packet, &numberofrops, NULL);
+        t1 = p->cfg.nanotime();
+
+        stats->decodetime += (t1 - t0);
+
+        if(eores_OK != res)
+        {
+            stats->packetsinvalid++;
+            continue;
+        }
+
+        stats->packets++;
+        stats->rops += numberofrops;
+        stats->bytes += pktinfo.size;
+
+        if(NULL != p->cfg.onpacket)
+        {
+            p->cfg.onpacket(p->cfg.onpacketarg, board->htrx, board->packet, numberofrops);
+            stats->callbacktime += (p->cfg.nanotime() - t1);
+        }
+    }
+
+    fclose(capture.file);
+
+    p->stats.elapsedtime += (p->cfg.nanotime() - start);
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_replayEngine_GetStats(eODeb_replayEngine *p, eODeb_replayEngine_stats_t *stats)
+{
+    uint8_t i = 0;
+
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    // the global stats hold only what cannot be assigned to a board
+    memcpy(stats, &p->stats, sizeof(eODeb_replayEngine_stats_t));
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        s_eodeb_replayEngine_stats_add(stats, &p->boards[i].stats);
+    }
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_replayEngine_GetStatsOfBoard(eODeb_replayEngine *p, eOipv4addr_t ipv4addr, eODeb_replayEngine_stats_t *stats)
+{
+    eODeb_replayEngine_board_t *board = NULL;
+
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(NULL == (board = s_eodeb_replayEngine_board_find(p, ipv4addr)))
+    {
+        return(eores_NOK_generic);
+    }
+
+    memcpy(stats, &board->stats, sizeof(eODeb_replayEngine_stats_t));
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_replayEngine_GetReport(eODeb_replayEngine *p, eODeb_replayEngine_report_t *report)
+{
+    eODeb_replayEngine_stats_t stats = {0};
+
+    if((NULL == p) || (NULL == report))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    eODeb_replayEngine_GetStats(p, &stats);
+
+    memset(report, 0, sizeof(eODeb_replayEngine_report_t));
+
+    if(0 != stats.elapsedtime)
+    {
+        report->ropspersecond = 1e9 * (double)stats.rops / (double)stats.elapsedtime;
+        report->packetspersecond = 1e9 * (double)stats.packets / (double)stats.elapsedtime;
+    }
+
+    if(0 != stats.rops)
+    {
+        report->decodenanosecperrop = (double)stats.decodetime / (double)stats.rops;
+        report->callbacknanosecperrop = (double)stats.callbacktime / (double)stats.rops;
+    }
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eODeb_replayEngine_ResetStats(eODeb_replayEngine *p)
+{
+    uint8_t i = 0;
+
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    memset(&p->stats, 0, sizeof(eODeb_replayEngine_stats_t));
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        memset(&p->boards[i].stats, 0, sizeof(eODeb_replayEngine_stats_t));
+    }
+
+    return(eores_OK);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eodeb_replayEngine_nanotime(void)
+{
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return(((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+#else
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return(((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+#endif
+}
+
+
+static uint32_t s_eodeb_replayEngine_u32(const uint8_t *data, eObool_t swapped)
+{
+    uint32_t v = 0;
+    memcpy(&v, data, sizeof(v));
+
+    if(eobool_true == swapped)
+    {
+        v = ((v & 0xff000000) >> 24) | ((v & 0x00ff0000) >> 8) | ((v & 0x0000ff00) << 8) | ((v & 0x000000ff) << 24);
+    }
+
+    return(v);
+}
+
+
+static eOresult_t s_eodeb_replayEngine_capture_open(eodeb_replayEngine_capture_t *cap, const char *capturefile)
+{
+    uint8_t header[PCAP_GLOBALHEADER_SIZE] = {0};
+    uint32_t magic = 0;
+
+    if(NULL == (cap->file = fopen(capturefile, "rb")))
+    {
+        return(eores_NOK_nodata);
+    }
+
+    if(1 != fread(header, PCAP_GLOBALHEADER_SIZE, 1, cap->file))
+    {
+        fclose(cap->file);
+        return(eores_NOK_unsupported);
+    }
+
+    magic = s_eodeb_replayEngine_u32(&header[0], eobool_false);
+
+    switch(magic)
+    {
+        case PCAP_MAGIC_USEC:           { cap->swapped = eobool_false;  cap->nanosec = eobool_false;    } break;
+        case PCAP_MAGIC_USEC_SWAPPED:   { cap->swapped = eobool_true;   cap->nanosec = eobool_false;    } break;
+        case PCAP_MAGIC_NSEC:           { cap->swapped = eobool_false;  cap->nanosec = eobool_true;     } break;
+        case PCAP_MAGIC_NSEC_SWAPPED:   { cap->swapped = eobool_true;   cap->nanosec = eobool_true;     } break;
+        default:
+        {
+            fclose(cap->file);
+            return(eores_NOK_unsupported);
+        }
+    }
+
+    if(PCAP_LINKTYPE_ETHERNET != s_eodeb_replayEngine_u32(&header[20], cap->swapped))
+    {
+        fclose(cap->file);
+        return(eores_NOK_unsupported);
+    }
+
+    return(eores_OK);
+}
+
+
+static eOresult_t s_eodeb_replayEngine_capture_next(eodeb_replayEngine_capture_t *cap, uint8_t *frame, uint32_t *size, uint64_t *timestamp)
+{
+    uint8_t header[PCAP_RECORDHEADER_SIZE] = {0};
+    uint32_t tsec = 0;
+    uint32_t tfrac = 0;
+    uint32_t inclen = 0;
+
+    for(;;)
+    {
+        if(1 != fread(header, PCAP_RECORDHEADER_SIZE, 1, cap->file))
+        {
+            return(eores_NOK_nodata);
+        }
+
+        tsec = s_eodeb_replayEngine_u32(&header[0], cap->swapped);
+        tfrac = s_eodeb_replayEngine_u32(&header[4], cap->swapped);
+        inclen = s_eodeb_replayEngine_u32(&header[8], cap->swapped);
+
+        if(inclen <= eODeb_replayEngine_maxframesize)
+        {
+            break;
+        }
+
+        // a frame bigger than any ethernet frame of our boards: we skip it
+        if(0 != fseek(cap->file, (long)inclen, SEEK_CUR))
+        {
+            return(eores_NOK_nodata);
+        }
+    }
+
+    if((0 != inclen) && (1 != fread(frame, inclen, 1, cap->file)))
+    {
+        return(eores_NOK_nodata);
+    }
+
+    *size = inclen;
+    *timestamp = ((uint64_t)tsec * 1000000000ULL) + ((eobool_true == cap->nanosec) ? (uint64_t)tfrac : ((uint64_t)tfrac * 1000ULL));
+
+    return(eores_OK);
+}
+
+
+static eODeb_replayEngine_board_t * s_eodeb_replayEngine_board_find(eODeb_replayEngine *p, eOipv4addr_t ipv4addr)
+{
+    uint8_t i = 0;
+
+    if((p->lastboard < p->numberofboards) && (ipv4addr == p->boards[p->lastboard].ipv4addr))
+    {
+        return(&p->boards[p->lastboard]);
+    }
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        if(ipv4addr == p->boards[i].ipv4addr)
+        {
+            p->lastboard = i;
+            return(&p->boards[i]);
+        }
+    }
+
+    return(NULL);
+}
+
+
+static void s_eodeb_replayEngine_pace(eODeb_replayEngine *p, uint64_t target)
+{
+    uint64_t now = p->cfg.nanotime();
+
+    while(now < target)
+    {
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+        if((target - now) > PACING_SPINLIMIT_NS)
+        {
+            struct timespec ts;
+            uint64_t wait = target - now - PACING_SPINLIMIT_NS;
+            ts.tv_sec = (time_t)(wait / 1000000000ULL);
+            ts.tv_nsec = (long)(wait % 1000000000ULL);
+            nanosleep(&ts, NULL);
+        }
+#endif
+        now = p->cfg.nanotime();
+    }
+}
+
+
+static void s_eodeb_replayEngine_stats_add(eODeb_replayEngine_stats_t *to, const eODeb_replayEngine_stats_t *from)
+{
+    to->packets             += from->packets;
+    to->packetsdiscarded    += from->packetsdiscarded;
+    to->packetsinvalid      += from->packetsinvalid;
+    to->rops                += from->rops;
+    to->bytes               += from->bytes;
+    to->decodetime          += from->decodetime;
+    to->callbacktime        += from->callbacktime;
+    // the elapsedtime is global only
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
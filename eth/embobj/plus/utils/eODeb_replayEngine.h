@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_REPLAYENGINE_H_
+#define _EODEB_REPLAYENGINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eODeb_replayEngine.h
+    @brief      offline replay of a capture file into a set of EOhostTransceiver objects
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eodeb_replayengine Object eODeb_replayEngine
+    The eODeb_replayEngine reads a capture file in libpcap format, extracts the UDP payload of every ethernet frame
+    with the eOTheEthLowLevParser, and feeds it to the EOhostTransceiver whose remote address is the source address
+    of the frame, exactly as the host does with eo_transceiver_Receive() when it receives from the network.
+    The replay can go as fast as possible or at a scaled real time computed from the timestamps of the capture. A
+    timestamp which goes backwards counts as no time elapsed since the previous packet.
+    At the end it reports the number of ROPs per second, the cost of decoding per ROP and the cost of the user
+    callback, so that the whole host decode path can be benchmarked without any network.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOpacket.h"
+#include "EOhostTransceiver.h"
+#include "eOtheEthLowLevelParser.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eODeb_replayEngine_maxframesize     2048
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eODeb_replayEngine_hid eODeb_replayEngine;
+
+
+/* this callback is invoked after the packet has been processed by the transceiver. its execution time is accounted as callback cost */
+typedef     eOresult_t  (*eODeb_replayEngine_cbk_onPacket_t)    (void *arg, EOhostTransceiver *htrx, EOpacket *pkt, uint16_t numberofrops);
+
+/* this function returns the time in nanoseconds from a monotonic clock */
+typedef     uint64_t    (*eODeb_replayEngine_fn_nanotime_t)     (void);
+
+
+typedef struct
+{
+    uint8_t                             maxtransceivers;    /**< max number of EOhostTransceiver which can be added */
+    float                               speedfactor;        /**< 0.0 means as fast as possible, 1.0 means real time, 2.0 twice as fast etc. */
+    uint32_t                            maxpackets;         /**< if 0 all the packets in the capture are replayed */
+    eObool_t                            dissect;            /**< if eobool_true, the packet is also given to the eODeb_eoProtoParser (if initialised) */
+    eODeb_replayEngine_cbk_onPacket_t   onpacket;           /**< if not NULL it is called after every eo_transceiver_Receive() */
+    void                                *onpacketarg;
+    eODeb_replayEngine_fn_nanotime_t    nanotime;           /**< if NULL an internal monotonic clock is used */
+} eODeb_replayEngine_cfg_t;
+
+
+typedef struct
+{
+    uint32_t        packets;            /**< packets given to a transceiver */
+    uint32_t        packetsdiscarded;   /**< frames which are not UDP or whose source is not associated to any transceiver */
+    uint32_t        packetsinvalid;     /**< packets refused by eo_transceiver_Receive() */
+    uint64_t        rops;               /**< rops decoded by the transceivers */
+    uint64_t        bytes;              /**< payload bytes given to the transceivers */
+    eOnanotime_t    decodetime;         /**< time spent inside eo_transceiver_Receive() */
+    eOnanotime_t    callbacktime;       /**< time spent inside the onpacket callback */
+    eOnanotime_t    elapsedtime;        /**< total time of the replay, also file reading and pacing */
+} eODeb_replayEngine_stats_t;
+
+
+typedef struct
+{
+    double          ropspersecond;      /**< rops over elapsed time */
+    double          decodenanosecperrop;
+    double          callbacknanosecperrop;
+    double          packetspersecond;
+} eODeb_replayEngine_report_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eODeb_replayEngine_cfg_t eODeb_replayEngine_cfg_default; // = { 32, 0.0, 0, eobool_false, NULL, NULL, NULL };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+extern eODeb_replayEngine * eODeb_replayEngine_New(const eODeb_replayEngine_cfg_t *cfg);
+
+extern void eODeb_replayEngine_Delete(eODeb_replayEngine *p);
+
+/** @fn         extern eOresult_t eODeb_replayEngine_AddTransceiver(eODeb_replayEngine *p, EOhostTransceiver *htrx)
+    @brief      associates the host transceiver to its remote ip address (eo_hosttransceiver_GetRemoteIP()), so that
+                frames coming from that address are given to it.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_busy if the table is full or eores_NOK_generic if the
+                address is already used.
+ **/
+extern eOresult_t eODeb_replayEngine_AddTransceiver(eODeb_replayEngine *p, EOhostTransceiver *htrx);
+
+/** @fn         extern eOresult_t eODeb_replayEngine_Run(eODeb_replayEngine *p, const char *capturefile)
+    @brief      replays the file (libpcap format, ethernet link type, micro or nano second timestamps). the statistics
+                are accumulated across consecutive calls until eODeb_replayEngine_ResetStats() is called.
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_nodata if the file cannot be opened or eores_NOK_unsupported
+                if it is not a supported capture.
+ **/
+extern eOresult_t eODeb_replayEngine_Run(eODeb_replayEngine *p, const char *capturefile);
+
+extern eOresult_t eODeb_replayEngine_GetStats(eODeb_replayEngine *p, eODeb_replayEngine_stats_t *stats);
+
+extern eOresult_t eODeb_replayEngine_GetStatsOfBoard(eODeb_replayEngine *p, eOipv4addr_t ipv4addr, eODeb_replayEngine_stats_t *stats);
+
+extern eOresult_t eODeb_replayEngine_GetReport(eODeb_replayEngine *p, eODeb_replayEngine_report_t *report);
+
+extern eOresult_t eODeb_replayEngine_ResetStats(eODeb_replayEngine *p);
+
+
+/** @}
+    end of group eodeb_replayengine
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EODEB_REPLAYENGINE_HID_H_
+#define _EODEB_REPLAYENGINE_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eODeb_replayEngine_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOpacket.h"
+#include "EOhostTransceiver.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eODeb_replayEngine.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    eOipv4addr_t                    ipv4addr;
+    EOhostTransceiver               *htrx;
+    EOpacket                        *packet;        // it has external storage: it links the frame buffer
+    eODeb_replayEngine_stats_t      stats;
+} eODeb_replayEngine_board_t;
+
+
+struct eODeb_replayEngine_hid
+{
+    eODeb_replayEngine_cfg_t        cfg;
+    eODeb_replayEngine_board_t      *boards;
+    uint8_t                         numberofboards;
+    uint8_t                         lastboard;      // index of last board used: consecutive frames often come from the same one
+    uint8_t                         *framebuffer;
+    eODeb_replayEngine_stats_t      stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOnvsetSharedReader.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+
+#include "EoAtomic.h"
+
+#include "stdlib.h"
+#include "string.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOnvsetSharedReader.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOnvsetSharedReader_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static const eOseqlock_t * s_eOnvsetSharedReader_seqlock(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOnvsetSharedReader * eOnvsetSharedReader_New(const char *name, eOnvEP8_t ep8)
+{
+    eOnvsetSharedReader *p = NULL;
+    char segment[eonvset_shm_namesize+8] = {0};
+    const eOnvset_shm_header_t *h = NULL;
+    struct stat st;
+    void *m = NULL;
+    int fd = -1;
+
+    if(eores_OK != eo_nvset_SharedMemoryName(name, ep8, segment, sizeof(segment)))
+    {
+        return(NULL);
+    }
+
+    if((fd = shm_open(segment, O_RDONLY, 0)) < 0)
+    {
+        return(NULL);
+    }
+
+    if((0 != fstat(fd, &st)) || (st.st_size < (off_t)sizeof(eOnvset_shm_header_t)))
+    {
+        close(fd);
+        return(NULL);
+    }
+
+    m = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(MAP_FAILED == m)
+    {
+        return(NULL);
+    }
+
+    h = (const eOnvset_shm_header_t*)m;
+
+    p = (eOnvsetSharedReader*)calloc(1, sizeof(eOnvsetSharedReader));
+    if(NULL == p)
+    {
+        munmap(m, (size_t)st.st_size);
+        return(NULL);
+    }
+
+    p->header = h;
+    p->size = (uint32_t)st.st_size;
+    p->generation = eo_atomic_u32_Load(&h->generation);
+
+    // the layout is verified only once: the owner never changes it while the generation stays the same
+    if( (eonvset_shm_magic != h->magic) || (eonvset_shm_version != h->version) || (sizeof(eOnvset_shm_header_t) != h->headersize) ||
+        (0 != (p->generation & 1)) || (ep8 != h->endpoint) ||
+        ((uint64_t)h->offsetofseqlocks + (uint64_t)h->numberofseqlocks*sizeof(eOseqlock_t) > p->size) ||
+        ((uint64_t)h->offsetofram + h->sizeofram > p->size) )
+    {
+        eOnvsetSharedReader_Delete(p);
+        return(NULL);
+    }
+
+    p->seqlocks = (const eOseqlock_t*)((const uint8_t*)m + h->offsetofseqlocks);
+    p->ram = (const uint8_t*)m + h->offsetofram;
+
+    return(p);
+}
+
+
+extern void eOnvsetSharedReader_Delete(eOnvsetSharedReader *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+    munmap((void*)p->header, p->size);
+    free(p);
+}
+
+
+extern eObool_t eOnvsetSharedReader_IsValid(eOnvsetSharedReader *p)
+{
+    if(NULL == p)
+    {
+        return(eobool_false);
+    }
+
+    return((p->generation == eo_atomic_u32_Load(&p->header->generation)) ? eobool_true : eobool_false);
+}
+
+
+extern const eOnvset_shm_header_t * eOnvsetSharedReader_GetHeader(eOnvsetSharedReader *p)
+{
+    return((NULL == p) ? NULL : p->header);
+}
+
+
+extern const void * eOnvsetSharedReader_Entity(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint16_t *size)
+{
+    const eOnvset_shm_header_t *h = NULL;
+    uint32_t offset = 0;
+
+    if(NULL == s_eOnvsetSharedReader_seqlock(p, ent, index))
+    {
+        return(NULL);
+    }
+
+    h = p->header;
+    offset = h->ramofentity[ent] + (uint32_t)index * h->sizeofentity[ent];
+    if(offset + h->sizeofentity[ent] > h->sizeofram)
+    {
+        return(NULL);
+    }
+
+    if(NULL != size)
+    {
+        *size = h->sizeofentity[ent];
+    }
+
+    return(p->ram + offset);
+}
+
+
+extern uint32_t eOnvsetSharedReader_ReadBegin(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index)
+{
+    const eOseqlock_t *l = s_eOnvsetSharedReader_seqlock(p, ent, index);
+
+    // an odd sequence makes eOnvsetSharedReader_ReadRetry() fail
+    return((NULL == l) ? 1 : eo_atomic_u32_Load(&l->sequence));
+}
+
+
+extern eObool_t eOnvsetSharedReader_ReadRetry(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint32_t start)
+{
+    const eOseqlock_t *l = s_eOnvsetSharedReader_seqlock(p, ent, index);
+
+    if((NULL == l) || (0 != (start & 1)))
+    {
+        return(eobool_true);
+    }
+
+    return(eo_seqlock_ReadRetry(l, start));
+}
+
+
+extern eOresult_t eOnvsetSharedReader_Snapshot(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size)
+{
+    const void *ram = NULL;
+    uint16_t sizeofentity = 0;
+    uint32_t s = 0;
+    uint32_t i = 0;
+
+    if((NULL == p) || (NULL == data) || (NULL == size))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    *size = 0;
+
+    if((eobool_false == eOnvsetSharedReader_IsValid(p)) || (NULL == (ram = eOnvsetSharedReader_Entity(p, ent, index, &sizeofentity))))
+    {
+        return(eores_NOK_generic);
+    }
+
+    // the retries are bounded, so that a crash of the owner while it writes does not block the reader
+    for(i=0; i<eOnvsetSharedReader_maxretries; i++)
+    {
+        s = eOnvsetSharedReader_ReadBegin(p, ent, index);
+        memcpy(data, ram, sizeofentity);
+        if(eobool_false == eOnvsetSharedReader_ReadRetry(p, ent, index, s))
+        {   // the owner may have removed the endpoint while we copied: then the copy is not of this entity anymore
+            if(eobool_false == eOnvsetSharedReader_IsValid(p))
+            {
+                return(eores_NOK_generic);
+            }
+            *size = sizeofentity;
+            return(eores_OK);
+        }
+    }
+
+    return(eores_NOK_busy);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static const eOseqlock_t * s_eOnvsetSharedReader_seqlock(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index)
+{
+    uint32_t i = 0;
+
+    if((NULL == p) || (ent >= eoprot_entities_maxnumberofsupported) || (index >= p->header->numberofentities[ent]))
+    {
+        return(NULL);
+    }
+
+    i = (uint32_t)p->header->entityoffset[ent] + index;
+
+    return((i < p->header->numberofseqlocks) ? &p->seqlocks[i] : NULL);
+}
+
+
+#endif // defined(EO_TAILOR_CODE_FOR_LINUX)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
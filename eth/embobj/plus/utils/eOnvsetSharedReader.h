@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETSHAREDREADER_H_
+#define _EONVSETSHAREDREADER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOnvsetSharedReader.h
+    @brief      host side reader of the NVs which another process exports in shared memory
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eonvsetsharedreader Object eOnvsetSharedReader
+    The eOnvsetSharedReader gives to a process such as a logger or a GUI the NVs of an endpoint of a board which
+    the process that owns its EOnvSet exports with eo_nvset_SharedMemoryExport(). The segment is mapped read only,
+    and the entities are read with the seqlocks that the owner marks at every write:
+
+    - eOnvsetSharedReader_Snapshot() copies an entity so that none of its NVs changes during the copy.
+    - eOnvsetSharedReader_Entity() gives a pointer to the entity inside the segment, to be used in place with no copy
+      between eOnvsetSharedReader_ReadBegin() and eOnvsetSharedReader_ReadRetry(), as in:
+
+    @code
+    uint32_t s;
+    const eOmc_joint_t *j = (const eOmc_joint_t*) eOnvsetSharedReader_Entity(r, eoprot_entity_mc_joint, 2, NULL);
+    do
+    {
+        s = eOnvsetSharedReader_ReadBegin(r, eoprot_entity_mc_joint, 2);
+        position = j->status.core.measures.meas_position;
+    } while(eobool_true == eOnvsetSharedReader_ReadRetry(r, eoprot_entity_mc_joint, 2, s));
+    @endcode
+
+    When the owner unloads the endpoint or exports it again, the object becomes not valid and it must be deleted and
+    created again. It is available only on linux.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOnvSet.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOnvsetSharedReader_hid eOnvsetSharedReader;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOnvsetSharedReader * eOnvsetSharedReader_New(const char *name, eOnvEP8_t ep8)
+    @brief      maps the segment of endpoint ep8 exported as name.
+    @return     the object or NULL if the segment does not exist, has another layout version or is not ready yet.
+ **/
+extern eOnvsetSharedReader * eOnvsetSharedReader_New(const char *name, eOnvEP8_t ep8);
+
+extern void eOnvsetSharedReader_Delete(eOnvsetSharedReader *p);
+
+/** @fn         extern eObool_t eOnvsetSharedReader_IsValid(eOnvsetSharedReader *p)
+    @return     eobool_false if the owner has removed the endpoint since the object was created.
+ **/
+extern eObool_t eOnvsetSharedReader_IsValid(eOnvsetSharedReader *p);
+
+extern const eOnvset_shm_header_t * eOnvsetSharedReader_GetHeader(eOnvsetSharedReader *p);
+
+/** @fn         extern const void * eOnvsetSharedReader_Entity(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint16_t *size)
+    @brief      gives the ram of an entity inside the segment. it must be read only between eOnvsetSharedReader_ReadBegin()
+                and eOnvsetSharedReader_ReadRetry().
+    @param      size        if not NULL it gets the size of the entity
+    @return     the pointer or NULL if the entity does not exist.
+ **/
+extern const void * eOnvsetSharedReader_Entity(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint16_t *size);
+
+/** @fn         extern uint32_t eOnvsetSharedReader_ReadBegin(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index)
+    @brief      marks the start of a read of the entity. it does not wait for a writer which is inside, so that a crash
+                of the owner does not block the reader: the following eOnvsetSharedReader_ReadRetry() fails instead.
+    @return     the sequence to be given to eOnvsetSharedReader_ReadRetry().
+ **/
+extern uint32_t eOnvsetSharedReader_ReadBegin(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index);
+
+/** @fn         extern eObool_t eOnvsetSharedReader_ReadRetry(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint32_t start)
+    @return     eobool_true if the owner has written the entity during the read, which must then be done again.
+ **/
+extern eObool_t eOnvsetSharedReader_ReadRetry(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, uint32_t start);
+
+/** @fn         extern eOresult_t eOnvsetSharedReader_Snapshot(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size)
+    @brief      copies the ram of an entity so that no NV of the entity is changed during the copy.
+    @param      data        it must have room for the entity
+    @param      size        it gets the bytes copied
+    @return     eores_OK, eores_NOK_nullpointer, eores_NOK_generic if the entity does not exist or the object is not
+                valid, eores_NOK_busy if the owner keeps writing the entity.
+ **/
+extern eOresult_t eOnvsetSharedReader_Snapshot(eOnvsetSharedReader *p, eOnvENT_t ent, uint8_t index, void *data, uint16_t *size);
+
+
+/** @}
+    end of group eonvsetsharedreader
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EONVSETSHAREDREADER_HID_H_
+#define _EONVSETSHAREDREADER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOnvsetSharedReader_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoSeqlock.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOnvsetSharedReader.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define eOnvsetSharedReader_maxretries      100000
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+struct eOnvsetSharedReader_hid
+{
+    const eOnvset_shm_header_t      *header;        // the start of the mapped segment
+    uint32_t                        size;           // of the segment
+    uint32_t                        generation;     // of the segment when it was mapped
+    const eOseqlock_t               *seqlocks;
+    const uint8_t                   *ram;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOskinDecoder.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "iCubCanProto_classes.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOskinDecoder.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOskinDecoder_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint8_t s_eOskinDecoder_candata(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, const eOsk_candata_t **candata);
+
+static const uint8_t * s_eOskinDecoder_frame(eOskinDecoder *p, const eOskinDecoder_patch_t *patch, const eOsk_candata_t *candata, uint32_t *index, uint8_t *number);
+
+static void s_eOskinDecoder_write(uint8_t *taxels, const uint8_t *data, uint8_t number);
+
+static void s_eOskinDecoder_write_float(float *taxels, const uint8_t *data, uint8_t number);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOskinDecoder * eOskinDecoder_New(uint8_t numberofpatches)
+{
+    eOskinDecoder *p = NULL;
+    
+    if(0 == numberofpatches)
+    {
+        return(NULL);
+    }
+    
+    p = (eOskinDecoder*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOskinDecoder), 1);
+    p->patches = (eOskinDecoder_patch_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_32bit, sizeof(eOskinDecoder_patch_t), numberofpatches);
+    p->numberofpatches = numberofpatches;
+    // all the bytes at 0xff make every first[] equal to EOK_uint32dummy
+    memset(p->patches, 0xff, numberofpatches*sizeof(eOskinDecoder_patch_t));
+    memset(&p->stats, 0, sizeof(p->stats));
+    
+    return(p);
+}
+
+
+extern void eOskinDecoder_Delete(eOskinDecoder *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+    
+    eo_mempool_Delete(eo_mempool_GetHandle(), p->patches);
+    memset(p, 0, sizeof(eOskinDecoder));
+    eo_mempool_Delete(eo_mempool_GetHandle(), p);
+}
+
+
+extern eOresult_t eOskinDecoder_Patch_Set(eOskinDecoder *p, uint8_t patch, const uint8_t *boards, uint8_t numberofboards, uint32_t offset)
+{
+    eOskinDecoder_patch_t *pa = NULL;
+    uint8_t b = 0;
+    
+    if((NULL == p) || ((NULL == boards) && (0 != numberofboards)))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if((patch >= p->numberofpatches) || (numberofboards > eOskinDecoder_boards))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    for(b=0; b<numberofboards; b++)
+    {
+        if(boards[b] >= eOskinDecoder_boards)
+        {
+            return(eores_NOK_generic);
+        }
+    }
+    
+    pa = &p->patches[patch];
+    memset(pa, 0xff, sizeof(eOskinDecoder_patch_t));
+    for(b=0; b<numberofboards; b++)
+    {
+        pa->first[boards[b]] = offset + (uint32_t)b * eOskinDecoder_triangles * eOskinDecoder_taxels;
+    }
+    
+    return(eores_OK);
+}
+
+
+extern uint16_t eOskinDecoder_Decode(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, uint8_t *taxels)
+{
+    const eOsk_candata_t *candata = NULL;
+    const uint8_t *data = NULL;
+    uint32_t index = 0;
+    uint16_t frames = 0;
+    uint8_t number = 0;
+    uint8_t size = 0;
+    uint8_t i = 0;
+    
+    if(NULL == taxels)
+    {
+        return(0);
+    }
+    
+    size = s_eOskinDecoder_candata(p, patch, array, &candata);
+    
+    for(i=0; i<size; i++)
+    {
+        data = s_eOskinDecoder_frame(p, &p->patches[patch], &candata[i], &index, &number);
+        if(NULL != data)
+        {
+            s_eOskinDecoder_write(&taxels[index], data, number);
+            frames++;
+        }
+    }
+    
+    return(frames);
+}
+
+
+extern uint16_t eOskinDecoder_Decode_float(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, float *taxels)
+{
+    const eOsk_candata_t *candata = NULL;
+    const uint8_t *data = NULL;
+    uint32_t index = 0;
+    uint16_t frames = 0;
+    uint8_t number = 0;
+    uint8_t size = 0;
+    uint8_t i = 0;
+    
+    if(NULL == taxels)
+    {
+        return(0);
+    }
+    
+    size = s_eOskinDecoder_candata(p, patch, array, &candata);
+    
+    for(i=0; i<size; i++)
+    {
+        data = s_eOskinDecoder_frame(p, &p->patches[patch], &candata[i], &index, &number);
+        if(NULL != data)
+        {
+            s_eOskinDecoder_write_float(&taxels[index], data, number);
+            frames++;
+        }
+    }
+    
+    return(frames);
+}
+
+
+extern uint32_t eOskinDecoder_DecodeBatch(eOskinDecoder *p, const eOskinDecoder_item_t *items, uint16_t numberof, uint8_t *taxels)
+{
+    uint32_t frames = 0;
+    uint16_t i = 0;
+    
+    if(NULL == items)
+    {
+        return(0);
+    }
+    
+    for(i=0; i<numberof; i++)
+    {
+        frames += eOskinDecoder_Decode(p, items[i].patch, items[i].array, taxels);
+    }
+    
+    return(frames);
+}
+
+
+extern uint32_t eOskinDecoder_DecodeBatch_float(eOskinDecoder *p, const eOskinDecoder_item_t *items, uint16_t numberof, float *taxels)
+{
+    uint32_t frames = 0;
+    uint16_t i = 0;
+    
+    if(NULL == items)
+    {
+        return(0);
+    }
+    
+    for(i=0; i<numberof; i++)
+    {
+        frames += eOskinDecoder_Decode_float(p, items[i].patch, items[i].array, taxels);
+    }
+    
+    return(frames);
+}
+
+
+extern eOresult_t eOskinDecoder_GetStats(eOskinDecoder *p, eOskinDecoder_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    memcpy(stats, &p->stats, sizeof(eOskinDecoder_stats_t));
+    
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint8_t s_eOskinDecoder_candata(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, const eOsk_candata_t **candata)
+{   // it returns how many eOsk_candata_t are inside array, 0 if it cannot be decoded
+    if((NULL == p) || (NULL == array) || (patch >= p->numberofpatches))
+    {
+        return(0);
+    }
+    
+    if(sizeof(eOsk_candata_t) != array->head.itemsize)
+    {
+        p->stats.malformed += array->head.size;
+        return(0);
+    }
+    
+    *candata = (const eOsk_candata_t*) array->data;
+    
+    return(EO_MIN(array->head.size, eosk_capacity_arrayof_skincandata));
+}
+
+
+static const uint8_t * s_eOskinDecoder_frame(eOskinDecoder *p, const eOskinDecoder_patch_t *patch, const eOsk_candata_t *candata, uint32_t *index, uint8_t *number)
+{   // it returns the frame and tells where its taxels go and how many they are, or NULL if it has none for the patch
+    uint16_t idcan = EOSK_CANDATA_INFO2IDCAN(candata->info);
+    uint8_t size = EOSK_CANDATA_INFO2SIZE(candata->info);
+    uint32_t first = 0;
+    
+    // the id is [class:3 | address:4 | triangle:4]
+    if(ICUBCANPROTO_CLASS_PERIODIC_SKIN != (idcan >> 8))
+    {
+        p->stats.malformed++;
+        return(NULL);
+    }
+    
+    first = patch->first[(idcan >> 4) & 0x0f];
+    if(EOK_uint32dummy == first)
+    {
+        p->stats.unknown++;
+        return(NULL);
+    }
+    
+    first += (uint32_t)(idcan & 0x0f) * eOskinDecoder_taxels;
+    if(0 == (candata->data[0] & 0x80))
+    {
+        *index = first;
+        *number = 7;
+    }
+    else
+    {
+        *index = first + 7;
+        *number = 5;
+    }
+    
+    if(size < (1 + *number))
+    {
+        p->stats.malformed++;
+        return(NULL);
+    }
+    
+    p->stats.frames++;
+    
+    return(candata->data);
+}
+
+
+static void s_eOskinDecoder_write(uint8_t *taxels, const uint8_t *data, uint8_t number)
+{   // 255 - x is ~x on a byte. the first byte of data is not a taxel
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint64_t word = 0;
+    memcpy(&word, data, sizeof(word));
+    word = (~word) >> 8;
+    memcpy(taxels, &word, number);
+#else
+    uint8_t k = 0;
+    for(k=0; k<number; k++)
+    {
+        taxels[k] = 255 - data[1+k];
+    }
+#endif
+}
+
+
+static void s_eOskinDecoder_write_float(float *taxels, const uint8_t *data, uint8_t number)
+{
+#if defined(__SSE2__)
+    // the 8 bytes become 8 int32 and then floats. we store only the number of taxels so that the neighbours stay 
+    const __m128i zero = _mm_setzero_si128();
+    __m128i bytes = _mm_loadl_epi64((const __m128i*)data);
+    __m128i words = zero;
+    __m128 lo;
+    __m128 hi;
+    
+    bytes = _mm_srli_si128(_mm_xor_si128(bytes, _mm_set1_epi8((char)0xff)), 1);
+    words = _mm_unpacklo_epi8(bytes, zero);
+    lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(words, zero));
+    hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(words, zero));
+    
+    _mm_storeu_ps(taxels, lo);
+    if(7 == number)
+    {
+        _mm_storel_pi((__m64*)(taxels+4), hi);
+        _mm_store_ss(taxels+6, _mm_movehl_ps(hi, hi));
+    }
+    else
+    {
+        _mm_store_ss(taxels+4, hi);
+    }
+#else
+    uint8_t k = 0;
+    for(k=0; k<number; k++)
+    {
+        taxels[k] = (float)(255 - data[1+k]);
+    }
+#endif
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOSKINDECODER_H_
+#define _EOSKINDECODER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOskinDecoder.h
+    @brief      host side decoder of the skin status into dense arrays of taxels
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eoskindecoder Object eOskinDecoder
+    The eOskinDecoder writes the CAN frames contained in the EOarray_of_skincandata_t of a eOsk_status_t into a dense
+    buffer of taxels laid out in advance. Every skin patch is a list of CAN boards, each with eOskinDecoder_triangles
+    triangles of eOskinDecoder_taxels taxels: the taxel k of triangle t of the board in position b of the patch is at
+    offset + (b*eOskinDecoder_triangles + t)*eOskinDecoder_taxels + k, where offset is given with the patch.
+    A triangle sends its taxels 0-6 in a frame whose first byte has bit 7 cleared and its taxels 7-11 in a frame whose
+    first byte has bit 7 set. The value written is 255 minus the one in the frame, so that 0 means no pressure.
+    
+    The frames are located by a table indexed by the CAN address, and the bytes are moved eight at a time (or with 
+    SSE2 for the float version) rather than one by one.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoSkin.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eOskinDecoder_boards        16      // the CAN addresses
+#define eOskinDecoder_triangles     16
+#define eOskinDecoder_taxels        12
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOskinDecoder_hid eOskinDecoder;
+
+
+typedef struct
+{
+    uint8_t                             patch;
+    uint8_t                             filler[3];
+    const EOarray_of_skincandata_t      *array;
+} eOskinDecoder_item_t;
+
+
+typedef struct
+{
+    uint32_t        frames;         /**< the frames written into the taxels */
+    uint32_t        unknown;        /**< the frames of a board not in the patch */
+    uint32_t        malformed;      /**< the frames not of skin or too short */
+} eOskinDecoder_stats_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+// empty-section
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOskinDecoder * eOskinDecoder_New(uint8_t numberofpatches)
+    @brief      creates the object for patches 0, ..., numberofpatches-1, all of them without boards.
+ **/
+extern eOskinDecoder * eOskinDecoder_New(uint8_t numberofpatches);
+
+extern void eOskinDecoder_Delete(eOskinDecoder *p);
+
+/** @fn         extern eOresult_t eOskinDecoder_Patch_Set(eOskinDecoder *p, uint8_t patch, const uint8_t *boards, uint8_t numberofboards, uint32_t offset)
+    @brief      tells the CAN addresses of the boards of a patch, in the order of their taxels, and where the taxels begin.
+                the buffer of taxels must be at least offset + numberofboards*eOskinDecoder_triangles*eOskinDecoder_taxels.
+    @return     eores_OK or eores_NOK_generic if the patch or an address is out of range.
+ **/
+extern eOresult_t eOskinDecoder_Patch_Set(eOskinDecoder *p, uint8_t patch, const uint8_t *boards, uint8_t numberofboards, uint32_t offset);
+
+/** @fn         extern uint16_t eOskinDecoder_Decode(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, uint8_t *taxels)
+    @brief      writes the taxels carried by array. the taxels of the triangles not in array are not changed.
+    @return     the number of frames written.
+ **/
+extern uint16_t eOskinDecoder_Decode(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, uint8_t *taxels);
+
+extern uint16_t eOskinDecoder_Decode_float(eOskinDecoder *p, uint8_t patch, const EOarray_of_skincandata_t *array, float *taxels);
+
+/** @fn         extern uint32_t eOskinDecoder_DecodeBatch(eOskinDecoder *p, const eOskinDecoder_item_t *items, uint16_t numberof, uint8_t *taxels)
+    @brief      as eOskinDecoder_Decode() for the arrays of many patches, for instance all those received in a cycle.
+    @return     the number of frames written.
+ **/
+extern uint32_t eOskinDecoder_DecodeBatch(eOskinDecoder *p, const eOskinDecoder_item_t *items, uint16_t numberof, uint8_t *taxels);
+
+extern uint32_t eOskinDecoder_DecodeBatch_float(eOskinDecoder *p, const eOskinDecoder_item_t *items, uint16_t numberof, float *taxels);
+
+extern eOresult_t eOskinDecoder_GetStats(eOskinDecoder *p, eOskinDecoder_stats_t *stats);
+
+
+/** @}
+    end of group eoskindecoder
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOSKINDECODER_HID_H_
+#define _EOSKINDECODER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOskinDecoder_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOskinDecoder.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    uint32_t                        first[eOskinDecoder_boards];   // index of taxel 0 of triangle 0 of every CAN address, or EOK_uint32dummy
+} eOskinDecoder_patch_t;
+
+
+struct eOskinDecoder_hid
+{
+    eOskinDecoder_patch_t           *patches;
+    uint8_t                         numberofpatches;
+    eOskinDecoder_stats_t           stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOtheJointMirror.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "string.h"
+#include "EOtheMemoryPool.h"
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOtheJointMirror.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOtheJointMirror_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOjointMirror_cfg_t eo_jointmirror_cfg_default =
+{
+    EO_INIT(.numberofparts)     eo_jointmirror_maxparts,
+    EO_INIT(.installcallbacks)  eobool_false
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eo_jointmirror_callbacks_install(void);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOTheJointMirror s_eo_thejointmirror =
+{
+    EO_INIT(.initted)           eobool_false,
+    EO_INIT(.numberofparts)     0,
+    EO_INIT(.parts)             NULL,
+    EO_INIT(.boards)            {{0}}
+};
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOTheJointMirror * eo_jointmirror_Initialise(const eOjointMirror_cfg_t *cfg)
+{
+    uint8_t i = 0;
+    
+    if(eobool_true == s_eo_thejointmirror.initted)
+    {
+        return(&s_eo_thejointmirror);
+    }
+    
+    if(NULL == cfg)
+    {
+        cfg = &eo_jointmirror_cfg_default;
+    }
+    
+    if((0 == cfg->numberofparts) || (cfg->numberofparts > eo_jointmirror_maxparts))
+    {
+        return(NULL);
+    }
+    
+    if((eobool_true == cfg->installcallbacks) && (eores_OK != s_eo_jointmirror_callbacks_install()))
+    {
+        return(NULL);
+    }
+    
+    s_eo_thejointmirror.parts = (eOjointMirror_partitem_t*) eo_mempool_GetMemory(eo_mempool_GetHandle(), eo_mempool_align_64bit, sizeof(eOjointMirror_partitem_t), cfg->numberofparts);
+    memset(s_eo_thejointmirror.parts, 0, cfg->numberofparts*sizeof(eOjointMirror_partitem_t));
+    for(i=0; i<cfg->numberofparts; i++)
+    {
+        eo_seqlock_Init(&s_eo_thejointmirror.parts[i].lock);
+    }
+    s_eo_thejointmirror.numberofparts = cfg->numberofparts;
+    // all the bytes at 0xff make every board not mapped
+    memset(s_eo_thejointmirror.boards, 0xff, sizeof(s_eo_thejointmirror.boards));
+    
+    s_eo_thejointmirror.initted = eobool_true;
+    
+    return(&s_eo_thejointmirror);
+}
+
+
+extern eOTheJointMirror * eo_jointmirror_GetHandle(void)
+{
+    return((eobool_true == s_eo_thejointmirror.initted) ? &s_eo_thejointmirror : NULL);
+}
+
+
+extern eOresult_t eo_jointmirror_Board_Set(eOTheJointMirror *p, eOnvBRD_t brd, uint8_t part, uint8_t firstjoint, uint8_t numberofjoints)
+{
+    eOjointMirror_partitem_t *item = NULL;
+    
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(0 == numberofjoints)
+    {
+        memset(&p->boards[brd], 0xff, sizeof(eOjointMirror_board_t));
+        return(eores_OK);
+    }
+    
+    if((part >= p->numberofparts) || (((uint16_t)firstjoint + numberofjoints) > eo_jointmirror_maxjoints))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    p->boards[brd].part = part;
+    p->boards[brd].firstjoint = firstjoint;
+    p->boards[brd].numberofjoints = numberofjoints;
+    
+    item = &p->parts[part];
+    if((firstjoint + numberofjoints) > item->data.numberofjoints)
+    {
+        eo_seqlock_WriteBegin(&item->lock);
+        item->data.numberofjoints = firstjoint + numberofjoints;
+        eo_seqlock_WriteEnd(&item->lock);
+    }
+    
+    return(eores_OK);
+}
+
+
+extern void eo_jointmirror_Update(const EOnv* nv, const eOropdescriptor_t* rd)
+{
+    eOTheJointMirror *p = &s_eo_thejointmirror;
+    const eOmc_joint_status_measures_t *measures = NULL;
+    const eOjointMirror_board_t *board = NULL;
+    eOjointMirror_partitem_t *item = NULL;
+    eOprotID32_t id32 = 0;
+    eOprotIndex_t index = 0;
+    uint8_t j = 0;
+    
+    rd = rd;
+    
+    if((eobool_false == p->initted) || (NULL == nv))
+    {
+        return;
+    }
+    
+    board = &p->boards[eo_nv_GetBRD(nv)];
+    if(board->part >= p->numberofparts)
+    {
+        return;
+    }
+    
+    id32 = eo_nv_GetID32(nv);
+    if((eoprot_endpoint_motioncontrol != eoprot_ID2endpoint(id32)) || (eoprot_entity_mc_joint != eoprot_ID2entity(id32)))
+    {
+        return;
+    }
+    
+    index = eoprot_ID2index(id32);
+    if((index >= board->numberofjoints) || (eo_nv_Size(nv) < sizeof(eOmc_joint_status_measures_t)))
+    {
+        return;
+    }
+    
+    // the measures are at the start of both eOmc_joint_status_t and eOmc_joint_status_core_t
+    measures = (const eOmc_joint_status_measures_t*) eo_nv_RAM(nv);
+    item = &p->parts[board->part];
+    j = board->firstjoint + index;
+    
+    eo_seqlock_WriteBegin(&item->lock);
+    item->data.position[j] = measures->meas_position;
+    item->data.velocity[j] = measures->meas_velocity;
+    item->data.acceleration[j] = measures->meas_acceleration;
+    item->data.torque[j] = measures->meas_torque;
+    item->data.updates ++;
+    eo_seqlock_WriteEnd(&item->lock);
+}
+
+
+extern eOresult_t eo_jointmirror_Snapshot(eOTheJointMirror *p, uint8_t part, eOjointMirror_part_t *snapshot)
+{
+    const eOjointMirror_partitem_t *item = NULL;
+    uint32_t s = 0;
+    
+    if((NULL == p) || (NULL == snapshot))
+    {
+        return(eores_NOK_nullpointer);
+    }
+    
+    if(part >= p->numberofparts)
+    {
+        return(eores_NOK_generic);
+    }
+    
+    item = &p->parts[part];
+    do
+    {
+        s = eo_seqlock_ReadBegin(&item->lock);
+        memcpy(snapshot, &item->data, sizeof(eOjointMirror_part_t));
+    } while(eobool_true == eo_seqlock_ReadRetry(&item->lock, s));
+    
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static eOresult_t s_eo_jointmirror_callbacks_install(void)
+{
+    eOprot_callbacks_variable_descriptor_t cbk =
+    {
+        EO_INIT(.endpoint)  eoprot_endpoint_motioncontrol,
+        EO_INIT(.entity)    eoprot_entity_mc_joint,
+        EO_INIT(.tag)       eoprot_tag_mc_joint_status,
+        EO_INIT(.init)      NULL,
+        EO_INIT(.update)    eo_jointmirror_Update
+    };
+    
+    if(eores_OK != eoprot_config_callbacks_variable_set(&cbk))
+    {
+        return(eores_NOK_generic);
+    }
+    
+    cbk.tag = eoprot_tag_mc_joint_status_core;
+    
+    return(eoprot_config_callbacks_variable_set(&cbk));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTHEJOINTMIRROR_H_
+#define _EOTHEJOINTMIRROR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOtheJointMirror.h
+    @brief      host side struct-of-arrays copy of the measures of the joints of the robot
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eo_thejointmirror Singleton eOtheJointMirror
+    The eOtheJointMirror keeps the measures of the joints received inside eOmc_joint_status_t or eOmc_joint_status_core_t
+    also as arrays of positions, velocities, accelerations and torques, one set of arrays for every part of the robot.
+    A part collects the joints of one or more boards: each board is mapped with eo_jointmirror_Board_Set() to a range
+    of joints of a part. A consumer which needs all the positions or all the torques of a part reads them in contiguous
+    memory rather than striding through the status of every joint inside the EOnvSet of every board.
+    
+    The arrays of a part are protected by a sequence lock: the writer is never blocked by the readers and
+    eo_jointmirror_Snapshot() always returns a copy which is not torn by a concurrent update.
+    
+    The mirror is fed by eo_jointmirror_Update(), which has the signature of the update callback of a variable. The
+    callbacks are global for all the boards, so a host which already has its own eoprot_fun_UPDT_mc_joint_status()
+    or eoprot_fun_UPDT_mc_joint_status_core() calls eo_jointmirror_Update() from inside it. Otherwise the singleton
+    can install it by itself at initialisation if EOPROT_CFG_OVERRIDE_CALLBACKS_IN_RUNTIME is defined.
+    
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoSeqlock.h"
+#include "EOnv.h"
+#include "EOrop.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eo_jointmirror_maxparts         16
+#define eo_jointmirror_maxjoints        32
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOTheJointMirror_hid eOTheJointMirror;
+
+
+/** @typedef    typedef struct eOjointMirror_part_t
+    @brief      the measures of the joints of a part. the arrays are first, so that they keep the alignment of the 
+                struct and can be read with vector loads.
+ **/
+typedef struct
+{
+    int32_t         position[eo_jointmirror_maxjoints];     /**< as meas_position of eOmc_joint_status_measures_t */
+    int32_t         velocity[eo_jointmirror_maxjoints];     /**< as meas_velocity */
+    int32_t         acceleration[eo_jointmirror_maxjoints]; /**< as meas_acceleration */
+    float           torque[eo_jointmirror_maxjoints];       /**< as meas_torque */
+    uint32_t        updates;                                /**< number of joint updates received so far by the part */
+    uint8_t         numberofjoints;                         /**< the used items of the arrays */
+    uint8_t         filler[3];
+} eOjointMirror_part_t;
+
+
+typedef struct
+{
+    uint8_t         numberofparts;      /**< at most eo_jointmirror_maxparts */
+    eObool_t        installcallbacks;   /**< if eobool_true it installs eo_jointmirror_Update() as update callback of the status of the joints */
+} eOjointMirror_cfg_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOjointMirror_cfg_t eo_jointmirror_cfg_default; // = { eo_jointmirror_maxparts, eobool_false };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOTheJointMirror * eo_jointmirror_Initialise(const eOjointMirror_cfg_t *cfg)
+    @brief      initialises the singleton. if cfg is NULL it uses eo_jointmirror_cfg_default.
+    @return     the handle or NULL if numberofparts is 0 or too big, or if the callbacks cannot be installed.
+ **/
+extern eOTheJointMirror * eo_jointmirror_Initialise(const eOjointMirror_cfg_t *cfg);
+
+extern eOTheJointMirror * eo_jointmirror_GetHandle(void);
+
+/** @fn         extern eOresult_t eo_jointmirror_Board_Set(eOTheJointMirror *p, eOnvBRD_t brd, uint8_t part, uint8_t firstjoint, uint8_t numberofjoints)
+    @brief      maps the joints 0, 1, ..., numberofjoints-1 of board brd into the joints firstjoint, firstjoint+1, ... of part.
+                a numberofjoints of 0 removes the board from the mirror.
+    @return     eores_OK or eores_NOK_generic if part or the joints are out of range.
+ **/
+extern eOresult_t eo_jointmirror_Board_Set(eOTheJointMirror *p, eOnvBRD_t brd, uint8_t part, uint8_t firstjoint, uint8_t numberofjoints);
+
+/** @fn         extern void eo_jointmirror_Update(const EOnv* nv, const eOropdescriptor_t* rd)
+    @brief      copies the measures of the joint in nv into the arrays. nv must contain a eOmc_joint_status_t or a 
+                eOmc_joint_status_core_t. nothing is done if the singleton is not initialised or the board is not mapped.
+ **/
+extern void eo_jointmirror_Update(const EOnv* nv, const eOropdescriptor_t* rd);
+
+/** @fn         extern eOresult_t eo_jointmirror_Snapshot(eOTheJointMirror *p, uint8_t part, eOjointMirror_part_t *snapshot)
+    @brief      copies all the measures of a part, all taken between two updates of the part.
+    @return     eores_OK or eores_NOK_generic if part is out of range.
+ **/
+extern eOresult_t eo_jointmirror_Snapshot(eOTheJointMirror *p, uint8_t part, eOjointMirror_part_t *snapshot);
+
+
+/** @}
+    end of group eo_thejointmirror
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
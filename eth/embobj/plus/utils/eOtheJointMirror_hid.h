@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTHEJOINTMIRROR_HID_H_
+#define _EOTHEJOINTMIRROR_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOtheJointMirror_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoSeqlock.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOtheJointMirror.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+
+#define eo_jointmirror_maxboards        256
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    uint8_t                         part;           // 0xff if the board is not mapped
+    uint8_t                         firstjoint;
+    uint8_t                         numberofjoints;
+    uint8_t                         filler[1];
+} eOjointMirror_board_t;
+
+
+typedef struct
+{
+    eOjointMirror_part_t            data;           // first, so that it keeps the alignment given by the mempool
+    eOseqlock_t                     lock;
+} eOjointMirror_partitem_t;
+
+
+struct eOTheJointMirror_hid
+{
+    eObool_t                        initted;
+    uint8_t                         numberofparts;
+    eOjointMirror_partitem_t        *parts;
+    eOjointMirror_board_t           boards[eo_jointmirror_maxboards];
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
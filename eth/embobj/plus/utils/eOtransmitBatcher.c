@@ -0,0 +1,449 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOtransmitBatcher.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     // for sendmmsg(). it must come before any system header
+#endif
+
+#include "EoCommon.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "EOtransceiver.h"
+#include "EOpacket.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOtransmitBatcher.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOtransmitBatcher_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOtransmitBatcher_cfg_t eOtransmitBatcher_cfg_default =
+{
+    EO_INIT(.maxboards)         64,
+    EO_INIT(.slots)             1,
+    EO_INIT(.period)            1000,
+    EO_INIT(.socket)            -1,
+    EO_INIT(.localport)         0,
+    EO_INIT(.filler)            {0},
+    EO_INIT(.sink)              NULL,
+    EO_INIT(.arg)               NULL
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eotransmitBatcher_due(eOtransmitBatcher *p, uint32_t phase, uint64_t after);
+static void s_eotransmitBatcher_submit(eOtransmitBatcher *p, uint16_t number, uint64_t now);
+static void s_eotransmitBatcher_sleepuntil(eOtransmitBatcher *p, uint64_t time);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOtransmitBatcher * eOtransmitBatcher_New(const eOtransmitBatcher_cfg_t *cfg)
+{
+    eOtransmitBatcher *p = NULL;
+    struct sockaddr_in local;
+    size_t sizeofmsgs = 0;
+
+    if(NULL == cfg)
+    {
+        cfg = &eOtransmitBatcher_cfg_default;
+    }
+
+    if((0 == cfg->maxboards) || (cfg->maxboards > eOtransmitBatcher_maxboards) || (0 == cfg->period) || (0 == cfg->slots) || (cfg->slots > cfg->period))
+    {
+        return(NULL);
+    }
+
+    p = (eOtransmitBatcher*)calloc(1, sizeof(eOtransmitBatcher));
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    memcpy(&p->cfg, cfg, sizeof(eOtransmitBatcher_cfg_t));
+
+    sizeofmsgs = (size_t)cfg->maxboards * (sizeof(struct mmsghdr) + sizeof(struct iovec) + sizeof(struct sockaddr_in));
+    p->boards = (eOtransmitBatcher_board_t*)calloc(cfg->maxboards, sizeof(eOtransmitBatcher_board_t));
+    p->packets = (eOtransmitBatcher_packet_t*)calloc(cfg->maxboards, sizeof(eOtransmitBatcher_packet_t));
+    p->msgs = calloc(1, sizeofmsgs);
+    p->socket = -1;
+    p->ownsocket = eobool_false;
+
+    if((NULL == p->boards) || (NULL == p->packets) || (NULL == p->msgs))
+    {
+        eOtransmitBatcher_Delete(p);
+        return(NULL);
+    }
+
+    if(NULL != cfg->sink)
+    {
+        // the packets go to the sink
+    }
+    else if(cfg->socket >= 0)
+    {
+        p->socket = cfg->socket;
+    }
+    else
+    {
+        p->socket = socket(AF_INET, SOCK_DGRAM, 0);
+        p->ownsocket = eobool_true;
+
+        memset(&local, 0, sizeof(local));
+        local.sin_family = AF_INET;
+        local.sin_addr.s_addr = htonl(INADDR_ANY);
+        local.sin_port = htons(cfg->localport);
+        if((p->socket < 0) || (0 != bind(p->socket, (struct sockaddr*)&local, sizeof(local))))
+        {
+            eOtransmitBatcher_Delete(p);
+            return(NULL);
+        }
+    }
+
+    p->epoch = 0;
+    p->epoch = eOtransmitBatcher_Now(p);
+
+    return(p);
+}
+
+
+extern void eOtransmitBatcher_Delete(eOtransmitBatcher *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+    if((eobool_true == p->ownsocket) && (p->socket >= 0))
+    {
+        close(p->socket);
+    }
+    free(p->boards);
+    free(p->packets);
+    free(p->msgs);
+    free(p);
+}
+
+
+extern int32_t eOtransmitBatcher_Add(eOtransmitBatcher *p, EOhostTransceiver *transceiver)
+{
+    eOtransmitBatcher_board_t *board = NULL;
+    uint16_t index = 0;
+
+    if((NULL == p) || (NULL == transceiver) || (p->numberofboards >= p->cfg.maxboards))
+    {
+        return(-1);
+    }
+
+    index = p->numberofboards++;
+    board = &p->boards[index];
+    board->transceiver = transceiver;
+    board->phase = (index % p->cfg.slots) * (p->cfg.period / p->cfg.slots);
+    board->due = s_eotransmitBatcher_due(p, board->phase, eOtransmitBatcher_Now(p));
+
+    return(index);
+}
+
+
+extern eOresult_t eOtransmitBatcher_SetPhase(eOtransmitBatcher *p, uint16_t board, uint32_t phase)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if((board >= p->numberofboards) || (phase >= p->cfg.period))
+    {
+        return(eores_NOK_generic);
+    }
+
+    p->boards[board].phase = phase;
+    p->boards[board].due = s_eotransmitBatcher_due(p, phase, eOtransmitBatcher_Now(p));
+
+    return(eores_OK);
+}
+
+
+extern uint64_t eOtransmitBatcher_Now(eOtransmitBatcher *p)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL) - p->epoch + 1);
+}
+
+
+extern uint16_t eOtransmitBatcher_Transmit(eOtransmitBatcher *p, uint64_t now, uint64_t *next)
+{
+    uint16_t number = 0;
+    uint16_t i = 0;
+    uint64_t earliest = UINT64_MAX;
+
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        eOtransmitBatcher_board_t *board = &p->boards[i];
+
+        if(board->due <= now)
+        {
+            EOtransceiver *transceiver = eo_hosttransceiver_GetTransceiver(board->transceiver);
+            uint16_t numberofrops = 0;
+            eOtransmitter_ropsnumber_t ropsnum = {0};
+            EOpacket *pkt = NULL;
+
+            eo_transceiver_outpacket_Prepare(transceiver, &numberofrops, &ropsnum);
+
+            if((numberofrops > 0) && (eores_OK == eo_transceiver_outpacket_Get(transceiver, &pkt)))
+            {
+                eOtransmitBatcher_packet_t *packet = &p->packets[number++];
+                uint8_t *data = NULL;
+                eo_packet_Payload_Get(pkt, &data, &packet->size);
+                eo_packet_Addressing_Get(pkt, &packet->ipv4addr, &packet->ipv4port);
+                packet->data = data;
+                packet->board = i;
+
+                if((now - board->due) >= p->cfg.period)
+                {
+                    p->stats.late ++;
+                }
+            }
+
+            // the next time of the board is strictly after now: if we are late the missed periods are skipped
+            board->due = s_eotransmitBatcher_due(p, board->phase, now + 1);
+        }
+
+        if(board->due < earliest)
+        {
+            earliest = board->due;
+        }
+    }
+
+    if(number > 0)
+    {
+        s_eotransmitBatcher_submit(p, number, now);
+    }
+
+    if(NULL != next)
+    {
+        *next = earliest;
+    }
+
+    return(number);
+}
+
+
+extern uint32_t eOtransmitBatcher_RunCycle(eOtransmitBatcher *p)
+{
+    uint32_t total = 0;
+    uint64_t now = 0;
+    uint64_t next = 0;
+    uint64_t until = 0;
+
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    // every board is due within one period from now, so each of them is sent once before we return
+    now = eOtransmitBatcher_Now(p);
+    until = now + p->cfg.period;
+    for(;;)
+    {
+        total += eOtransmitBatcher_Transmit(p, now, &next);
+        if(next >= until)
+        {
+            break;
+        }
+        s_eotransmitBatcher_sleepuntil(p, next);
+        now = eOtransmitBatcher_Now(p);
+    }
+
+    return(total);
+}
+
+
+extern void eOtransmitBatcher_GetStats(eOtransmitBatcher *p, eOtransmitBatcher_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return;
+    }
+
+    memcpy(stats, &p->stats, sizeof(eOtransmitBatcher_stats_t));
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+// the first time not before after which is phase usec past the start of a period
+static uint64_t s_eotransmitBatcher_due(eOtransmitBatcher *p, uint32_t phase, uint64_t after)
+{
+    uint64_t t = after - (after % p->cfg.period) + phase;
+    if(t < after)
+    {
+        t += p->cfg.period;
+    }
+    return(t);
+}
+
+
+static void s_eotransmitBatcher_submit(eOtransmitBatcher *p, uint16_t number, uint64_t now)
+{
+    struct mmsghdr *msgs = (struct mmsghdr*)p->msgs;
+    struct iovec *iovs = (struct iovec*)&msgs[p->cfg.maxboards];
+    struct sockaddr_in *addrs = (struct sockaddr_in*)&iovs[p->cfg.maxboards];
+    uint16_t sent = 0;
+    uint16_t i = 0;
+
+    p->stats.packets += number;
+
+    if(NULL != p->cfg.sink)
+    {
+        p->cfg.sink(p->cfg.arg, p->packets, number, now);
+        p->stats.submissions ++;
+        return;
+    }
+
+    for(i=0; i<number; i++)
+    {
+        const eOtransmitBatcher_packet_t *packet = &p->packets[i];
+
+        memset(&addrs[i], 0, sizeof(struct sockaddr_in));
+        addrs[i].sin_family = AF_INET;
+        addrs[i].sin_addr.s_addr = packet->ipv4addr;   // eOipv4addr_t keeps the bytes in network order
+        addrs[i].sin_port = htons(packet->ipv4port);
+
+        iovs[i].iov_base = (void*)packet->data;
+        iovs[i].iov_len = packet->size;
+
+        memset(&msgs[i], 0, sizeof(struct mmsghdr));
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // sendmmsg() stops at the first packet it cannot send: we skip that one and go on with the others
+    while(sent < number)
+    {
+        int r = sendmmsg(p->socket, &msgs[sent], number - sent, 0);
+        p->stats.submissions ++;
+        if(r > 0)
+        {
+            sent += r;
+        }
+        else if((r < 0) && (EINTR == errno))
+        {
+            continue;
+        }
+        else
+        {
+            p->stats.failures ++;
+            sent ++;
+        }
+    }
+}
+
+
+static void s_eotransmitBatcher_sleepuntil(eOtransmitBatcher *p, uint64_t time)
+{
+    // the inverse of eOtransmitBatcher_Now()
+    uint64_t t = time + p->epoch - 1;
+    struct timespec abstime;
+    abstime.tv_sec = (time_t)(t / 1000000ULL);
+    abstime.tv_nsec = (long)((t % 1000000ULL) * 1000ULL);
+    while(EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &abstime, NULL))
+    {
+        ;
+    }
+}
+
+
+#endif // defined(EO_TAILOR_CODE_FOR_LINUX)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
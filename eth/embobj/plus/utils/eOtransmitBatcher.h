@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTRANSMITBATCHER_H_
+#define _EOTRANSMITBATCHER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOtransmitBatcher.h
+    @brief      host side stage which transmits the packets of many EOhostTransceiver with one system call
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eotransmitbatcher Object eOtransmitBatcher
+    The eOtransmitBatcher transmits every period the out packet of a set of EOhostTransceiver objects, one per ETH
+    board. Rather than one sendto() per board it gathers the packets which are due at the same time and submits them
+    with one sendmmsg().
+
+    The period is divided in cfg.slots slots, and board i is sent at the start of slot (i % slots) unless it has been
+    given its own phase with eOtransmitBatcher_SetPhase(). With one slot all the boards leave together, with more
+    slots the bursts towards the switch are spread along the period at the cost of one submission per slot.
+
+    The packets go to a UDP socket, either the one given in cfg.socket or one which the object opens on cfg.localport,
+    or to cfg.sink if it is not NULL. The sink receives each submission with its time, so that the schedule can be
+    verified without a network.
+
+    The object is single threaded: the thread which transmits calls eOtransmitBatcher_Transmit() at the returned
+    times, or eOtransmitBatcher_RunCycle() once per period. The EOhostTransceiver objects are protected by their own
+    transprotection against the threads which load the rops.
+
+    It is available only on linux.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EOhostTransceiver.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eOtransmitBatcher_maxboards         1024
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOtransmitBatcher_hid eOtransmitBatcher;
+
+
+typedef struct
+{
+    const uint8_t           *data;
+    uint16_t                size;
+    uint16_t                board;          /**< the index returned by eOtransmitBatcher_Add() */
+    eOipv4addr_t            ipv4addr;
+    eOipv4port_t            ipv4port;
+    uint8_t                 filler[2];
+} eOtransmitBatcher_packet_t;
+
+
+typedef void (*eOtransmitBatcher_fp_sink_t) (void *arg, const eOtransmitBatcher_packet_t *packets, uint16_t number, uint64_t time);
+
+
+typedef struct
+{
+    uint16_t                        maxboards;      /**< at most eOtransmitBatcher_maxboards */
+    uint16_t                        slots;          /**< the period is divided in slots. board i is sent in slot (i % slots) */
+    uint32_t                        period;         /**< in usec */
+    int32_t                         socket;         /**< if >= 0 the packets go out of this socket, which is not closed by the object */
+    uint16_t                        localport;      /**< if socket is < 0 the object opens one on this port. if 0 on any free port */
+    uint8_t                         filler[2];
+    eOtransmitBatcher_fp_sink_t     sink;           /**< if not NULL the packets go to it and not to a socket */
+    void                            *arg;
+} eOtransmitBatcher_cfg_t;
+
+
+typedef struct
+{
+    uint64_t                        packets;        /**< packets submitted */
+    uint64_t                        submissions;    /**< calls of sendmmsg() or of the sink */
+    uint64_t                        failures;       /**< packets which the socket has refused */
+    uint64_t                        late;           /**< packets sent more than one period after their time */
+} eOtransmitBatcher_stats_t;
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOtransmitBatcher_cfg_t eOtransmitBatcher_cfg_default; // = { 64, 1, 1000, -1, 0, {0}, NULL, NULL };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOtransmitBatcher * eOtransmitBatcher_New(const eOtransmitBatcher_cfg_t *cfg)
+    @brief      creates the object and, if it has neither a socket nor a sink, it opens its UDP socket.
+    @return     the object or NULL if the cfg is wrong or the socket cannot be opened.
+ **/
+extern eOtransmitBatcher * eOtransmitBatcher_New(const eOtransmitBatcher_cfg_t *cfg);
+
+extern void eOtransmitBatcher_Delete(eOtransmitBatcher *p);
+
+/** @fn         extern int32_t eOtransmitBatcher_Add(eOtransmitBatcher *p, EOhostTransceiver *transceiver)
+    @brief      adds a board. its first packet is sent at the start of its slot in the current period or, if it has
+                passed, in the next one.
+    @return     the index of the board or -1 if there is no room.
+ **/
+extern int32_t eOtransmitBatcher_Add(eOtransmitBatcher *p, EOhostTransceiver *transceiver);
+
+/** @fn         extern eOresult_t eOtransmitBatcher_SetPhase(eOtransmitBatcher *p, uint16_t board, uint32_t phase)
+    @brief      sends a board at phase usec after the start of the period, rather than at the start of its slot.
+                the boards with the same phase are sent with one submission.
+    @return     eores_OK or eores_NOK_generic if board or phase are out of range.
+ **/
+extern eOresult_t eOtransmitBatcher_SetPhase(eOtransmitBatcher *p, uint16_t board, uint32_t phase);
+
+/** @fn         extern uint64_t eOtransmitBatcher_Now(eOtransmitBatcher *p)
+    @brief      the time used by the object: usec since its creation.
+ **/
+extern uint64_t eOtransmitBatcher_Now(eOtransmitBatcher *p);
+
+/** @fn         extern uint16_t eOtransmitBatcher_Transmit(eOtransmitBatcher *p, uint64_t now, uint64_t *next)
+    @brief      prepares the packet of every board which is due at time now and submits them all together. the boards
+                with no rops to send are skipped for this period.
+    @param      now         the time as given by eOtransmitBatcher_Now()
+    @param      next        if not NULL it gets the time at which the next board is due
+    @return     the number of packets submitted.
+ **/
+extern uint16_t eOtransmitBatcher_Transmit(eOtransmitBatcher *p, uint64_t now, uint64_t *next);
+
+/** @fn         extern uint32_t eOtransmitBatcher_RunCycle(eOtransmitBatcher *p)
+    @brief      calls eOtransmitBatcher_Transmit() and sleeps until the next board is due for one period.
+    @return     the number of packets submitted.
+ **/
+extern uint32_t eOtransmitBatcher_RunCycle(eOtransmitBatcher *p);
+
+extern void eOtransmitBatcher_GetStats(eOtransmitBatcher *p, eOtransmitBatcher_stats_t *stats);
+
+
+/** @}
+    end of group eotransmitbatcher
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
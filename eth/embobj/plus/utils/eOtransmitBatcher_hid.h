@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOTRANSMITBATCHER_HID_H_
+#define _EOTRANSMITBATCHER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOtransmitBatcher_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOtransmitBatcher.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    EOhostTransceiver               *transceiver;
+    uint32_t                        phase;          // usec after the start of the period
+    uint8_t                         filler[4];
+    uint64_t                        due;            // the next time at which it must be sent
+} eOtransmitBatcher_board_t;
+
+
+struct eOtransmitBatcher_hid
+{
+    eOtransmitBatcher_cfg_t         cfg;
+    int                             socket;
+    eObool_t                        ownsocket;
+    uint64_t                        epoch;
+    eOtransmitBatcher_board_t       *boards;        // maxboards
+    uint16_t                        numberofboards;
+    // the submission in progress: maxboards items each
+    eOtransmitBatcher_packet_t      *packets;
+    void                            *msgs;          // the struct mmsghdr, then the struct iovec and the struct sockaddr_in
+    eOtransmitBatcher_stats_t       stats;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
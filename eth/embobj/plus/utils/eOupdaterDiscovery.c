@@ -0,0 +1,825 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOupdaterDiscovery.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include "stddef.h"
+
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "EoUpdaterProtocol.h"
+#include "EoBoards.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterDiscovery.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterDiscovery_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOupdaterDiscovery_cfg_t eOupdaterDiscovery_cfg_default =
+{
+    EO_INIT(.localport)         0,
+    EO_INIT(.remoteport)        3333,
+    EO_INIT(.broadcast)         EO_COMMON_IPV4ADDR(10, 0, 1, 255),
+    EO_INIT(.timeout)           1000000,
+    EO_INIT(.maxboards)         256,
+    EO_INIT(.discover2)         0,
+    EO_INIT(.moreinfo)          1,
+    EO_INIT(.jump2updater)      0,
+    EO_INIT(.filler)            {0},
+    EO_INIT(.onboard)           NULL,
+    EO_INIT(.arg)               NULL
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eoupdaterDiscovery_now(eOupdaterDiscovery *p);
+static void s_eoupdaterDiscovery_send(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr, const void *data, uint16_t size);
+static void s_eoupdaterDiscovery_send_discover(eOupdaterDiscovery *p, eObool_t onlymissing);
+static void s_eoupdaterDiscovery_send_moreinfo(eOupdaterDiscovery *p, eOupdaterDiscovery_entry_t *entry, uint64_t now);
+static void s_eoupdaterDiscovery_parse(eOupdaterDiscovery *p, eOipv4addr_t from, const uint8_t *data, uint16_t size, uint64_t now);
+static void s_eoupdaterDiscovery_fill(eOupdaterDiscovery_board_t *board, const eOuprot_cmd_DISCOVER_REPLY_t *reply);
+static void s_eoupdaterDiscovery_seen(eOupdaterDiscovery *p, eOupdaterDiscovery_entry_t *entry, eOipv4addr_t from, eObool_t isnew, uint64_t now);
+static eOupdaterDiscovery_entry_t * s_eoupdaterDiscovery_get(eOupdaterDiscovery *p, eOmacaddr_t mac, eObool_t *isnew);
+static eOupdaterDiscovery_entry_t * s_eoupdaterDiscovery_findip(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr);
+static eObool_t s_eoupdaterDiscovery_alltargets(eOupdaterDiscovery *p);
+static uint64_t s_eoupdaterDiscovery_nextevent(eOupdaterDiscovery *p);
+static uint32_t s_eoupdaterDiscovery_hash(eOmacaddr_t mac, uint32_t tablesize);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOupdaterDiscovery * eOupdaterDiscovery_New(const eOupdaterDiscovery_cfg_t *cfg)
+{
+    eOupdaterDiscovery *p = NULL;
+    struct sockaddr_in local;
+    int enable = 1;
+
+    if(NULL == cfg)
+    {
+        cfg = &eOupdaterDiscovery_cfg_default;
+    }
+
+    if(0 == cfg->maxboards)
+    {
+        return(NULL);
+    }
+
+    p = (eOupdaterDiscovery*)calloc(1, sizeof(eOupdaterDiscovery));
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    memcpy(&p->cfg, cfg, sizeof(eOupdaterDiscovery_cfg_t));
+
+    // the table is at most half full, so that the probes are short
+    p->tablesize = 1;
+    while(p->tablesize < 2*(uint32_t)cfg->maxboards)
+    {
+        p->tablesize <<= 1;
+    }
+
+    p->entries = (eOupdaterDiscovery_entry_t*)calloc(cfg->maxboards, sizeof(eOupdaterDiscovery_entry_t));
+    p->table = (uint16_t*)calloc(p->tablesize, sizeof(uint16_t));
+    p->socket = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if((NULL == p->entries) || (NULL == p->table) || (p->socket < 0))
+    {
+        if(p->socket >= 0)
+        {
+            close(p->socket);
+        }
+        free(p->entries);
+        free(p->table);
+        free(p);
+        return(NULL);
+    }
+
+    setsockopt(p->socket, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(cfg->localport);
+    if(0 != bind(p->socket, (struct sockaddr*)&local, sizeof(local)))
+    {
+        close(p->socket);
+        free(p->entries);
+        free(p->table);
+        free(p);
+        return(NULL);
+    }
+
+    p->epoch = 0;
+    p->epoch = s_eoupdaterDiscovery_now(p);
+
+    return(p);
+}
+
+
+extern void eOupdaterDiscovery_Delete(eOupdaterDiscovery *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+    close(p->socket);
+    free(p->entries);
+    free(p->table);
+    free(p);
+}
+
+
+extern eOresult_t eOupdaterDiscovery_Start(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof)
+{
+    uint16_t i = 0;
+
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_true == p->running)
+    {
+        return(eores_NOK_busy);
+    }
+
+    if(NULL == targets)
+    {
+        numberof = 0;
+    }
+    if(numberof > eOupdaterDiscovery_maxtargets)
+    {
+        numberof = eOupdaterDiscovery_maxtargets;
+    }
+    if(numberof > 0)
+    {
+        memcpy(p->targets, targets, numberof*sizeof(eOipv4addr_t));
+    }
+    p->numberoftargets = numberof;
+
+    for(i=0; i<p->numberofentries; i++)
+    {
+        p->entries[i].moreinfosent = 0;
+        p->entries[i].moreinforesent = 0;
+    }
+
+    p->sweep++;
+    p->running = eobool_true;
+    p->resent = eobool_false;
+    p->starttime = s_eoupdaterDiscovery_now(p);
+    p->deadline = p->starttime + p->cfg.timeout;
+
+    s_eoupdaterDiscovery_send_discover(p, eobool_false);
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eOupdaterDiscovery_Poll(eOupdaterDiscovery *p, uint32_t wait)
+{
+    uint16_t i = 0;
+    uint64_t now = 0;
+    uint64_t half = 0;
+    uint64_t next = 0;
+
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_false == p->running)
+    {
+        return(eores_OK);
+    }
+
+    now = s_eoupdaterDiscovery_now(p);
+    next = s_eoupdaterDiscovery_nextevent(p);
+    if((now + wait) > next)
+    {
+        wait = (now >= next) ? (0) : (uint32_t)(next - now);
+    }
+
+    struct pollfd pfd = { p->socket, POLLIN, 0 };
+    if(poll(&pfd, 1, (int)((wait + 999) / 1000)) > 0)
+    {
+        for(;;)
+        {
+            uint8_t rxdata[uprot_UDPmaxsize];
+            struct sockaddr_in from;
+            socklen_t fromlen = sizeof(from);
+            ssize_t n = recvfrom(p->socket, rxdata, sizeof(rxdata), MSG_DONTWAIT, (struct sockaddr*)&from, &fromlen);
+            if(n <= 0)
+            {
+                break;
+            }
+            if(p->cfg.remoteport == ntohs(from.sin_port))
+            {
+                s_eoupdaterDiscovery_parse(p, from.sin_addr.s_addr, rxdata, (uint16_t)n, s_eoupdaterDiscovery_now(p));
+            }
+        }
+    }
+
+    now = s_eoupdaterDiscovery_now(p);
+    half = p->cfg.timeout / 2;
+
+    // at half timeout we send again what has not been replied
+    if((eobool_false == p->resent) && (now >= (p->starttime + half)))
+    {
+        p->resent = eobool_true;
+        s_eoupdaterDiscovery_send_discover(p, eobool_true);
+    }
+
+    for(i=0; i<p->numberofentries; i++)
+    {
+        eOupdaterDiscovery_entry_t *entry = &p->entries[i];
+        if((0 == entry->moreinfosent) || (p->sweep == entry->moreinfosweep))
+        {
+            continue;
+        }
+        if((0 == entry->moreinforesent) && (now >= (entry->moreinfosent + half)))
+        {
+            entry->moreinforesent = 1;
+            s_eoupdaterDiscovery_send_moreinfo(p, entry, now);
+        }
+    }
+
+    if((now >= p->deadline) || (eobool_true == s_eoupdaterDiscovery_alltargets(p)))
+    {
+        p->running = eobool_false;
+        return(eores_OK);
+    }
+
+    return(eores_NOK_busy);
+}
+
+
+extern eOresult_t eOupdaterDiscovery_Sweep(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof)
+{
+    eOresult_t res = eOupdaterDiscovery_Start(p, targets, numberof);
+
+    if(eores_OK != res)
+    {
+        return(res);
+    }
+
+    while(eores_NOK_busy == (res = eOupdaterDiscovery_Poll(p, p->cfg.timeout)))
+    {
+    }
+
+    return(res);
+}
+
+
+extern uint32_t eOupdaterDiscovery_CurrentSweep(eOupdaterDiscovery *p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    return(p->sweep);
+}
+
+
+extern uint16_t eOupdaterDiscovery_NumberOfBoards(eOupdaterDiscovery *p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    return(p->numberofentries);
+}
+
+
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_GetBoard(eOupdaterDiscovery *p, uint16_t index)
+{
+    if((NULL == p) || (index >= p->numberofentries))
+    {
+        return(NULL);
+    }
+
+    return(&p->entries[index].board);
+}
+
+
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_FindByMAC(eOupdaterDiscovery *p, eOmacaddr_t mac)
+{
+    uint32_t h = 0;
+
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    h = s_eoupdaterDiscovery_hash(mac, p->tablesize);
+    while(0 != p->table[h])
+    {
+        eOupdaterDiscovery_entry_t *entry = &p->entries[p->table[h]-1];
+        if(mac == entry->board.mac)
+        {
+            return(&entry->board);
+        }
+        h = (h + 1) & (p->tablesize - 1);
+    }
+
+    return(NULL);
+}
+
+
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_FindByIP(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr)
+{
+    eOupdaterDiscovery_entry_t *entry = NULL;
+
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    entry = s_eoupdaterDiscovery_findip(p, ipv4addr);
+
+    return((NULL == entry) ? (NULL) : (&entry->board));
+}
+
+
+extern eOresult_t eOupdaterDiscovery_Clear(eOupdaterDiscovery *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_true == p->running)
+    {
+        return(eores_NOK_busy);
+    }
+
+    memset(p->entries, 0, p->cfg.maxboards*sizeof(eOupdaterDiscovery_entry_t));
+    memset(p->table, 0, p->tablesize*sizeof(uint16_t));
+    p->numberofentries = 0;
+
+    return(eores_OK);
+}
+
+
+extern void eOupdaterDiscovery_Describe(const eOupdaterDiscovery_board_t *board, char *str, uint16_t size)
+{
+    char ip[20] = {0};
+    uint16_t used = 0;
+    uint8_t i = 0;
+    uint64_t m = 0;
+
+    if((NULL == board) || (NULL == str) || (0 == size))
+    {
+        return;
+    }
+
+    m = board->mac;
+    eo_common_ipv4addr_to_string(board->ipv4addr, ip, sizeof(ip));
+
+    if(1 == board->legacy)
+    {
+        snprintf(str, size, "%s legacy mac %02X:%02X:%02X:%02X:%02X:%02X running v%d.%d",
+                 ip, (uint8_t)(m), (uint8_t)(m >> 8), (uint8_t)(m >> 16), (uint8_t)(m >> 24), (uint8_t)(m >> 32), (uint8_t)(m >> 40),
+                 board->legacyversion.major, board->legacyversion.minor);
+        return;
+    }
+
+    used = snprintf(str, size, "%s %s mac %02X:%02X:%02X:%02X:%02X:%02X prot %d running %s startup %s def2run %s",
+                    ip, eoboards_type2string((eObrd_type_t)board->boardtype),
+                    (uint8_t)(m), (uint8_t)(m >> 8), (uint8_t)(m >> 16), (uint8_t)(m >> 24), (uint8_t)(m >> 32), (uint8_t)(m >> 40),
+                    board->protversion,
+                    eouprot_process2string((eOuprot_process_t)board->processes.runningnow),
+                    eouprot_process2string((eOuprot_process_t)board->processes.startup),
+                    eouprot_process2string((eOuprot_process_t)board->processes.def2run));
+
+    for(i=0; (i<board->processes.numberofthem) && (i<3) && (used < size); i++)
+    {
+        const eOuprot_procinfo_t *info = &board->processes.info[i];
+        used += snprintf(&str[used], size - used, " | %s v%d.%d", eouprot_process2string((eOuprot_process_t)info->type), info->version.major, info->version.minor);
+    }
+    for(i=0; (i<board->numberofextraprocs) && (used < size); i++)
+    {
+        const eOuprot_procinfo_t *info = &board->extraprocs[i];
+        used += snprintf(&str[used], size - used, " | %s v%d.%d", eouprot_process2string((eOuprot_process_t)info->type), info->version.major, info->version.minor);
+    }
+    if((0 != board->boardinfo[0]) && (used < size))
+    {
+        snprintf(&str[used], size - used, " | %s", board->boardinfo);
+    }
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eoupdaterDiscovery_now(eOupdaterDiscovery *p)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL) - p->epoch + 1);
+}
+
+
+static void s_eoupdaterDiscovery_send(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr, const void *data, uint16_t size)
+{
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = ipv4addr;      // eOipv4addr_t keeps the bytes in network order
+    to.sin_port = htons(p->cfg.remoteport);
+    sendto(p->socket, data, size, 0, (struct sockaddr*)&to, sizeof(to));
+}
+
+
+static void s_eoupdaterDiscovery_send_discover(eOupdaterDiscovery *p, eObool_t onlymissing)
+{
+    uint16_t i = 0;
+    eOuprot_cmd_DISCOVER_t cmd;
+
+    cmd.opc = uprot_OPC_LEGACY_SCAN;
+    cmd.opc2 = (1 == p->cfg.discover2) ? (uprot_OPC_DISCOVER2) : (uprot_OPC_DISCOVER);
+    cmd.jump2updater = p->cfg.jump2updater;
+    cmd.filler1[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+
+    if(0 == p->numberoftargets)
+    {
+        s_eoupdaterDiscovery_send(p, p->cfg.broadcast, &cmd, sizeof(cmd));
+        return;
+    }
+
+    for(i=0; i<p->numberoftargets; i++)
+    {
+        if(eobool_true == onlymissing)
+        {
+            eOupdaterDiscovery_entry_t *entry = s_eoupdaterDiscovery_findip(p, p->targets[i]);
+            if((NULL != entry) && (p->sweep == entry->board.sweep))
+            {
+                continue;
+            }
+        }
+        s_eoupdaterDiscovery_send(p, p->targets[i], &cmd, sizeof(cmd));
+    }
+}
+
+
+static void s_eoupdaterDiscovery_send_moreinfo(eOupdaterDiscovery *p, eOupdaterDiscovery_entry_t *entry, uint64_t now)
+{
+    eOuprot_cmd_MOREINFO_t cmd;
+
+    cmd.opc = uprot_OPC_LEGACY_PROCS;
+    cmd.opc2 = uprot_OPC_MOREINFO;
+    cmd.plusdescription = 1;
+    cmd.jump2updater = p->cfg.jump2updater;
+    s_eoupdaterDiscovery_send(p, entry->board.ipv4addr, &cmd, sizeof(cmd));
+
+    if(0 == entry->moreinfosent)
+    {
+        entry->moreinfosent = now;
+        // a board found late keeps the sweep open for its MOREINFO, but for no more than half timeout
+        if(p->deadline < (now + p->cfg.timeout/2))
+        {
+            p->deadline = now + p->cfg.timeout/2;
+        }
+    }
+}
+
+
+static void s_eoupdaterDiscovery_parse(eOupdaterDiscovery *p, eOipv4addr_t from, const uint8_t *data, uint16_t size, uint64_t now)
+{
+    eOupdaterDiscovery_entry_t *entry = NULL;
+    eObool_t isnew = eobool_false;
+
+    if(0 == size)
+    {
+        return;
+    }
+
+    if((uprot_OPC_LEGACY_SCAN == data[0]) && (sizeof(eOuprot_cmd_LEGACY_SCAN_REPLY_t) == size))
+    {
+        const eOuprot_cmd_LEGACY_SCAN_REPLY_t *reply = (const eOuprot_cmd_LEGACY_SCAN_REPLY_t*)data;
+        const uint8_t *m = reply->mac48;
+        entry = s_eoupdaterDiscovery_get(p, EO_COMMON_MACADDR(m[0], m[1], m[2], m[3], m[4], m[5]), &isnew);
+        if(NULL == entry)
+        {
+            return;
+        }
+        entry->board.legacy = 1;
+        entry->board.protversion = 0;
+        entry->board.capabilities = uprot_canDO_LEGACY_scan | uprot_canDO_LEGACY_procs;
+        entry->board.legacyversion = reply->version;
+        s_eoupdaterDiscovery_seen(p, entry, from, isnew, now);
+    }
+    else if(((uprot_OPC_DISCOVER == data[0]) || (uprot_OPC_DISCOVER2 == data[0])) && (size >= sizeof(eOuprot_cmd_DISCOVER_REPLY_t)))
+    {
+        const eOuprot_cmd_DISCOVER_REPLY_t *reply = (const eOuprot_cmd_DISCOVER_REPLY_t*)data;
+        const uint8_t *m = reply->mac48;
+        uint8_t i = 0;
+        entry = s_eoupdaterDiscovery_get(p, EO_COMMON_MACADDR(m[0], m[1], m[2], m[3], m[4], m[5]), &isnew);
+        if(NULL == entry)
+        {
+            return;
+        }
+        s_eoupdaterDiscovery_fill(&entry->board, reply);
+        if(size >= sizeof(eOuprot_cmd_DISCOVER_REPLY2_t))
+        {
+            const eOuprot_cmd_DISCOVER_REPLY2_t *reply2 = (const eOuprot_cmd_DISCOVER_REPLY2_t*)data;
+            entry->board.numberofextraprocs = 0;
+            for(i=0; i<2; i++)
+            {
+                if(uprot_proc_None != reply2->extraprocs[i].type)
+                {
+                    entry->board.extraprocs[entry->board.numberofextraprocs++] = reply2->extraprocs[i];
+                }
+            }
+        }
+        s_eoupdaterDiscovery_seen(p, entry, from, isnew, now);
+    }
+    else if((uprot_OPC_MOREINFO == data[0]) && (size >= sizeof(eOuprot_cmd_MOREINFO_REPLY_t)))
+    {
+        const eOuprot_cmd_MOREINFO_REPLY_t *reply = (const eOuprot_cmd_MOREINFO_REPLY_t*)data;
+        const uint8_t *m = reply->discover.mac48;
+        uint16_t offset = offsetof(eOuprot_cmd_MOREINFO_REPLY_t, description);
+        uint16_t len = 0;
+        entry = s_eoupdaterDiscovery_get(p, EO_COMMON_MACADDR(m[0], m[1], m[2], m[3], m[4], m[5]), &isnew);
+        if(NULL == entry)
+        {
+            return;
+        }
+        s_eoupdaterDiscovery_fill(&entry->board, &reply->discover);
+        entry->board.description[0] = 0;
+        if(1 == reply->hasdescription)
+        {
+            len = size - offset;
+            if(len >= uprot_TEXTmaxsize)
+            {
+                len = uprot_TEXTmaxsize - 1;
+            }
+            memcpy(entry->board.description, &data[offset], len);
+            entry->board.description[len] = 0;
+        }
+        entry->board.hasmoreinfo = 1;
+        entry->moreinfosweep = p->sweep;
+        s_eoupdaterDiscovery_seen(p, entry, from, isnew, now);
+    }
+    else if((uprot_OPC_LEGACY_PROCS == data[0]) && (size > 2))
+    {   // it does not contain the mac: we can only use the address
+        uint16_t offset = offsetof(eOuprot_cmd_LEGACY_PROCS_REPLY_t, description);
+        uint16_t len = size - offset;
+        entry = s_eoupdaterDiscovery_findip(p, from);
+        if(NULL == entry)
+        {
+            return;
+        }
+        if(len >= uprot_TEXTmaxsize)
+        {
+            len = uprot_TEXTmaxsize - 1;
+        }
+        memcpy(entry->board.description, &data[offset], len);
+        entry->board.description[len] = 0;
+        entry->board.hasmoreinfo = 1;
+        entry->moreinfosweep = p->sweep;
+        s_eoupdaterDiscovery_seen(p, entry, from, eobool_false, now);
+    }
+}
+
+
+static void s_eoupdaterDiscovery_fill(eOupdaterDiscovery_board_t *board, const eOuprot_cmd_DISCOVER_REPLY_t *reply)
+{
+    uint8_t len = reply->boardinfo32[0];
+
+    board->legacy = 0;
+    board->protversion = reply->reply.protversion;
+    board->boardtype = reply->boardtype;
+    board->capabilities = reply->capabilities;
+    memcpy(&board->processes, &reply->processes, sizeof(eOuprot_proctable_t));
+
+    board->boardinfo[0] = 0;
+    if(255 != len)
+    {
+        if(len > 31)
+        {
+            len = 31;
+        }
+        memcpy(board->boardinfo, &reply->boardinfo32[1], len);
+        board->boardinfo[len] = 0;
+    }
+}
+
+
+static void s_eoupdaterDiscovery_seen(eOupdaterDiscovery *p, eOupdaterDiscovery_entry_t *entry, eOipv4addr_t from, eObool_t isnew, uint64_t now)
+{
+    entry->board.ipv4addr = from;
+    entry->board.sweep = p->sweep;
+    entry->board.lastseen = now;
+
+    if((eobool_true == p->running) && (1 == p->cfg.moreinfo) && (0 == entry->moreinfosent) && (p->sweep != entry->moreinfosweep))
+    {
+        s_eoupdaterDiscovery_send_moreinfo(p, entry, now);
+    }
+
+    if(NULL != p->cfg.onboard)
+    {
+        p->cfg.onboard(p->cfg.arg, &entry->board, isnew);
+    }
+}
+
+
+static eOupdaterDiscovery_entry_t * s_eoupdaterDiscovery_get(eOupdaterDiscovery *p, eOmacaddr_t mac, eObool_t *isnew)
+{
+    uint32_t h = s_eoupdaterDiscovery_hash(mac, p->tablesize);
+    eOupdaterDiscovery_entry_t *entry = NULL;
+
+    *isnew = eobool_false;
+
+    while(0 != p->table[h])
+    {
+        entry = &p->entries[p->table[h]-1];
+        if(mac == entry->board.mac)
+        {
+            return(entry);
+        }
+        h = (h + 1) & (p->tablesize - 1);
+    }
+
+    if(p->numberofentries >= p->cfg.maxboards)
+    {
+        return(NULL);
+    }
+
+    entry = &p->entries[p->numberofentries++];
+    memset(entry, 0, sizeof(eOupdaterDiscovery_entry_t));
+    entry->board.mac = mac;
+    p->table[h] = p->numberofentries;
+    *isnew = eobool_true;
+
+    return(entry);
+}
+
+
+static eOupdaterDiscovery_entry_t * s_eoupdaterDiscovery_findip(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr)
+{
+    uint16_t i = 0;
+    eOupdaterDiscovery_entry_t *found = NULL;
+
+    // a board may have changed its address: the most recently seen one wins
+    for(i=0; i<p->numberofentries; i++)
+    {
+        eOupdaterDiscovery_entry_t *entry = &p->entries[i];
+        if((ipv4addr == entry->board.ipv4addr) && ((NULL == found) || (entry->board.lastseen > found->board.lastseen)))
+        {
+            found = entry;
+        }
+    }
+
+    return(found);
+}
+
+
+static eObool_t s_eoupdaterDiscovery_alltargets(eOupdaterDiscovery *p)
+{
+    uint16_t i = 0;
+
+    if(0 == p->numberoftargets)
+    {   // in broadcast we cannot know how many boards are there
+        return(eobool_false);
+    }
+
+    for(i=0; i<p->numberoftargets; i++)
+    {
+        eOupdaterDiscovery_entry_t *entry = s_eoupdaterDiscovery_findip(p, p->targets[i]);
+        if((NULL == entry) || (p->sweep != entry->board.sweep))
+        {
+            return(eobool_false);
+        }
+        if((1 == p->cfg.moreinfo) && (p->sweep != entry->moreinfosweep))
+        {
+            return(eobool_false);
+        }
+    }
+
+    return(eobool_true);
+}
+
+
+static uint64_t s_eoupdaterDiscovery_nextevent(eOupdaterDiscovery *p)
+{   // the earliest among the deadline and the retransmissions
+    uint16_t i = 0;
+    uint64_t half = p->cfg.timeout / 2;
+    uint64_t next = p->deadline;
+
+    if((eobool_false == p->resent) && ((p->starttime + half) < next))
+    {
+        next = p->starttime + half;
+    }
+
+    for(i=0; i<p->numberofentries; i++)
+    {
+        const eOupdaterDiscovery_entry_t *entry = &p->entries[i];
+        if((0 != entry->moreinfosent) && (0 == entry->moreinforesent) && (p->sweep != entry->moreinfosweep) && ((entry->moreinfosent + half) < next))
+        {
+            next = entry->moreinfosent + half;
+        }
+    }
+
+    return(next);
+}
+
+
+static uint32_t s_eoupdaterDiscovery_hash(eOmacaddr_t mac, uint32_t tablesize)
+{
+    // fibonacci hashing: the mac of the boards differ mostly in the last bytes
+    uint64_t h = mac * 0x9E3779B97F4A7C15ULL;
+    return((uint32_t)(h >> 32) & (tablesize - 1));
+}
+
+
+#endif // defined(EO_TAILOR_CODE_FOR_LINUX)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
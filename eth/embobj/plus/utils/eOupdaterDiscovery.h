@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOUPDATERDISCOVERY_H_
+#define _EOUPDATERDISCOVERY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOupdaterDiscovery.h
+    @brief      host side engine which discovers the ETH boards and keeps their inventory
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eoupdaterdiscovery Object eOupdaterDiscovery
+    The eOupdaterDiscovery finds the ETH boards with the commands DISCOVER (or DISCOVER2) and MOREINFO of the
+    EoUpdaterProtocol and keeps an inventory of them.
+    A sweep sends the discover in broadcast (or in unicast to a list of targets) all at once and then collects the
+    replies for one timeout. Every board which replies is immediately asked MOREINFO, so that the description arrives
+    inside the same window. At half timeout the discover is sent again to the targets which have not replied yet and
+    MOREINFO is sent again to the boards which have not replied to it. Hence the sweep of any number of boards lasts
+    about one timeout, and less if all the targets have replied.
+
+    The boards are identified by their MAC, so a board which replies more than once (or with a new IP address) has
+    only one entry. The inventory is kept between sweeps: an entry is refreshed when the board replies, and the field
+    sweep of eOupdaterDiscovery_board_t tells the last sweep in which it has replied.
+    Legacy boards reply to the discover with eOuprot_cmd_LEGACY_SCAN_REPLY_t and to MOREINFO with
+    eOuprot_cmd_LEGACY_PROCS_REPLY_t: they are kept in the inventory with legacy = 1 and with the text they send.
+
+    The engine is single threaded: eOupdaterDiscovery_Start() sends the discover and returns, then
+    eOupdaterDiscovery_Poll() must be called until it returns eores_OK. eOupdaterDiscovery_Sweep() does both.
+
+    It is available only on linux.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoUpdaterProtocol.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eOupdaterDiscovery_maxtargets       256
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOupdaterDiscovery_hid eOupdaterDiscovery;
+
+
+typedef struct
+{
+    eOipv4addr_t            ipv4addr;
+    eOmacaddr_t             mac;                /**< as EO_COMMON_MACADDR(mac48[0], ..., mac48[5]) */
+    uint8_t                 boardtype;          /**< use eObrd_type_t */
+    uint8_t                 protversion;        /**< the EOUPROT_PROTOCOL_VERSION of the board. 0 if legacy */
+    uint8_t                 legacy;             /**< 1 if the board has replied with the legacy commands */
+    uint8_t                 hasmoreinfo;        /**< 1 if the reply to MOREINFO has been received */
+    uint32_t                capabilities;       /**< mask of eOuprot_proc_capabilities_t */
+    eOversion_t             legacyversion;      /**< only for legacy boards: the version of the running process */
+    uint8_t                 numberofextraprocs;
+    uint8_t                 filler[1];
+    eOuprot_proctable_t     processes;
+    eOuprot_procinfo_t      extraprocs[2];      /**< only for boards which reply to DISCOVER2 */
+    char                    boardinfo[32];      /**< null terminated */
+    uint32_t                sweep;              /**< the last sweep in which the board has replied */
+    uint64_t                lastseen;           /**< in usec since the creation of the object */
+    char                    description[uprot_TEXTmaxsize]; /**< the text in the reply to MOREINFO, null terminated */
+} eOupdaterDiscovery_board_t;
+
+
+typedef void (*eOupdaterDiscovery_fp_onboard_t) (void *arg, const eOupdaterDiscovery_board_t *board, eObool_t isnew);
+
+
+typedef struct
+{
+    uint16_t                        localport;      /**< the local UDP port. if 0 any free port is used */
+    uint16_t                        remoteport;     /**< the UDP port of the boards. it typically is 3333 */
+    eOipv4addr_t                    broadcast;      /**< the address used when a sweep has no targets */
+    uint32_t                        timeout;        /**< in usec: the duration of a sweep */
+    uint16_t                        maxboards;      /**< the capacity of the inventory */
+    uint8_t                         discover2;      /**< if 1 the sweep uses DISCOVER2, which also gives the extra processes */
+    uint8_t                         moreinfo;       /**< if 1 every board which replies is asked MOREINFO with description */
+    uint8_t                         jump2updater;   /**< the value of jump2updater in DISCOVER and MOREINFO */
+    uint8_t                         filler[3];
+    eOupdaterDiscovery_fp_onboard_t onboard;        /**< if not NULL it is called every time the entry of a board changes */
+    void                            *arg;
+} eOupdaterDiscovery_cfg_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOupdaterDiscovery_cfg_t eOupdaterDiscovery_cfg_default; // = { 0, 3333, 10.0.1.255, 1000000, 256, 0, 1, 0, {0}, NULL, NULL };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOupdaterDiscovery * eOupdaterDiscovery_New(const eOupdaterDiscovery_cfg_t *cfg)
+    @brief      creates the object and its UDP socket, which is enabled to broadcast.
+    @return     the object or NULL if the socket cannot be opened.
+ **/
+extern eOupdaterDiscovery * eOupdaterDiscovery_New(const eOupdaterDiscovery_cfg_t *cfg);
+
+extern void eOupdaterDiscovery_Delete(eOupdaterDiscovery *p);
+
+/** @fn         extern eOresult_t eOupdaterDiscovery_Start(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof)
+    @brief      starts a sweep. it sends the discover to the targets or, if targets is NULL, to cfg.broadcast.
+    @return     eores_OK, or eores_NOK_busy if a sweep is in progress.
+ **/
+extern eOresult_t eOupdaterDiscovery_Start(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof);
+
+/** @fn         extern eOresult_t eOupdaterDiscovery_Poll(eOupdaterDiscovery *p, uint32_t wait)
+    @brief      processes the replies which arrive in at most wait usec and sends the MOREINFO and the retransmissions.
+    @return     eores_OK if the sweep is over, eores_NOK_busy if it is in progress.
+ **/
+extern eOresult_t eOupdaterDiscovery_Poll(eOupdaterDiscovery *p, uint32_t wait);
+
+/** @fn         extern eOresult_t eOupdaterDiscovery_Sweep(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof)
+    @brief      it is Start() followed by Poll() until the sweep is over.
+ **/
+extern eOresult_t eOupdaterDiscovery_Sweep(eOupdaterDiscovery *p, const eOipv4addr_t *targets, uint16_t numberof);
+
+/** @fn         extern uint32_t eOupdaterDiscovery_CurrentSweep(eOupdaterDiscovery *p)
+    @brief      the number of the last sweep started. the boards with the same value in field sweep have replied to it.
+ **/
+extern uint32_t eOupdaterDiscovery_CurrentSweep(eOupdaterDiscovery *p);
+
+extern uint16_t eOupdaterDiscovery_NumberOfBoards(eOupdaterDiscovery *p);
+
+/** @fn         extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_GetBoard(eOupdaterDiscovery *p, uint16_t index)
+    @brief      gives a board of the inventory. the boards are kept in order of discovery.
+ **/
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_GetBoard(eOupdaterDiscovery *p, uint16_t index);
+
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_FindByMAC(eOupdaterDiscovery *p, eOmacaddr_t mac);
+
+extern const eOupdaterDiscovery_board_t * eOupdaterDiscovery_FindByIP(eOupdaterDiscovery *p, eOipv4addr_t ipv4addr);
+
+/** @fn         extern eOresult_t eOupdaterDiscovery_Clear(eOupdaterDiscovery *p)
+    @brief      empties the inventory. it cannot be called during a sweep.
+ **/
+extern eOresult_t eOupdaterDiscovery_Clear(eOupdaterDiscovery *p);
+
+/** @fn         extern void eOupdaterDiscovery_Describe(const eOupdaterDiscovery_board_t *board, char *str, uint16_t size)
+    @brief      writes in str one line with ip, board type, mac and the process table of the board.
+ **/
+extern void eOupdaterDiscovery_Describe(const eOupdaterDiscovery_board_t *board, char *str, uint16_t size);
+
+
+/** @}
+    end of group eoupdaterdiscovery
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOUPDATERDISCOVERY_HID_H_
+#define _EOUPDATERDISCOVERY_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOupdaterDiscovery_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOupdaterDiscovery.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef struct
+{
+    eOupdaterDiscovery_board_t      board;
+    uint32_t                        moreinfosweep;  // the sweep in which MOREINFO was replied
+    uint64_t                        moreinfosent;   // time of the first MOREINFO in the current sweep, 0 if not sent
+    uint8_t                         moreinforesent;
+    uint8_t                         filler[7];
+} eOupdaterDiscovery_entry_t;
+
+
+struct eOupdaterDiscovery_hid
+{
+    eOupdaterDiscovery_cfg_t        cfg;
+    int                             socket;
+    uint64_t                        epoch;
+    eOupdaterDiscovery_entry_t      *entries;       // maxboards, in order of discovery
+    uint16_t                        numberofentries;
+    uint16_t                        *table;         // open addressing on the mac: index+1 of the entry, 0 if empty
+    uint32_t                        tablesize;
+    // the sweep in progress
+    uint32_t                        sweep;
+    eObool_t                        running;
+    eObool_t                        resent;
+    eOipv4addr_t                    targets[eOupdaterDiscovery_maxtargets];
+    uint16_t                        numberoftargets;
+    uint64_t                        starttime;
+    uint64_t                        deadline;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,565 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOupdaterEmulator.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+
+#include "stdlib.h"
+#include "string.h"
+#include "stdio.h"
+#include "stddef.h"
+
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "EoUpdaterProtocol.h"
+#include "EoBoards.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterEmulator.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterEmulator_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOupdaterEmulator_cfg_t eOupdaterEmulator_cfg_default =
+{
+    EO_INIT(.ipv4addr)          EO_COMMON_IPV4ADDR_LOCALHOST,
+    EO_INIT(.port)              3333,
+    EO_INIT(.protversion)       EOUPROT_PROTOCOL_VERSION,
+    EO_INIT(.boardtype)         eobrd_ems4,
+    EO_INIT(.mac48)             {0x02, 0x00, 0x00, 0x00, 0x00, 0x01},
+    EO_INIT(.droppermille)      0,
+    EO_INIT(.flashaddress)      0x08000000,
+    EO_INIT(.flashsize)         1024*1024,
+    EO_INIT(.seed)              1
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void * s_eoupdaterEmulator_run(void *arg);
+static uint16_t s_eoupdaterEmulator_process(eOupdaterEmulator *p, const uint8_t *data, uint16_t size, uint8_t *reply);
+static eOuprot_result_t s_eoupdaterEmulator_write(eOupdaterEmulator *p, uint32_t address, const uint8_t *data, uint16_t size);
+static uint16_t s_eoupdaterEmulator_reply(eOupdaterEmulator *p, uint8_t opc, eOuprot_result_t res, uint8_t *reply);
+static uint16_t s_eoupdaterEmulator_discover(eOupdaterEmulator *p, uint8_t opc, uint8_t *reply);
+static uint16_t s_eoupdaterEmulator_legacy(eOupdaterEmulator *p, uint8_t opc, uint8_t *reply);
+static eObool_t s_eoupdaterEmulator_drop(eOupdaterEmulator *p);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOupdaterEmulator * eOupdaterEmulator_New(const eOupdaterEmulator_cfg_t *cfg)
+{
+    eOupdaterEmulator *p = NULL;
+    struct sockaddr_in local;
+
+    if(NULL == cfg)
+    {
+        cfg = &eOupdaterEmulator_cfg_default;
+    }
+
+    p = (eOupdaterEmulator*)calloc(1, sizeof(eOupdaterEmulator));
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    memcpy(&p->cfg, cfg, sizeof(eOupdaterEmulator_cfg_t));
+    // the seed is scrambled because xorshift gives small values at the start of a small seed
+    p->random = ((0 == cfg->seed) ? (1) : (cfg->seed)) * 0x9E3779B9UL;
+    if(0 == p->random)
+    {
+        p->random = 1;
+    }
+
+    p->flash = (uint8_t*)malloc(cfg->flashsize);
+    if(NULL == p->flash)
+    {
+        free(p);
+        return(NULL);
+    }
+    memset(p->flash, 0xff, cfg->flashsize);
+
+    p->socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if(p->socket < 0)
+    {
+        free(p->flash);
+        free(p);
+        return(NULL);
+    }
+
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = cfg->ipv4addr;
+    local.sin_port = htons(cfg->port);
+    if(0 != bind(p->socket, (struct sockaddr*)&local, sizeof(local)))
+    {
+        close(p->socket);
+        free(p->flash);
+        free(p);
+        return(NULL);
+    }
+
+    return(p);
+}
+
+
+extern void eOupdaterEmulator_Delete(eOupdaterEmulator *p)
+{
+    if(NULL == p)
+    {
+        return;
+    }
+
+    eOupdaterEmulator_Stop(p);
+    close(p->socket);
+    free(p->flash);
+    free(p);
+}
+
+
+extern eOresult_t eOupdaterEmulator_Start(eOupdaterEmulator *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_true == p->started)
+    {
+        return(eores_OK);
+    }
+
+    p->running = eobool_true;
+    if(0 != pthread_create(&p->thread, NULL, s_eoupdaterEmulator_run, p))
+    {
+        p->running = eobool_false;
+        return(eores_NOK_generic);
+    }
+    p->started = eobool_true;
+
+    return(eores_OK);
+}
+
+
+extern eOresult_t eOupdaterEmulator_Stop(eOupdaterEmulator *p)
+{
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(eobool_false == p->started)
+    {
+        return(eores_OK);
+    }
+
+    p->running = eobool_false;
+    pthread_join(p->thread, NULL);
+    p->started = eobool_false;
+
+    return(eores_OK);
+}
+
+
+extern const uint8_t * eOupdaterEmulator_GetFlash(eOupdaterEmulator *p, uint32_t *size)
+{
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    if(NULL != size)
+    {
+        *size = p->cfg.flashsize;
+    }
+
+    return(p->flash);
+}
+
+
+extern eOresult_t eOupdaterEmulator_GetStats(eOupdaterEmulator *p, eOupdaterEmulator_stats_t *stats)
+{
+    if((NULL == p) || (NULL == stats))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    memcpy(stats, &p->stats, sizeof(eOupdaterEmulator_stats_t));
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static void * s_eoupdaterEmulator_run(void *arg)
+{
+    eOupdaterEmulator *p = (eOupdaterEmulator*)arg;
+    uint8_t rxdata[uprot_UDPmaxsize];
+    uint8_t txdata[uprot_UDPmaxsize];
+
+    while(eobool_true == p->running)
+    {
+        struct pollfd pfd = { p->socket, POLLIN, 0 };
+        if(poll(&pfd, 1, 10) <= 0)
+        {
+            continue;
+        }
+
+        struct sockaddr_in from;
+        socklen_t fromlen = sizeof(from);
+        ssize_t n = recvfrom(p->socket, rxdata, sizeof(rxdata), MSG_DONTWAIT, (struct sockaddr*)&from, &fromlen);
+        if(n <= 0)
+        {
+            continue;
+        }
+
+        p->stats.received++;
+        if(eobool_true == s_eoupdaterEmulator_drop(p))
+        {
+            continue;
+        }
+
+        uint16_t size = s_eoupdaterEmulator_process(p, rxdata, (uint16_t)n, txdata);
+        if(0 == size)
+        {
+            continue;
+        }
+
+        if(eobool_true == s_eoupdaterEmulator_drop(p))
+        {
+            continue;
+        }
+
+        sendto(p->socket, txdata, size, 0, (struct sockaddr*)&from, fromlen);
+    }
+
+    return(NULL);
+}
+
+
+static uint16_t s_eoupdaterEmulator_process(eOupdaterEmulator *p, const uint8_t *data, uint16_t size, uint8_t *reply)
+{
+    eObool_t windowed = (p->cfg.protversion >= 3) ? (eobool_true) : (eobool_false);
+
+    switch(data[0])
+    {
+        case uprot_OPC_LEGACY_SCAN:
+        {   // DISCOVER and DISCOVER2 start with the opcode of the legacy scan
+            if((p->cfg.protversion > 0) && (size >= sizeof(eOuprot_cmd_DISCOVER_t)) && ((uprot_OPC_DISCOVER == data[1]) || (uprot_OPC_DISCOVER2 == data[1])))
+            {
+                return(s_eoupdaterEmulator_discover(p, data[1], reply));
+            }
+            return(s_eoupdaterEmulator_legacy(p, uprot_OPC_LEGACY_SCAN, reply));
+        }
+
+        case uprot_OPC_LEGACY_PROCS:
+        {   // so does MOREINFO with the legacy procs
+            if((p->cfg.protversion > 0) && (size >= sizeof(eOuprot_cmd_MOREINFO_t)) && (uprot_OPC_MOREINFO == data[1]))
+            {
+                return(s_eoupdaterEmulator_discover(p, uprot_OPC_MOREINFO, reply));
+            }
+            return(s_eoupdaterEmulator_legacy(p, uprot_OPC_LEGACY_PROCS, reply));
+        }
+
+        case uprot_OPC_PROG_START:
+        {
+            return(s_eoupdaterEmulator_reply(p, uprot_OPC_PROG_START, uprot_RES_OK, reply));
+        }
+
+        case uprot_OPC_PROG_DATA:
+        {
+            const eOuprot_cmd_PROG_DATA_t *cmd = (const eOuprot_cmd_PROG_DATA_t*)data;
+            uint32_t address = 0;
+            uint16_t datasize = 0;
+            eOuprot_result_t res = uprot_RES_ERR_PROT;
+            if(size >= 7)
+            {
+                address = (uint32_t)cmd->address[0] | ((uint32_t)cmd->address[1] << 8) | ((uint32_t)cmd->address[2] << 16) | ((uint32_t)cmd->address[3] << 24);
+                datasize = (uint16_t)cmd->size[0] | ((uint16_t)cmd->size[1] << 8);
+                if((datasize <= uprot_PROGmaxsize) && ((7 + datasize) <= size))
+                {
+                    res = s_eoupdaterEmulator_write(p, address, cmd->data, datasize);
+                }
+            }
+            return(s_eoupdaterEmulator_reply(p, uprot_OPC_PROG_DATA, res, reply));
+        }
+
+        case uprot_OPC_PROG_END:
+        {
+            p->stats.programmed++;
+            return(s_eoupdaterEmulator_reply(p, uprot_OPC_PROG_END, uprot_RES_OK, reply));
+        }
+
+        case uprot_OPC_PROG_WIN_START:
+        {
+            const eOuprot_cmd_PROG_WIN_START_t *cmd = (const eOuprot_cmd_PROG_WIN_START_t*)data;
+            eOuprot_cmd_PROG_WIN_START_REPLY_t *r = (eOuprot_cmd_PROG_WIN_START_REPLY_t*)reply;
+            if((eobool_false == windowed) || (size < sizeof(eOuprot_cmd_PROG_WIN_START_t)))
+            {
+                return(0);
+            }
+            eouprot_progwin_init(&p->progwin, cmd->window);
+            s_eoupdaterEmulator_reply(p, uprot_OPC_PROG_WIN_START, uprot_RES_OK, reply);
+            r->reply.sizeofextra = sizeof(eOuprot_cmd_PROG_WIN_START_REPLY_t) - sizeof(eOuprot_cmdREPLY_t);
+            r->window = p->progwin.window;
+            r->filler[0] = r->filler[1] = r->filler[2] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+            return(sizeof(eOuprot_cmd_PROG_WIN_START_REPLY_t));
+        }
+
+        case uprot_OPC_PROG_WIN_DATA:
+        {
+            const eOuprot_cmd_PROG_WIN_DATA_t *cmd = (const eOuprot_cmd_PROG_WIN_DATA_t*)data;
+            eOuprot_result_t res = uprot_RES_OK;
+            if((eobool_false == windowed) || (size < (sizeof(eOuprot_cmd_PROG_WIN_DATA_t) - uprot_PROGmaxsize)))
+            {
+                return(0);
+            }
+            if((cmd->size > uprot_PROGmaxsize) || ((sizeof(eOuprot_cmd_PROG_WIN_DATA_t) - uprot_PROGmaxsize + cmd->size) > size))
+            {
+                res = uprot_RES_ERR_PROT;
+            }
+            else if(eobool_true == eouprot_progwin_accept(&p->progwin, cmd->seqnum))
+            {
+                res = s_eoupdaterEmulator_write(p, cmd->address, cmd->data, cmd->size);
+            }
+            else
+            {
+                p->stats.duplicates++;
+            }
+            eouprot_progwin_fillack(&p->progwin, cmd->seqnum, res, (eOuprot_cmd_PROG_WIN_ACK_t*)reply);
+            ((eOuprot_cmd_PROG_WIN_ACK_t*)reply)->reply.protversion = p->cfg.protversion;
+            return(sizeof(eOuprot_cmd_PROG_WIN_ACK_t));
+        }
+
+        case uprot_OPC_PROG_WIN_END:
+        {
+            const eOuprot_cmd_PROG_WIN_END_t *cmd = (const eOuprot_cmd_PROG_WIN_END_t*)data;
+            eOuprot_result_t res = uprot_RES_ERR_LOST;
+            if((eobool_false == windowed) || (size < sizeof(eOuprot_cmd_PROG_WIN_END_t)))
+            {
+                return(0);
+            }
+            if(eobool_true == eouprot_progwin_complete(&p->progwin, cmd->numberofchunks))
+            {
+                res = uprot_RES_OK;
+                p->stats.programmed++;
+            }
+            return(s_eoupdaterEmulator_reply(p, uprot_OPC_PROG_WIN_END, res, reply));
+        }
+
+        default:
+        {
+        } break;
+    }
+
+    return(0);
+}
+
+
+static eOuprot_result_t s_eoupdaterEmulator_write(eOupdaterEmulator *p, uint32_t address, const uint8_t *data, uint16_t size)
+{
+    if((address < p->cfg.flashaddress) || ((uint64_t)address + size > (uint64_t)p->cfg.flashaddress + p->cfg.flashsize))
+    {
+        return(uprot_RES_ERR_FLASH);
+    }
+
+    memcpy(&p->flash[address - p->cfg.flashaddress], data, size);
+    p->stats.written++;
+
+    return(uprot_RES_OK);
+}
+
+
+static uint16_t s_eoupdaterEmulator_reply(eOupdaterEmulator *p, uint8_t opc, eOuprot_result_t res, uint8_t *reply)
+{
+    eOuprot_cmdREPLY_t *r = (eOuprot_cmdREPLY_t*)reply;
+
+    r->opc = opc;
+    r->res = res;
+    r->protversion = p->cfg.protversion;
+    r->sizeofextra = 0;
+
+    return(sizeof(eOuprot_cmdREPLY_t));
+}
+
+
+static uint16_t s_eoupdaterEmulator_discover(eOupdaterEmulator *p, uint8_t opc, uint8_t *reply)
+{
+    eOuprot_cmd_DISCOVER_REPLY_t *r = (eOuprot_cmd_DISCOVER_REPLY_t*)reply;
+    uint16_t size = sizeof(eOuprot_cmd_DISCOVER_REPLY_t);
+    uint8_t i = 0;
+
+    // the emulated board runs the eUpdater and has also the eLoader and the eApplication
+    memset(reply, 0, sizeof(eOuprot_cmd_MOREINFO_REPLY_t) + 64);
+    s_eoupdaterEmulator_reply(p, opc, uprot_RES_OK, reply);
+    r->boardtype = p->cfg.boardtype;
+    r->unused[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+    memcpy(r->mac48, p->cfg.mac48, 6);
+    r->capabilities = eouprot_get_capabilities(uprot_proc_Updater, p->cfg.protversion);
+    if(p->cfg.protversion >= 3)
+    {   // it implements the windowed programming
+        r->capabilities |= uprot_canDO_PROG_window;
+    }
+    r->processes.numberofthem = 3;
+    r->processes.startup = uprot_proc_Updater;
+    r->processes.def2run = uprot_proc_Application00;
+    r->processes.runningnow = uprot_proc_Updater;
+    for(i=0; i<3; i++)
+    {
+        r->processes.info[i].type = i;
+        r->processes.info[i].filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+        r->processes.info[i].version.major = 1;
+        r->processes.info[i].version.minor = i;
+    }
+    r->boardinfo32[0] = (uint8_t)snprintf((char*)&r->boardinfo32[1], 31, "emulated");
+
+    if(uprot_OPC_DISCOVER2 == opc)
+    {
+        eOuprot_cmd_DISCOVER_REPLY2_t *r2 = (eOuprot_cmd_DISCOVER_REPLY2_t*)reply;
+        r2->extraprocs[0].type = uprot_proc_None;
+        r2->extraprocs[1].type = uprot_proc_None;
+        size = sizeof(eOuprot_cmd_DISCOVER_REPLY2_t);
+    }
+    else if(uprot_OPC_MOREINFO == opc)
+    {
+        eOuprot_cmd_MOREINFO_REPLY_t *rm = (eOuprot_cmd_MOREINFO_REPLY_t*)reply;
+        int len = snprintf((char*)rm->description, 64, "emulated %s on port %d", eoboards_type2string((eObrd_type_t)p->cfg.boardtype), p->cfg.port);
+        rm->hasdescription = 1;
+        size = offsetof(eOuprot_cmd_MOREINFO_REPLY_t, description) + len + 1;
+    }
+
+    r->reply.sizeofextra = (uint8_t)(size - sizeof(eOuprot_cmdREPLY_t));
+
+    return(size);
+}
+
+
+static uint16_t s_eoupdaterEmulator_legacy(eOupdaterEmulator *p, uint8_t opc, uint8_t *reply)
+{
+    if(uprot_OPC_LEGACY_SCAN == opc)
+    {
+        eOuprot_cmd_LEGACY_SCAN_REPLY_t *r = (eOuprot_cmd_LEGACY_SCAN_REPLY_t*)reply;
+        r->opc = uprot_OPC_LEGACY_SCAN;
+        r->version.major = 1;
+        r->version.minor = 0;
+        r->unused = 0x0A;
+        r->ipmask[0] = r->ipmask[1] = r->ipmask[2] = 255;
+        r->ipmask[3] = 0;
+        memcpy(r->mac48, p->cfg.mac48, 6);
+        return(sizeof(eOuprot_cmd_LEGACY_SCAN_REPLY_t));
+    }
+    else
+    {
+        eOuprot_cmd_LEGACY_PROCS_REPLY_t *r = (eOuprot_cmd_LEGACY_PROCS_REPLY_t*)reply;
+        int len = snprintf((char*)r->description, 64, "legacy emulated board on port %d", p->cfg.port);
+        r->opc = uprot_OPC_LEGACY_PROCS;
+        r->numofprocesses = 3;
+        return(2 + len + 1);
+    }
+}
+
+
+static eObool_t s_eoupdaterEmulator_drop(eOupdaterEmulator *p)
+{
+    if(0 == p->cfg.droppermille)
+    {
+        return(eobool_false);
+    }
+
+    // xorshift32, so that the losses are reproducible with the same seed
+    p->random ^= p->random << 13;
+    p->random ^= p->random >> 17;
+    p->random ^= p->random << 5;
+
+    if((p->random % 1000) < p->cfg.droppermille)
+    {
+        p->stats.dropped++;
+        return(eobool_true);
+    }
+
+    return(eobool_false);
+}
+
+
+#endif // defined(EO_TAILOR_CODE_FOR_LINUX)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOUPDATEREMULATOR_H_
+#define _EOUPDATEREMULATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOupdaterEmulator.h
+    @brief      a local UDP stand-in of the flash programming of an ETH board
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eoupdateremulator Object eOupdaterEmulator
+    The eOupdaterEmulator listens on a UDP port and replies to the PROG commands of the EoUpdaterProtocol as the eUpdater
+    of an ETH board does, writing the data in a flash which lives in RAM. If protversion is 3 or more it also replies
+    to the PROG_WIN commands, otherwise it ignores them as a legacy board does. It also replies to DISCOVER, DISCOVER2
+    and MOREINFO, or to their legacy SCAN and PROCS forms if protversion is 0. It can drop a fraction of the packets
+    it receives and of the ones it sends, so that the programmer can be tested without a board and with losses.
+
+    It runs in its own thread and it is available only on linux.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoUpdaterProtocol.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOupdaterEmulator_hid eOupdaterEmulator;
+
+
+typedef struct
+{
+    eOipv4addr_t    ipv4addr;       /**< the address to bind to. typically EO_COMMON_IPV4ADDR_LOCALHOST or any 127.x.y.z */
+    uint16_t        port;
+    uint8_t         protversion;    /**< the EOUPROT_PROTOCOL_VERSION which is emulated. 0 emulates a legacy board */
+    uint8_t         boardtype;      /**< use eObrd_type_t. it is used in the reply to DISCOVER and MOREINFO */
+    uint8_t         mac48[6];
+    uint16_t        droppermille;   /**< packets which are lost, in each direction, every 1000 */
+    uint32_t        flashaddress;   /**< the address of the first byte of the flash */
+    uint32_t        flashsize;
+    uint32_t        seed;           /**< of the random sequence of losses */
+} eOupdaterEmulator_cfg_t;
+
+
+typedef struct
+{
+    uint32_t        received;
+    uint32_t        dropped;        /**< received or sent packets which were lost */
+    uint32_t        written;        /**< PROG_DATA or PROG_WIN_DATA written in flash */
+    uint32_t        duplicates;     /**< PROG_WIN_DATA already written or outside the window */
+    uint32_t        programmed;     /**< PROG_END or PROG_WIN_END replied with uprot_RES_OK */
+} eOupdaterEmulator_stats_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOupdaterEmulator_cfg_t eOupdaterEmulator_cfg_default; // = { localhost, 3333, EOUPROT_PROTOCOL_VERSION, eobrd_ems4, {0x02, 0, 0, 0, 0, 0x01}, 0, 0x08000000, 1024*1024, 1 };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOupdaterEmulator * eOupdaterEmulator_New(const eOupdaterEmulator_cfg_t *cfg)
+    @brief      creates the object, its flash filled with 0xff and its UDP socket.
+    @return     the object or NULL if the socket cannot be bound.
+ **/
+extern eOupdaterEmulator * eOupdaterEmulator_New(const eOupdaterEmulator_cfg_t *cfg);
+
+/** @fn         extern void eOupdaterEmulator_Delete(eOupdaterEmulator *p)
+    @brief      stops the thread if it is running and releases the object.
+ **/
+extern void eOupdaterEmulator_Delete(eOupdaterEmulator *p);
+
+extern eOresult_t eOupdaterEmulator_Start(eOupdaterEmulator *p);
+
+extern eOresult_t eOupdaterEmulator_Stop(eOupdaterEmulator *p);
+
+/** @fn         extern const uint8_t * eOupdaterEmulator_GetFlash(eOupdaterEmulator *p, uint32_t *size)
+    @brief      gives the content of the flash. it is safe to read it only when the programmer has finished.
+ **/
+extern const uint8_t * eOupdaterEmulator_GetFlash(eOupdaterEmulator *p, uint32_t *size);
+
+extern eOresult_t eOupdaterEmulator_GetStats(eOupdaterEmulator *p, eOupdaterEmulator_stats_t *stats);
+
+
+/** @}
+    end of group eoupdateremulator
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,796 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+/* @file       eOupdaterProgrammer.c
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+#if defined(EO_TAILOR_CODE_FOR_LINUX)
+
+#include "stdlib.h"
+#include "string.h"
+
+#include <time.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include "EoUpdaterProtocol.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern public interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterProgrammer.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of extern hidden interface
+// --------------------------------------------------------------------------------------------------------------------
+#include "eOupdaterProgrammer_hid.h"
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - #define with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of extern variables, but better using _get(), _set()
+// --------------------------------------------------------------------------------------------------------------------
+
+const eOupdaterProgrammer_cfg_t eOupdaterProgrammer_cfg_default =
+{
+    EO_INIT(.localport)         0,
+    EO_INIT(.window)            16,
+    EO_INIT(.maxretries)        10,
+    EO_INIT(.chunksize)         uprot_PROGmaxsize,
+    EO_INIT(.timeout)           100000
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - typedef with internal scope
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - declaration of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eoupdaterProgrammer_now(void);
+static void s_eoupdaterProgrammer_send(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const void *data, uint16_t size);
+static void s_eoupdaterProgrammer_send_start(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now);
+static void s_eoupdaterProgrammer_send_end(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now);
+static void s_eoupdaterProgrammer_send_legacydata(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now);
+static void s_eoupdaterProgrammer_legacynext(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now);
+static void s_eoupdaterProgrammer_send_chunk(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint16_t seqnum, uint64_t now);
+static void s_eoupdaterProgrammer_tick(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now);
+static void s_eoupdaterProgrammer_parse(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const uint8_t *data, uint16_t size, uint64_t now);
+static void s_eoupdaterProgrammer_onack(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const eOuprot_cmd_PROG_WIN_ACK_t *ack, uint64_t now);
+static void s_eoupdaterProgrammer_finish(eOupdaterProgrammer_board_t *b, eOupdaterProgrammer_state_t state, eOuprot_result_t res, uint64_t now);
+static eOupdaterProgrammer_board_t * s_eoupdaterProgrammer_find(eOupdaterProgrammer *p, const struct sockaddr_in *from);
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition (and initialisation) of static variables
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern public functions
+// --------------------------------------------------------------------------------------------------------------------
+
+extern eOupdaterProgrammer * eOupdaterProgrammer_New(const eOupdaterProgrammer_cfg_t *cfg)
+{
+    eOupdaterProgrammer *p = NULL;
+    struct sockaddr_in local;
+
+    if(NULL == cfg)
+    {
+        cfg = &eOupdaterProgrammer_cfg_default;
+    }
+
+    p = (eOupdaterProgrammer*)calloc(1, sizeof(eOupdaterProgrammer));
+    if(NULL == p)
+    {
+        return(NULL);
+    }
+
+    memcpy(&p->cfg, cfg, sizeof(eOupdaterProgrammer_cfg_t));
+    if((0 == p->cfg.window) || (p->cfg.window > uprot_PROGWINmaxsize))
+    {
+        p->cfg.window = uprot_PROGWINmaxsize;
+    }
+    if((0 == p->cfg.chunksize) || (p->cfg.chunksize > uprot_PROGmaxsize))
+    {
+        p->cfg.chunksize = uprot_PROGmaxsize;
+    }
+
+    p->socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if(p->socket < 0)
+    {
+        free(p);
+        return(NULL);
+    }
+
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(p->cfg.localport);
+    if(0 != bind(p->socket, (struct sockaddr*)&local, sizeof(local)))
+    {
+        close(p->socket);
+        free(p);
+        return(NULL);
+    }
+
+    return(p);
+}
+
+
+extern void eOupdaterProgrammer_Delete(eOupdaterProgrammer *p)
+{
+    uint8_t i = 0;
+
+    if(NULL == p)
+    {
+        return;
+    }
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        free(p->boards[i].chunks);
+    }
+
+    close(p->socket);
+    free(p);
+}
+
+
+extern eOresult_t eOupdaterProgrammer_AddBoard(eOupdaterProgrammer *p, eOipv4addr_t ipv4addr, uint16_t port, uint32_t capabilities)
+{
+    eOupdaterProgrammer_board_t *b = NULL;
+
+    if(NULL == p)
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(p->numberofboards >= eOupdaterProgrammer_maxboards)
+    {
+        return(eores_NOK_busy);
+    }
+
+    b = &p->boards[p->numberofboards++];
+    memset(b, 0, sizeof(eOupdaterProgrammer_board_t));
+    b->capabilities = capabilities;
+    b->result.ipv4addr = ipv4addr;
+    b->result.port = port;
+    b->result.mode = (uprot_canDO_PROG_window == (capabilities & uprot_canDO_PROG_window)) ? (eoupdprog_mode_windowed) : (eoupdprog_mode_legacy);
+    b->result.result = uprot_RES_ERR_UNK;
+
+    return(eores_OK);
+}
+
+
+extern uint8_t eOupdaterProgrammer_NumberOfBoards(eOupdaterProgrammer *p)
+{
+    if(NULL == p)
+    {
+        return(0);
+    }
+
+    return(p->numberofboards);
+}
+
+
+extern eOresult_t eOupdaterProgrammer_Program(eOupdaterProgrammer *p, eOuprot_partition2prog_t partition, const uint8_t *image, uint32_t size, uint32_t address)
+{
+    uint8_t i = 0;
+    uint8_t active = 0;
+    uint64_t now = 0;
+    int waitms = 0;
+    eOresult_t res = eores_OK;
+
+    if((NULL == p) || (NULL == image))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if((0 == size) || (((size + p->cfg.chunksize - 1) / p->cfg.chunksize) > EOK_uint16dummy))
+    {
+        return(eores_NOK_generic);
+    }
+
+    p->partition = partition;
+    p->image = image;
+    p->size = size;
+    p->address = address;
+    p->numberofchunks = (uint16_t)((size + p->cfg.chunksize - 1) / p->cfg.chunksize);
+
+    now = s_eoupdaterProgrammer_now();
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        eOupdaterProgrammer_board_t *b = &p->boards[i];
+        free(b->chunks);
+        b->chunks = NULL;
+        if(eoupdprog_mode_windowed == b->result.mode)
+        {
+            b->chunks = (eOupdaterProgrammer_chunk_t*)calloc(p->numberofchunks, sizeof(eOupdaterProgrammer_chunk_t));
+            if(NULL == b->chunks)
+            {
+                b->result.mode = eoupdprog_mode_legacy;
+            }
+        }
+        b->state = eoupdprog_state_starting;
+        b->retries = 0;
+        b->cumulative = 0;
+        b->stale = 0;
+        b->order = 0;
+        b->starttime = now;
+        b->result.result = uprot_RES_ERR_UNK;
+        b->result.window = (eoupdprog_mode_windowed == b->result.mode) ? (p->cfg.window) : (1);
+        b->result.datapackets = 0;
+        b->result.retransmissions = 0;
+        b->result.duration = 0;
+        s_eoupdaterProgrammer_send_start(p, b, now);
+    }
+
+    // the wait is a fraction of the timeout so that the retransmissions are not late
+    waitms = (int)(p->cfg.timeout / 4000);
+    if(0 == waitms)
+    {
+        waitms = 1;
+    }
+
+    for(;;)
+    {
+        active = 0;
+        now = s_eoupdaterProgrammer_now();
+        for(i=0; i<p->numberofboards; i++)
+        {
+            if(p->boards[i].state < eoupdprog_state_done)
+            {
+                s_eoupdaterProgrammer_tick(p, &p->boards[i], now);
+            }
+            if(p->boards[i].state < eoupdprog_state_done)
+            {
+                active++;
+            }
+        }
+
+        if(0 == active)
+        {
+            break;
+        }
+
+        struct pollfd pfd = { p->socket, POLLIN, 0 };
+        if(poll(&pfd, 1, waitms) <= 0)
+        {
+            continue;
+        }
+
+        // we drain the socket before looking at the timeouts again
+        for(;;)
+        {
+            uint8_t rxdata[uprot_UDPmaxsize];
+            struct sockaddr_in from;
+            socklen_t fromlen = sizeof(from);
+            ssize_t n = recvfrom(p->socket, rxdata, sizeof(rxdata), MSG_DONTWAIT, (struct sockaddr*)&from, &fromlen);
+            if(n <= 0)
+            {
+                break;
+            }
+            eOupdaterProgrammer_board_t *b = s_eoupdaterProgrammer_find(p, &from);
+            if((NULL != b) && (b->state < eoupdprog_state_done))
+            {
+                s_eoupdaterProgrammer_parse(p, b, rxdata, (uint16_t)n, s_eoupdaterProgrammer_now());
+            }
+        }
+    }
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        free(p->boards[i].chunks);
+        p->boards[i].chunks = NULL;
+        if(eoupdprog_state_done != p->boards[i].state)
+        {
+            res = eores_NOK_generic;
+        }
+    }
+
+    p->image = NULL;
+
+    return(res);
+}
+
+
+extern eOresult_t eOupdaterProgrammer_GetResult(eOupdaterProgrammer *p, uint8_t index, eOupdaterProgrammer_result_t *result)
+{
+    if((NULL == p) || (NULL == result))
+    {
+        return(eores_NOK_nullpointer);
+    }
+
+    if(index >= p->numberofboards)
+    {
+        return(eores_NOK_generic);
+    }
+
+    memcpy(result, &p->boards[index].result, sizeof(eOupdaterProgrammer_result_t));
+
+    return(eores_OK);
+}
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of extern hidden functions
+// --------------------------------------------------------------------------------------------------------------------
+// empty-section
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - definition of static functions
+// --------------------------------------------------------------------------------------------------------------------
+
+static uint64_t s_eoupdaterProgrammer_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL));
+}
+
+
+static void s_eoupdaterProgrammer_send(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const void *data, uint16_t size)
+{
+    struct sockaddr_in to;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = b->result.ipv4addr;    // eOipv4addr_t keeps the bytes in network order
+    to.sin_port = htons(b->result.port);
+    sendto(p->socket, data, size, 0, (struct sockaddr*)&to, sizeof(to));
+}
+
+
+static void s_eoupdaterProgrammer_send_start(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now)
+{
+    if(eoupdprog_mode_windowed == b->result.mode)
+    {
+        eOuprot_cmd_PROG_WIN_START_t cmd;
+        cmd.opc = uprot_OPC_PROG_WIN_START;
+        cmd.partition = p->partition;
+        cmd.window = p->cfg.window;
+        cmd.filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+        cmd.size = p->size;
+        s_eoupdaterProgrammer_send(p, b, &cmd, sizeof(cmd));
+    }
+    else
+    {
+        eOuprot_cmd_PROG_START_t cmd;
+        cmd.opc = uprot_OPC_PROG_START;
+        cmd.partition = p->partition;
+        cmd.filler[0] = cmd.filler[1] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+        s_eoupdaterProgrammer_send(p, b, &cmd, sizeof(cmd));
+    }
+
+    b->lastsent = now;
+}
+
+
+static void s_eoupdaterProgrammer_send_end(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now)
+{
+    if(eoupdprog_mode_windowed == b->result.mode)
+    {
+        eOuprot_cmd_PROG_WIN_END_t cmd;
+        cmd.opc = uprot_OPC_PROG_WIN_END;
+        cmd.filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+        cmd.numberofchunks = p->numberofchunks;
+        s_eoupdaterProgrammer_send(p, b, &cmd, sizeof(cmd));
+    }
+    else
+    {
+        // the legacy protocol wants the number of PROG_DATA + 1
+        eOuprot_cmd_PROG_END_t cmd;
+        uint16_t numberofpkts = p->numberofchunks + 1;
+        cmd.opc = uprot_OPC_PROG_END;
+        cmd.numberofpkts[0] = numberofpkts & 0xff;
+        cmd.numberofpkts[1] = (numberofpkts >> 8) & 0xff;
+        cmd.filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+        s_eoupdaterProgrammer_send(p, b, &cmd, sizeof(cmd));
+    }
+
+    b->lastsent = now;
+}
+
+
+static void s_eoupdaterProgrammer_send_legacydata(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now)
+{
+    eOuprot_cmd_PROG_DATA_t cmd;
+    uint32_t offset = (uint32_t)b->cumulative * p->cfg.chunksize;
+    uint32_t address = p->address + offset;
+    uint16_t size = ((p->size - offset) > p->cfg.chunksize) ? (p->cfg.chunksize) : (uint16_t)(p->size - offset);
+
+    cmd.opc = uprot_OPC_PROG_DATA;
+    cmd.address[0] = address & 0xff;
+    cmd.address[1] = (address >> 8) & 0xff;
+    cmd.address[2] = (address >> 16) & 0xff;
+    cmd.address[3] = (address >> 24) & 0xff;
+    cmd.size[0] = size & 0xff;
+    cmd.size[1] = (size >> 8) & 0xff;
+    memcpy(cmd.data, &p->image[offset], size);
+    s_eoupdaterProgrammer_send(p, b, &cmd, 7 + size);
+
+    b->lastsent = now;
+    b->result.datapackets++;
+}
+
+
+static void s_eoupdaterProgrammer_legacynext(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now)
+{   // the chunk b->cumulative - 1 is acked
+    if(b->cumulative >= p->numberofchunks)
+    {
+        b->state = eoupdprog_state_ending;
+        s_eoupdaterProgrammer_send_end(p, b, now);
+    }
+    else
+    {
+        s_eoupdaterProgrammer_send_legacydata(p, b, now);
+    }
+}
+
+
+static void s_eoupdaterProgrammer_send_chunk(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint16_t seqnum, uint64_t now)
+{
+    eOuprot_cmd_PROG_WIN_DATA_t cmd;
+    eOupdaterProgrammer_chunk_t *chunk = &b->chunks[seqnum];
+    uint32_t offset = (uint32_t)seqnum * p->cfg.chunksize;
+    uint16_t size = ((p->size - offset) > p->cfg.chunksize) ? (p->cfg.chunksize) : (uint16_t)(p->size - offset);
+
+    cmd.opc = uprot_OPC_PROG_WIN_DATA;
+    cmd.filler[0] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+    cmd.seqnum = seqnum;
+    cmd.address = p->address + offset;
+    cmd.size = size;
+    cmd.filler2[0] = cmd.filler2[1] = EOUPROT_VALUE_OF_UNUSED_BYTE;
+    memcpy(cmd.data, &p->image[offset], size);
+    s_eoupdaterProgrammer_send(p, b, &cmd, sizeof(cmd) - uprot_PROGmaxsize + size);
+
+    if(0 != chunk->order)
+    {
+        b->result.retransmissions++;
+    }
+    chunk->senttime = now;
+    chunk->order = ++b->order;
+    chunk->due = 0;
+    b->result.datapackets++;
+}
+
+
+static void s_eoupdaterProgrammer_tick(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, uint64_t now)
+{
+    uint16_t i = 0;
+    uint32_t last = 0;
+
+    if((eoupdprog_state_sending == b->state) && (eoupdprog_mode_windowed == b->result.mode))
+    {
+        // every chunk inside the window is sent if it was never sent, if an ack has told it is lost or if it has timed out
+        last = (uint32_t)b->cumulative + b->result.window;
+        if(last > p->numberofchunks)
+        {
+            last = p->numberofchunks;
+        }
+        for(i=b->cumulative; i<last; i++)
+        {
+            eOupdaterProgrammer_chunk_t *chunk = &b->chunks[i];
+            if(1 == chunk->acked)
+            {
+                continue;
+            }
+            if((0 != chunk->order) && (0 == chunk->due) && ((now - chunk->senttime) >= p->cfg.timeout))
+            {
+                if(++chunk->timeouts > p->cfg.maxretries)
+                {
+                    s_eoupdaterProgrammer_finish(b, eoupdprog_state_failed, uprot_RES_ERR_LOST, now);
+                    return;
+                }
+                chunk->due = 1;
+            }
+            if((0 == chunk->order) || (1 == chunk->due))
+            {
+                s_eoupdaterProgrammer_send_chunk(p, b, i, now);
+            }
+        }
+        return;
+    }
+
+    // in all other cases there is only one command in flight
+    if((now - b->lastsent) < p->cfg.timeout)
+    {
+        return;
+    }
+
+    if((eoupdprog_state_sending == b->state) && (0 != b->stale))
+    {   // the other replies to the chunk just acked are lost: we can go on
+        b->stale = 0;
+        s_eoupdaterProgrammer_legacynext(p, b, now);
+        return;
+    }
+
+    if(++b->retries > p->cfg.maxretries)
+    {
+        if((eoupdprog_state_starting == b->state) && (eoupdprog_mode_windowed == b->result.mode))
+        {   // the board does not know PROG_WIN_START: we go on with the legacy commands
+            b->result.mode = eoupdprog_mode_legacy;
+            b->result.window = 1;
+            b->retries = 0;
+            s_eoupdaterProgrammer_send_start(p, b, now);
+            return;
+        }
+        s_eoupdaterProgrammer_finish(b, eoupdprog_state_failed, uprot_RES_ERR_LOST, now);
+        return;
+    }
+
+    switch(b->state)
+    {
+        case eoupdprog_state_starting:
+        {
+            s_eoupdaterProgrammer_send_start(p, b, now);
+        } break;
+
+        case eoupdprog_state_sending:
+        {
+            b->result.retransmissions++;
+            s_eoupdaterProgrammer_send_legacydata(p, b, now);
+        } break;
+
+        case eoupdprog_state_ending:
+        {
+            s_eoupdaterProgrammer_send_end(p, b, now);
+        } break;
+
+        default:
+        {
+        } break;
+    }
+}
+
+
+static void s_eoupdaterProgrammer_parse(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const uint8_t *data, uint16_t size, uint64_t now)
+{
+    const eOuprot_cmdREPLY_t *reply = (const eOuprot_cmdREPLY_t*)data;
+
+    if(size < sizeof(eOuprot_cmdREPLY_t))
+    {
+        return;
+    }
+
+    switch(reply->opc)
+    {
+        case uprot_OPC_PROG_START:
+        case uprot_OPC_PROG_WIN_START:
+        {
+            if(eoupdprog_state_starting != b->state)
+            {   // a late reply to a retransmission
+                return;
+            }
+            if((uprot_OPC_PROG_WIN_START == reply->opc) != (eoupdprog_mode_windowed == b->result.mode))
+            {
+                return;
+            }
+            if(uprot_RES_OK != reply->res)
+            {
+                s_eoupdaterProgrammer_finish(b, eoupdprog_state_failed, (eOuprot_result_t)reply->res, now);
+                return;
+            }
+            b->state = eoupdprog_state_sending;
+            b->retries = 0;
+            if(eoupdprog_mode_windowed == b->result.mode)
+            {
+                const eOuprot_cmd_PROG_WIN_START_REPLY_t *r = (const eOuprot_cmd_PROG_WIN_START_REPLY_t*)data;
+                if(size < sizeof(eOuprot_cmd_PROG_WIN_START_REPLY_t))
+                {
+                    return;
+                }
+                b->result.window = ((0 == r->window) || (r->window > p->cfg.window)) ? (p->cfg.window) : (r->window);
+                s_eoupdaterProgrammer_tick(p, b, now);
+            }
+            else
+            {
+                s_eoupdaterProgrammer_send_legacydata(p, b, now);
+            }
+        } break;
+
+        case uprot_OPC_PROG_DATA:
+        {
+            if((eoupdprog_state_sending != b->state) || (eoupdprog_mode_legacy != b->result.mode))
+            {
+                return;
+            }
+            if(size >= sizeof(eOuprot_cmd_PROG_WIN_ACK_t))
+            {   // it is not the reply to a legacy PROG_DATA
+                return;
+            }
+            if(0 != b->stale)
+            {   // the reply to another transmission of the chunk just acked
+                if(0 == --b->stale)
+                {
+                    s_eoupdaterProgrammer_legacynext(p, b, now);
+                }
+                return;
+            }
+            if(uprot_RES_OK != reply->res)
+            {
+                s_eoupdaterProgrammer_finish(b, eoupdprog_state_failed, (eOuprot_result_t)reply->res, now);
+                return;
+            }
+            // stop-and-wait. the reply does not tell its chunk, so if the chunk was sent more than once we wait for
+            // the replies to its other transmissions, or for a timeout, before we send the next chunk. in this way
+            // a late reply is never taken as the reply to the next chunk.
+            b->cumulative++;
+            b->stale = b->retries;
+            b->retries = 0;
+            if(0 == b->stale)
+            {
+                s_eoupdaterProgrammer_legacynext(p, b, now);
+            }
+            else
+            {
+                b->lastsent = now;
+            }
+        } break;
+
+        case uprot_OPC_PROG_WIN_DATA:
+        {
+            if((eoupdprog_state_sending != b->state) || (eoupdprog_mode_windowed != b->result.mode))
+            {
+                return;
+            }
+            if(size < sizeof(eOuprot_cmd_PROG_WIN_ACK_t))
+            {
+                return;
+            }
+            if(uprot_RES_OK != reply->res)
+            {
+                s_eoupdaterProgrammer_finish(b, eoupdprog_state_failed, (eOuprot_result_t)reply->res, now);
+                return;
+            }
+            s_eoupdaterProgrammer_onack(p, b, (const eOuprot_cmd_PROG_WIN_ACK_t*)data, now);
+        } break;
+
+        case uprot_OPC_PROG_END:
+        case uprot_OPC_PROG_WIN_END:
+        {
+            if(eoupdprog_state_ending != b->state)
+            {
+                return;
+            }
+            s_eoupdaterProgrammer_finish(b, (uprot_RES_OK == reply->res) ? (eoupdprog_state_done) : (eoupdprog_state_failed), (eOuprot_result_t)reply->res, now);
+        } break;
+
+        default:
+        {
+        } break;
+    }
+}
+
+
+static void s_eoupdaterProgrammer_onack(eOupdaterProgrammer *p, eOupdaterProgrammer_board_t *b, const eOuprot_cmd_PROG_WIN_ACK_t *ack, uint64_t now)
+{
+    uint16_t i = 0;
+    uint16_t cumulative = (ack->cumulative > p->numberofchunks) ? (p->numberofchunks) : (ack->cumulative);
+    uint32_t trigger = 0;
+    uint32_t last = 0;
+
+    for(i=b->cumulative; i<cumulative; i++)
+    {
+        b->chunks[i].acked = 1;
+    }
+    for(i=0; i<32; i++)
+    {
+        uint32_t seqnum = (uint32_t)cumulative + 1 + i;
+        if((seqnum < p->numberofchunks) && (0 != (ack->received & (0x1UL << i))))
+        {
+            b->chunks[seqnum].acked = 1;
+        }
+    }
+    if(cumulative > b->cumulative)
+    {
+        b->cumulative = cumulative;
+    }
+
+    if(b->cumulative >= p->numberofchunks)
+    {
+        b->state = eoupdprog_state_ending;
+        b->retries = 0;
+        s_eoupdaterProgrammer_send_end(p, b, now);
+        return;
+    }
+
+    // selective retransmit: a hole which was sent before the chunk which has triggered this ack is lost, thus we
+    // send it again now rather than at its timeout
+    if(ack->seqnum < p->numberofchunks)
+    {
+        trigger = b->chunks[ack->seqnum].order;
+    }
+    last = (uint32_t)b->cumulative + b->result.window;
+    if(last > p->numberofchunks)
+    {
+        last = p->numberofchunks;
+    }
+    for(i=b->cumulative; i<last; i++)
+    {
+        eOupdaterProgrammer_chunk_t *chunk = &b->chunks[i];
+        if((0 == chunk->acked) && (0 != chunk->order) && (chunk->order < trigger))
+        {
+            chunk->due = 1;
+        }
+    }
+
+    s_eoupdaterProgrammer_tick(p, b, now);
+}
+
+
+static void s_eoupdaterProgrammer_finish(eOupdaterProgrammer_board_t *b, eOupdaterProgrammer_state_t state, eOuprot_result_t res, uint64_t now)
+{
+    b->state = state;
+    b->result.result = res;
+    b->result.duration = now - b->starttime;
+}
+
+
+static eOupdaterProgrammer_board_t * s_eoupdaterProgrammer_find(eOupdaterProgrammer *p, const struct sockaddr_in *from)
+{
+    uint8_t i = 0;
+
+    for(i=0; i<p->numberofboards; i++)
+    {
+        if((p->boards[i].result.ipv4addr == from->sin_addr.s_addr) && (p->boards[i].result.port == ntohs(from->sin_port)))
+        {
+            return(&p->boards[i]);
+        }
+    }
+
+    return(NULL);
+}
+
+
+#endif // defined(EO_TAILOR_CODE_FOR_LINUX)
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - end-of-file (leave a blank line after)
+// --------------------------------------------------------------------------------------------------------------------
+
+
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOUPDATERPROGRAMMER_H_
+#define _EOUPDATERPROGRAMMER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/** @file       eOupdaterProgrammer.h
+    @brief      host side engine which programs the flash of many ETH boards at the same time
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+/** @defgroup eoupdaterprogrammer Object eOupdaterProgrammer
+    The eOupdaterProgrammer sends the same image to many ETH boards using the EoUpdaterProtocol over a single UDP socket.
+    All the boards are served together in a loop, so the total time is about the one of the slowest board rather than
+    the sum of all of them.
+    A board whose capabilities contain uprot_canDO_PROG_window is programmed with PROG_WIN_START, PROG_WIN_DATA and
+    PROG_WIN_END: up to window chunks are in flight, the board acks every chunk with the cumulative seqnum and a mask
+    of the chunks received after it, and the host sends again only the chunks which are missing. A chunk is sent again
+    when its timeout expires or as soon as an ack reports a chunk sent after it, so a lost chunk costs about one round
+    trip. Any other board is programmed stop-and-wait with PROG_START, PROG_DATA and PROG_END as before.
+    The capabilities are the ones in eOuprot_cmd_DISCOVER_REPLY_t. The ones given by eouprot_get_capabilities() never
+    contain uprot_canDO_PROG_window.
+
+    It is available only on linux.
+
+    @{
+ **/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+#include "EoUpdaterProtocol.h"
+
+
+// - public #define  --------------------------------------------------------------------------------------------------
+
+#define eOupdaterProgrammer_maxboards       64
+#define eOupdaterProgrammer_port            3333
+
+
+// - declaration of public user-defined types -------------------------------------------------------------------------
+
+typedef struct eOupdaterProgrammer_hid eOupdaterProgrammer;
+
+
+typedef enum
+{
+    eoupdprog_mode_legacy       = 0,    /**< stop-and-wait with PROG_START, PROG_DATA, PROG_END */
+    eoupdprog_mode_windowed     = 1     /**< sliding window with PROG_WIN_START, PROG_WIN_DATA, PROG_WIN_END */
+} eOupdaterProgrammer_mode_t;
+
+
+typedef struct
+{
+    uint16_t        localport;      /**< the local UDP port. if 0 any free port is used */
+    uint8_t         window;         /**< the number of PROG_WIN_DATA in flight requested to the boards. at most uprot_PROGWINmaxsize */
+    uint8_t         maxretries;     /**< times a command or a chunk is sent again before declaring the board failed */
+    uint16_t        chunksize;      /**< bytes of data inside every PROG_DATA or PROG_WIN_DATA. at most uprot_PROGmaxsize */
+    uint32_t        timeout;        /**< in usec: the time after which a command or a chunk without reply is sent again */
+} eOupdaterProgrammer_cfg_t;
+
+
+typedef struct
+{
+    eOipv4addr_t    ipv4addr;
+    uint16_t        port;
+    uint8_t         mode;           /**< use eOupdaterProgrammer_mode_t */
+    uint8_t         result;         /**< use eOuprot_result_t: uprot_RES_OK if the board was programmed */
+    uint8_t         window;         /**< the window granted by the board */
+    uint32_t        datapackets;    /**< PROG_DATA or PROG_WIN_DATA sent, retransmissions included */
+    uint32_t        retransmissions;
+    uint64_t        duration;       /**< in usec */
+} eOupdaterProgrammer_result_t;
+
+
+
+// - declaration of extern public variables, ... but better using use _get/_set instead -------------------------------
+
+extern const eOupdaterProgrammer_cfg_t eOupdaterProgrammer_cfg_default; // = { 0, 16, 10, uprot_PROGmaxsize, 100000 };
+
+
+// - declaration of extern public functions ---------------------------------------------------------------------------
+
+/** @fn         extern eOupdaterProgrammer * eOupdaterProgrammer_New(const eOupdaterProgrammer_cfg_t *cfg)
+    @brief      creates the object and its UDP socket.
+    @return     the object or NULL if the socket cannot be opened.
+ **/
+extern eOupdaterProgrammer * eOupdaterProgrammer_New(const eOupdaterProgrammer_cfg_t *cfg);
+
+extern void eOupdaterProgrammer_Delete(eOupdaterProgrammer *p);
+
+/** @fn         extern eOresult_t eOupdaterProgrammer_AddBoard(eOupdaterProgrammer *p, eOipv4addr_t ipv4addr, uint16_t port, uint32_t capabilities)
+    @brief      adds a board to be programmed.
+    @param      port            the UDP port of the board. it typically is eOupdaterProgrammer_port.
+    @param      capabilities    mask of eOuprot_proc_capabilities_t of the process running on the board.
+    @return     eores_OK or eores_NOK_busy if there are already eOupdaterProgrammer_maxboards.
+ **/
+extern eOresult_t eOupdaterProgrammer_AddBoard(eOupdaterProgrammer *p, eOipv4addr_t ipv4addr, uint16_t port, uint32_t capabilities);
+
+extern uint8_t eOupdaterProgrammer_NumberOfBoards(eOupdaterProgrammer *p);
+
+/** @fn         extern eOresult_t eOupdaterProgrammer_Program(eOupdaterProgrammer *p, eOuprot_partition2prog_t partition, const uint8_t *image, uint32_t size, uint32_t address)
+    @brief      programs image at address in every board. it returns when every board has either finished or failed.
+    @return     eores_OK if all the boards were programmed, eores_NOK_generic if any failed.
+ **/
+extern eOresult_t eOupdaterProgrammer_Program(eOupdaterProgrammer *p, eOuprot_partition2prog_t partition, const uint8_t *image, uint32_t size, uint32_t address);
+
+extern eOresult_t eOupdaterProgrammer_GetResult(eOupdaterProgrammer *p, uint8_t index, eOupdaterProgrammer_result_t *result);
+
+
+/** @}
+    end of group eoupdaterprogrammer
+ **/
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
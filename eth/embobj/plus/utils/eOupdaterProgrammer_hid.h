@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+ * website: www.robotcub.org
+ * Permission is granted to copy, distribute, and/or modify this program
+ * under the terms of the GNU General Public License, version 2 or any
+ * later version published by the Free Software Foundation.
+ *
+ * A copy of the license can be found at
+ * http://www.robotcub.org/icub/license/gpl.txt
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General
+ * Public License for more details
+*/
+
+// - include guard ----------------------------------------------------------------------------------------------------
+#ifndef _EOUPDATERPROGRAMMER_HID_H_
+#define _EOUPDATERPROGRAMMER_HID_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* @file       eOupdaterProgrammer_hid.h
+    @brief
+    @author     marco.accame@iit.it
+    @date       10/19/2026
+**/
+
+
+// - external dependencies --------------------------------------------------------------------------------------------
+
+#include "EoCommon.h"
+
+// - declaration of extern public interface ---------------------------------------------------------------------------
+
+#include "eOupdaterProgrammer.h"
+
+
+// - #define used with hidden struct ----------------------------------------------------------------------------------
+// empty-section
+
+
+// - definition of the hidden struct implementing the object ----------------------------------------------------------
+
+typedef enum
+{
+    eoupdprog_state_starting    = 0,
+    eoupdprog_state_sending     = 1,
+    eoupdprog_state_ending      = 2,
+    eoupdprog_state_done        = 3,
+    eoupdprog_state_failed      = 4
+} eOupdaterProgrammer_state_t;
+
+
+typedef struct
+{
+    uint64_t                        senttime;       // time of the last transmission
+    uint32_t                        order;          // progressive number of the last transmission inside the board
+    uint8_t                         due;            // 1 if it must be sent (again)
+    uint8_t                         acked;
+    uint8_t                         timeouts;
+    uint8_t                         filler[1];
+} eOupdaterProgrammer_chunk_t;
+
+
+typedef struct
+{
+    uint32_t                        capabilities;
+    uint8_t                         state;          // use eOupdaterProgrammer_state_t
+    uint8_t                         retries;        // of the command in progress: start, end, or the legacy data
+    uint16_t                        cumulative;     // all the chunks lower than it are acked
+    uint8_t                         stale;          // legacy: the replies still expected for the chunk just acked, which was sent more than once
+    uint8_t                         filler[3];
+    uint64_t                        lastsent;       // time of the last start, end, or legacy data
+    uint64_t                        starttime;
+    uint32_t                        order;          // progressive number of the transmissions of chunks
+    eOupdaterProgrammer_chunk_t     *chunks;        // windowed: numberofchunks entries
+    eOupdaterProgrammer_result_t    result;
+} eOupdaterProgrammer_board_t;
+
+
+struct eOupdaterProgrammer_hid
+{
+    eOupdaterProgrammer_cfg_t       cfg;
+    int                             socket;
+    eOupdaterProgrammer_board_t     boards[eOupdaterProgrammer_maxboards];
+    uint8_t                         numberofboards;
+    // the job in progress
+    uint8_t                         partition;
+    const uint8_t                   *image;
+    uint32_t                        size;
+    uint32_t                        address;
+    uint16_t                        numberofchunks;
+};
+
+
+// - declaration of extern hidden functions ---------------------------------------------------------------------------
+// empty-section
+
+
+#ifdef __cplusplus
+}       // closing brace for extern "C"
+#endif
+
+#endif  // include-guard
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+
+// - include guard ----------------------------------------------------------------------------------------------------
+
+#ifndef _TESTS_H_
+#define _TESTS_H_
+
+#include <cstdio>
+
+
+namespace tests {
+
+    // the number of checks which have failed. main() returns it, so that ctest sees a failure if it is not zero.
+    inline int failures {0};
+
+    inline void check(bool condition, const char *what, const char *file, int line)
+    {
+        if(!condition)
+        {
+            std::fprintf(stderr, "%s:%d: failed %s\n", file, line, what);
+            failures++;
+        }
+    }
+
+} // namespace tests
+
+
+#define TESTS_CHECK(condition)      tests::check((condition), #condition, __FILE__, __LINE__)
+
+
+#endif  // include-guard
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+// the round trip of eODeb_columnarExporter and eODeb_columnarReader: the rows read back must be those pushed, in the
+// bytes covered by the fields of the series. it uses the built-in descriptions, a variable of less than 255 bytes
+// and one of more than 255 bytes without description, chunks which are full and chunks written by the flush.
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "tests.h"
+
+#include <vector>
+#include <map>
+#include <random>
+#include <cstring>
+#include <string>
+
+#include "EoCommon.h"
+#include "EoProtocol.h"
+#include "EoProtocolMC.h"
+#include "EoProtocolAS.h"
+#include "EoMotionControl.h"
+#include "EoAnalogSensors.h"
+#include "eODeb_columnarExporter.h"
+#include "eODeb_columnarReader.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the test
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    struct Row
+    {
+        std::uint64_t timestamp {0};
+        std::vector<uint8_t> value {};
+    };
+
+    using Key = std::pair<eOipv4addr_t, eOprotID32_t>;
+
+    struct Variable
+    {
+        eOipv4addr_t board {0};
+        eOprotID32_t id32 {0};
+        uint16_t size {0};
+        uint32_t rows {0};
+    };
+
+}
+
+
+int main()
+{
+    const char *filename = "tests_columnar.eocols";
+    const eODeb_columnarExporter_cfg_t cfg = { 16, 7 };
+    const eOipv4addr_t board1 = EO_COMMON_IPV4ADDR(10, 0, 1, 1);
+    const eOipv4addr_t board2 = EO_COMMON_IPV4ADDR(10, 0, 1, 2);
+
+    // the tag of the last two is not described, so they are exported as raw, raw0, raw1 and raw2
+    const Variable variables[] =
+    {
+        { board1, eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, eoprot_tag_mc_joint_status_core), sizeof(eOmc_joint_status_core_t), 20 },
+        { board1, eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 1, eoprot_tag_mc_joint_status_core), sizeof(eOmc_joint_status_core_t), 14 },
+        { board2, eoprot_ID_get(eoprot_endpoint_analogsensors, eoprot_entity_as_ft, 0, eoprot_tag_as_ft_status_timedvalue), sizeof(eOas_ft_timedvalue_t), 10 },
+        { board2, eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 0, eoprot_tag_mc_joint_config), 100, 5 },
+        { board2, eoprot_ID_get(eoprot_endpoint_motioncontrol, eoprot_entity_mc_joint, 1, eoprot_tag_mc_joint_config), 600, 9 }
+    };
+
+    std::map<Key, std::vector<Row>> pushed {};
+    std::mt19937 rnd {1};
+
+    eODeb_columnarExporter *exporter = eODeb_columnarExporter_New(&cfg, filename);
+    TESTS_CHECK(nullptr != exporter);
+    if(nullptr == exporter)
+    {
+        return tests::failures;
+    }
+
+    // the rows of the variables are interleaved, and the values change only in a few bytes from a row to the next
+    for(uint32_t r=0; r<20; r++)
+    {
+        for(const auto &v : variables)
+        {
+            std::vector<Row> &rows = pushed[Key(v.board, v.id32)];
+            if(rows.size() >= v.rows)
+            {
+                continue;
+            }
+
+            Row row {};
+            row.value = rows.empty() ? std::vector<uint8_t>(v.size, 0) : rows.back().value;
+            for(int k=0; k<4; k++)
+            {
+                row.value[rnd() % v.size] = static_cast<uint8_t>(rnd());
+            }
+            // the timestamps go also backwards, which gives negative deltas
+            row.timestamp = 1000000 + 1000*r - ((5 == r) ? 3000 : 0) + (rnd() % 10);
+
+            eOropdescriptor_t rop {};
+            rop.ropcode = (0 == (r % 2)) ? eo_ropcode_sig : eo_ropcode_say;
+            rop.id32 = v.id32;
+            rop.size = v.size;
+            rop.data = row.value.data();
+            TESTS_CHECK(eores_OK == eODeb_columnarExporter_Push(exporter, v.board, &rop, row.timestamp));
+
+            rows.push_back(row);
+        }
+    }
+
+    // a rop which is not say or sig is not exported
+    eOropdescriptor_t ask {};
+    uint8_t dummy[4] = {0};
+    ask.ropcode = eo_ropcode_ask;
+    ask.id32 = variables[0].id32;
+    ask.size = sizeof(dummy);
+    ask.data = dummy;
+    TESTS_CHECK(eores_NOK_generic == eODeb_columnarExporter_Push(exporter, board1, &ask, 0));
+
+    eODeb_columnarExporter_stats_t stats {};
+    eODeb_columnarExporter_GetStats(exporter, &stats);
+    TESTS_CHECK(58 == stats.rows);
+    TESTS_CHECK(1 == stats.ignored);
+
+    eODeb_columnarExporter_Delete(exporter);
+
+    // now we read it back
+    eODeb_columnarReader *reader = eODeb_columnarReader_New(filename);
+    TESTS_CHECK(nullptr != reader);
+    if(nullptr == reader)
+    {
+        return tests::failures;
+    }
+
+    std::map<Key, std::size_t> read {};
+    eODeb_columnarReader_chunk_t chunk {};
+    eOresult_t res = eores_OK;
+    uint32_t chunks = 0;
+
+    while(eores_OK == (res = eODeb_columnarReader_Next(reader, &chunk)))
+    {
+        const eODeb_columnarReader_series_t *series = chunk.series;
+        const Key key(series->board, series->id32);
+        const std::vector<Row> &rows = pushed[key];
+        std::size_t &next = read[key];
+
+        chunks++;
+        TESTS_CHECK(chunk.rows <= cfg.rowsperchunk);
+        TESTS_CHECK(next + chunk.rows <= rows.size());
+        if(next + chunk.rows > rows.size())
+        {
+            break;
+        }
+
+        // the bytes which are inside a field, as the padding of the described variables is not exported
+        std::vector<bool> mask(series->size, false);
+        for(uint8_t f=0; f<series->numberof; f++)
+        {
+            for(uint8_t b=0; b<series->fields[f].width; b++)
+            {
+                mask[series->fields[f].offset + b] = true;
+            }
+        }
+
+        if(eoprot_tag_mc_joint_config == eoprot_ID2tag(series->id32))
+        {
+            const std::vector<std::string> names = (series->size > 255) ? std::vector<std::string>{"raw0", "raw1", "raw2"} : std::vector<std::string>{"raw"};
+            TESTS_CHECK(names.size() == series->numberof);
+            for(uint8_t f=0; (f<series->numberof) && (f<names.size()); f++)
+            {
+                TESTS_CHECK(names[f] == series->fields[f].name);
+            }
+            TESTS_CHECK(std::vector<bool>(series->size, true) == mask);
+        }
+
+        for(uint32_t r=0; r<chunk.rows; r++)
+        {
+            const Row &row = rows[next + r];
+            const uint8_t *value = &chunk.values[r * series->size];
+            TESTS_CHECK(row.timestamp == chunk.timestamps[r]);
+            TESTS_CHECK(row.value.size() == series->size);
+            bool same = true;
+            for(uint16_t b=0; b<series->size; b++)
+            {
+                same = same && ((!mask[b]) || (row.value[b] == value[b]));
+            }
+            TESTS_CHECK(same);
+        }
+
+        next += chunk.rows;
+    }
+
+    TESTS_CHECK(eores_NOK_nodata == res);
+
+    // every row has been read: 3+2+2+1+2 chunks, of which four are written by the flush
+    for(const auto &v : variables)
+    {
+        TESTS_CHECK(v.rows == read[Key(v.board, v.id32)]);
+    }
+    TESTS_CHECK(10 == chunks);
+
+    eODeb_columnarReader_Delete(reader);
+    std::remove(filename);
+
+    // a file of another kind is refused
+    std::FILE *other = std::fopen(filename, "wb");
+    if(nullptr != other)
+    {
+        std::fputs("not a columnar file", other);
+        std::fclose(other);
+    }
+    TESTS_CHECK(nullptr == eODeb_columnarReader_New(filename));
+    std::remove(filename);
+
+    return tests::failures;
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+
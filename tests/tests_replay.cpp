@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 iCub Tech - Istituto Italiano di Tecnologia
+ * Author:  Marco Accame
+ * email:   marco.accame@iit.it
+*/
+
+// the pacing of eODeb_replayEngine at real time: a timestamp of the capture which goes backwards must count as no
+// time elapsed. before the fix the delta from the first timestamp underflowed: the due time of the packets after the
+// jump wrapped around, so they were not paced at all, or it did not and the replay slept for centuries.
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - external dependencies
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "tests.h"
+
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <cstring>
+
+#include "EoCommon.h"
+#include "EOvector_hid.h"
+#include "EOhostTransceiver.h"
+#include "EOYtheSystem.h"
+#include "EOYmutex.h"
+#include "EoProtocol.h"
+#include "EoProtocolMN.h"
+#include "eODeb_replayEngine.h"
+
+
+// --------------------------------------------------------------------------------------------------------------------
+// - the test
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+    double s_timeget()
+    {
+        return 1e-9 * static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void * s_mutex_new()
+    {
+        return new std::mutex;
+    }
+
+    int8_t s_mutex_take(void *m, uint32_t)
+    {
+        static_cast<std::mutex*>(m)->lock();
+        return eores_OK;
+    }
+
+    int8_t s_mutex_release(void *m)
+    {
+        static_cast<std::mutex*>(m)->unlock();
+        return eores_OK;
+    }
+
+    void s_mutex_delete(void *m)
+    {
+        delete static_cast<std::mutex*>(m);
+    }
+
+    void s_put32(std::vector<uint8_t> &data, uint32_t v)
+    {
+        for(int i=0; i<4; i++)
+        {
+            data.push_back(static_cast<uint8_t>(v >> (8*i)));
+        }
+    }
+
+    // a record of a capture in libpcap format with microseconds: ethernet + ip + udp + a payload of 16 bytes
+    void s_record(std::vector<uint8_t> &capture, eOipv4addr_t source, uint32_t sec, uint32_t usec)
+    {
+        std::vector<uint8_t> frame(14 + 20 + 8 + 16, 0);
+        const uint16_t iplen = 20 + 8 + 16;
+        frame[12] = 0x08;
+        frame[14] = 0x45;
+        frame[14 + 2] = static_cast<uint8_t>(iplen >> 8);
+        frame[14 + 3] = static_cast<uint8_t>(iplen);
+        frame[14 + 9] = 17;
+        // EO_COMMON_IPV4ADDR() keeps the first byte of the address in the lowest byte, which is network order
+        std::memcpy(&frame[14 + 12], &source, 4);
+        frame[34 + 1] = 12;
+        frame[34 + 3] = 12;
+
+        s_put32(capture, sec);
+        s_put32(capture, usec);
+        s_put32(capture, static_cast<uint32_t>(frame.size()));
+        s_put32(capture, static_cast<uint32_t>(frame.size()));
+        capture.insert(capture.end(), frame.begin(), frame.end());
+    }
+
+}
+
+
+int main()
+{
+    const char *filename = "tests_replay.pcap";
+    const eOipv4addr_t board = EO_COMMON_IPV4ADDR(10, 0, 1, 1);
+    const eOipv4addr_t other = EO_COMMON_IPV4ADDR(10, 0, 1, 9);
+
+    const eOysystem_cfg_t syscfg =
+    {
+        s_timeget,
+        { s_mutex_new, s_mutex_take, s_mutex_release, s_mutex_delete }
+    };
+    eoy_sys_Initialise(&syscfg, NULL, NULL);
+
+    // the capture: 2 ms, then 5 s backwards, then 3 ms, 7 ms to a frame of a board which is not replayed and 1 ms.
+    // all the deltas are paced, also the one to the frame which is discarded, but not the one backwards: 13 ms.
+    std::vector<uint8_t> capture {};
+    s_put32(capture, 0xa1b2c3d4);
+    s_put32(capture, 0x00040002);
+    s_put32(capture, 0);
+    s_put32(capture, 0);
+    s_put32(capture, 65535);
+    s_put32(capture, 1);
+    s_record(capture, board, 100, 0);
+    s_record(capture, board, 100, 2000);
+    s_record(capture, board, 95, 0);
+    s_record(capture, board, 95, 3000);
+    s_record(capture, other, 95, 10000);
+    s_record(capture, board, 95, 11000);
+
+    std::FILE *file = std::fopen(filename, "wb");
+    TESTS_CHECK(nullptr != file);
+    if(nullptr == file)
+    {
+        return tests::failures;
+    }
+    std::fwrite(capture.data(), capture.size(), 1, file);
+    std::fclose(file);
+
+    std::vector<eOprot_EPcfg_t> endpoints {eoprot_mn_basicEPcfg};
+    EOconstvector vector = { static_cast<eOsizecntnr_t>(endpoints.size()), static_cast<eOsizecntnr_t>(endpoints.size()), sizeof(eOprot_EPcfg_t), 0, endpoints.data(), nullptr };
+    eOnvset_BRDcfg_t brdcfg = { 0, {0, 0, 0}, &vector };
+
+    eOhosttransceiver_cfg_t htrxcfg = eo_hosttransceiver_cfg_default;
+    htrxcfg.nvsetbrdcfg = &brdcfg;
+    htrxcfg.remoteboardipv4addr = board;
+    htrxcfg.mutex_fn_new = reinterpret_cast<eov_mutex_fn_mutexderived_new>(eoy_mutex_New);
+    EOhostTransceiver *htrx = eo_hosttransceiver_New(&htrxcfg);
+    TESTS_CHECK(nullptr != htrx);
+
+    eODeb_replayEngine_cfg_t cfg = eODeb_replayEngine_cfg_default;
+    cfg.speedfactor = 1.0f;
+    eODeb_replayEngine *engine = eODeb_replayEngine_New(&cfg);
+    TESTS_CHECK(nullptr != engine);
+    if((nullptr == htrx) || (nullptr == engine))
+    {
+        return tests::failures;
+    }
+
+    TESTS_CHECK(eores_OK == eODeb_replayEngine_AddTransceiver(engine, htrx));
+    TESTS_CHECK(eores_OK == eODeb_replayEngine_Run(engine, filename));
+
+    // the payload is not a ropframe, so the transceiver refuses the packets: we dont need them to be valid
+    eODeb_replayEngine_stats_t stats {};
+    eODeb_replayEngine_GetStats(engine, &stats);
+    TESTS_CHECK(1 == stats.packetsdiscarded);
+    TESTS_CHECK(5 == (stats.packets + stats.packetsinvalid));
+
+    // the replay cannot be shorter than the pacing, and it is much shorter than the 5 s of the jump backwards
+    TESTS_CHECK(stats.elapsedtime >= 13000000);
+    TESTS_CHECK(stats.elapsedtime < 1000000000);
+
+    eODeb_replayEngine_Delete(engine);
+    eo_hosttransceiver_Delete(htrx);
+    std::remove(filename);
+
+    return tests::failures;
+}
+
+
+// - end-of-file (leave a blank line after)----------------------------------------------------------------------------
+